@@ -0,0 +1,466 @@
+//
+//  art_index.cpp
+//  JasDB
+//
+
+#include "art_index.hpp"
+#include <algorithm>
+
+namespace jasdb{
+
+ArtIndex::ArtIndex(std::vector<ColumnDefinition*>* columns, std::vector<size_t>& col_ids) : IndexStore(columns, col_ids){
+    root = NULL;
+}
+
+ArtIndex::~ArtIndex(){
+    freeNode(root);
+}
+
+void ArtIndex::clear(){
+    std::lock_guard<std::mutex> guard(latch);
+    freeNode(root);
+    root = NULL;
+    built = false;
+}
+
+void ArtIndex::freeNode(ArtNode* node){
+    if(node == NULL){
+        return;
+    }
+    if(node->type != kArtLeaf){
+        std::vector<std::pair<uint8_t, ArtNode*>> children;
+        listChildren(static_cast<ArtInner*>(node), children);
+        for(auto& child : children){
+            freeNode(child.second);
+        }
+    }
+    delete node;
+}
+
+template<int N>
+static ArtNode** findSorted(ArtSortedNode<N>* node, uint8_t byte){
+    for(uint16_t i=0;i<node->count;i++){
+        if(node->keys[i] == byte){
+            return &node->children[i];
+        }
+    }
+    return NULL;
+}
+
+template<int N>
+static void addSorted(ArtSortedNode<N>* node, uint8_t byte, ArtNode* child){
+    uint16_t pos = 0;
+    while(pos < node->count && node->keys[pos] < byte){
+        pos++;
+    }
+    for(uint16_t i=node->count;i>pos;i--){
+        node->keys[i] = node->keys[i - 1];
+        node->children[i] = node->children[i - 1];
+    }
+    node->keys[pos] = byte;
+    node->children[pos] = child;
+    node->count++;
+}
+
+template<int N>
+static void removeSorted(ArtSortedNode<N>* node, uint8_t byte){
+    uint16_t pos = 0;
+    while(pos < node->count && node->keys[pos] != byte){
+        pos++;
+    }
+    if(pos == node->count){
+        return;
+    }
+    for(uint16_t i=pos;i+1<node->count;i++){
+        node->keys[i] = node->keys[i + 1];
+        node->children[i] = node->children[i + 1];
+    }
+    node->count--;
+}
+
+ArtNode** ArtIndex::findChild(ArtInner* node, uint8_t byte){
+    switch (node->type) {
+        case kArtNode4:
+            return findSorted(static_cast<ArtNode4*>(node), byte);
+        case kArtNode16:
+            return findSorted(static_cast<ArtNode16*>(node), byte);
+        case kArtNode48:
+        {
+            ArtNode48* node48 = static_cast<ArtNode48*>(node);
+            uint8_t pos = node48->child_index[byte];
+            return pos != 0 ? &node48->children[pos - 1] : NULL;
+        }
+        case kArtNode256:
+        {
+            ArtNode256* node256 = static_cast<ArtNode256*>(node);
+            return node256->children[byte] != NULL ? &node256->children[byte] : NULL;
+        }
+        default:
+            return NULL;
+    }
+}
+
+void ArtIndex::listChildren(ArtInner* node, std::vector<std::pair<uint8_t, ArtNode*>>& children){
+    switch (node->type) {
+        case kArtNode4:
+        case kArtNode16:
+        {
+            // both sorted node types have the same layout up to their size
+            uint8_t* keys = node->type == kArtNode4 ? static_cast<ArtNode4*>(node)->keys : static_cast<ArtNode16*>(node)->keys;
+            ArtNode** nodes = node->type == kArtNode4 ? static_cast<ArtNode4*>(node)->children : static_cast<ArtNode16*>(node)->children;
+            for(uint16_t i=0;i<node->count;i++){
+                children.push_back(std::make_pair(keys[i], nodes[i]));
+            }
+            break;
+        }
+        case kArtNode48:
+        {
+            ArtNode48* node48 = static_cast<ArtNode48*>(node);
+            for(int byte=0;byte<256;byte++){
+                if(node48->child_index[byte] != 0){
+                    children.push_back(std::make_pair(static_cast<uint8_t>(byte), node48->children[node48->child_index[byte] - 1]));
+                }
+            }
+            break;
+        }
+        case kArtNode256:
+        {
+            ArtNode256* node256 = static_cast<ArtNode256*>(node);
+            for(int byte=0;byte<256;byte++){
+                if(node256->children[byte] != NULL){
+                    children.push_back(std::make_pair(static_cast<uint8_t>(byte), node256->children[byte]));
+                }
+            }
+            break;
+        }
+        default:
+            break;
+    }
+}
+
+size_t ArtIndex::capacity(ArtInner* node){
+    switch (node->type) {
+        case kArtNode4:
+            return 4;
+        case kArtNode16:
+            return 16;
+        case kArtNode48:
+            return 48;
+        default:
+            return 256;
+    }
+}
+
+void ArtIndex::addChild(ArtInner* node, uint8_t byte, ArtNode* child){
+    switch (node->type) {
+        case kArtNode4:
+            addSorted(static_cast<ArtNode4*>(node), byte, child);
+            break;
+        case kArtNode16:
+            addSorted(static_cast<ArtNode16*>(node), byte, child);
+            break;
+        case kArtNode48:
+        {
+            ArtNode48* node48 = static_cast<ArtNode48*>(node);
+            uint8_t pos = 0;
+            while(node48->children[pos] != NULL){
+                pos++;
+            }
+            node48->children[pos] = child;
+            node48->child_index[byte] = pos + 1;
+            node48->count++;
+            break;
+        }
+        case kArtNode256:
+            static_cast<ArtNode256*>(node)->children[byte] = child;
+            node->count++;
+            break;
+        default:
+            break;
+    }
+}
+
+void ArtIndex::removeChild(ArtInner* node, uint8_t byte){
+    switch (node->type) {
+        case kArtNode4:
+            removeSorted(static_cast<ArtNode4*>(node), byte);
+            break;
+        case kArtNode16:
+            removeSorted(static_cast<ArtNode16*>(node), byte);
+            break;
+        case kArtNode48:
+        {
+            ArtNode48* node48 = static_cast<ArtNode48*>(node);
+            node48->children[node48->child_index[byte] - 1] = NULL;
+            node48->child_index[byte] = 0;
+            node48->count--;
+            break;
+        }
+        case kArtNode256:
+            // the child may already be gone from its slot, a freed leaf clears the slot itself
+            static_cast<ArtNode256*>(node)->children[byte] = NULL;
+            node->count--;
+            break;
+        default:
+            break;
+    }
+}
+
+ArtInner* ArtIndex::resize(ArtInner* node, size_t count){
+    ArtInner* resized = NULL;
+    if(count <= 4){
+        resized = new ArtNode4();
+    }
+    else if(count <= 16){
+        resized = new ArtNode16();
+    }
+    else if(count <= 48){
+        resized = new ArtNode48();
+    }
+    else{
+        resized = new ArtNode256();
+    }
+    resized->prefix.swap(node->prefix);
+    std::vector<std::pair<uint8_t, ArtNode*>> children;
+    listChildren(node, children);
+    for(auto& child : children){
+        addChild(resized, child.first, child.second);
+    }
+    delete node;
+    return resized;
+}
+
+size_t ArtIndex::matchPrefix(const std::string& prefix, const std::string& key, size_t depth){
+    size_t i = 0;
+    while(i < prefix.size() && depth + i < key.size() && prefix[i] == key[depth + i]){
+        i++;
+    }
+    return i;
+}
+
+void ArtIndex::insert(const std::string& key, Tuple tup){
+    std::lock_guard<std::mutex> guard(latch);
+    insertInto(&root, key, 0, tup);
+}
+
+// no key is a prefix of another one (see IndexStore::encodeKey),
+// so two different keys always differ at a byte both of them have
+void ArtIndex::insertInto(ArtNode** ref, const std::string& key, size_t depth, Tuple tup){
+    ArtNode* node = *ref;
+    if(node == NULL){
+        ArtLeaf* leaf = new ArtLeaf(key);
+        leaf->tuples.push_back(tup);
+        *ref = leaf;
+        return;
+    }
+    if(node->type == kArtLeaf){
+        ArtLeaf* leaf = static_cast<ArtLeaf*>(node);
+        if(leaf->key == key){
+            // an online build's side log is the one source of repeated entries, finishBuild filters it
+            leaf->tuples.push_back(tup);
+            return;
+        }
+        // the leaf gets a parent branching where the two keys differ
+        size_t same = depth;
+        while(key[same] == leaf->key[same]){
+            same++;
+        }
+        ArtNode4* branch = new ArtNode4();
+        branch->prefix = key.substr(depth, same - depth);
+        ArtLeaf* new_leaf = new ArtLeaf(key);
+        new_leaf->tuples.push_back(tup);
+        addChild(branch, leaf->key[same], leaf);
+        addChild(branch, key[same], new_leaf);
+        *ref = branch;
+        return;
+    }
+    ArtInner* inner = static_cast<ArtInner*>(node);
+    size_t matched = matchPrefix(inner->prefix, key, depth);
+    if(matched < inner->prefix.size()){
+        // the key leaves the prefix, a new node branches where it does
+        ArtNode4* branch = new ArtNode4();
+        branch->prefix = inner->prefix.substr(0, matched);
+        uint8_t inner_byte = inner->prefix[matched];
+        inner->prefix.erase(0, matched + 1);
+        ArtLeaf* new_leaf = new ArtLeaf(key);
+        new_leaf->tuples.push_back(tup);
+        addChild(branch, inner_byte, inner);
+        addChild(branch, key[depth + matched], new_leaf);
+        *ref = branch;
+        return;
+    }
+    depth += matched;
+    ArtNode** child = findChild(inner, key[depth]);
+    if(child != NULL){
+        insertInto(child, key, depth + 1, tup);
+        return;
+    }
+    if(inner->count == capacity(inner)){
+        inner = resize(inner, inner->count + 1);
+        *ref = inner;
+    }
+    ArtLeaf* new_leaf = new ArtLeaf(key);
+    new_leaf->tuples.push_back(tup);
+    addChild(inner, key[depth], new_leaf);
+}
+
+void ArtIndex::erase(const std::string& key, Tuple tup){
+    std::lock_guard<std::mutex> guard(latch);
+    eraseFrom(&root, key, 0, tup);
+}
+
+void ArtIndex::eraseFrom(ArtNode** ref, const std::string& key, size_t depth, Tuple tup){
+    ArtNode* node = *ref;
+    if(node == NULL){
+        return;
+    }
+    if(node->type == kArtLeaf){
+        ArtLeaf* leaf = static_cast<ArtLeaf*>(node);
+        if(leaf->key != key){
+            return;
+        }
+        for(size_t i=0;i<leaf->tuples.size();i++){
+            if(leaf->tuples[i].block == tup.block && leaf->tuples[i].slot == tup.slot){
+                leaf->tuples[i] = leaf->tuples.back();
+                leaf->tuples.pop_back();
+                break;
+            }
+        }
+        if(leaf->tuples.empty()){
+            delete leaf;
+            *ref = NULL;
+        }
+        return;
+    }
+    ArtInner* inner = static_cast<ArtInner*>(node);
+    size_t matched = matchPrefix(inner->prefix, key, depth);
+    if(matched < inner->prefix.size() || depth + matched >= key.size()){
+        return;
+    }
+    depth += matched;
+    uint8_t byte = key[depth];
+    ArtNode** child = findChild(inner, byte);
+    if(child == NULL){
+        return;
+    }
+    eraseFrom(child, key, depth + 1, tup);
+    if(*child != NULL){
+        return;
+    }
+    removeChild(inner, byte);
+    if(inner->count == 1){
+        // a node with one child is merged into it, a leaf simply moves up
+        std::vector<std::pair<uint8_t, ArtNode*>> children;
+        listChildren(inner, children);
+        ArtNode* only = children[0].second;
+        if(only->type != kArtLeaf){
+            ArtInner* only_inner = static_cast<ArtInner*>(only);
+            only_inner->prefix = inner->prefix + static_cast<char>(children[0].first) + only_inner->prefix;
+        }
+        delete inner;
+        *ref = only;
+        return;
+    }
+    // shrink with some slack, so a node at the border doesn't change its type on every change
+    size_t smaller = inner->type == kArtNode16 ? 4 : (inner->type == kArtNode48 ? 16 : (inner->type == kArtNode256 ? 48 : 0));
+    if(inner->count <= smaller - smaller / 4){
+        *ref = resize(inner, inner->count);
+    }
+}
+
+ArtLeaf* ArtIndex::lookup(const std::string& key){
+    ArtNode* node = root;
+    size_t depth = 0;
+    while(node != NULL){
+        if(node->type == kArtLeaf){
+            ArtLeaf* leaf = static_cast<ArtLeaf*>(node);
+            return leaf->key == key ? leaf : NULL;
+        }
+        ArtInner* inner = static_cast<ArtInner*>(node);
+        if(matchPrefix(inner->prefix, key, depth) < inner->prefix.size()){
+            return NULL;
+        }
+        depth += inner->prefix.size();
+        if(depth >= key.size()){
+            return NULL;
+        }
+        ArtNode** child = findChild(inner, key[depth]);
+        node = child != NULL ? *child : NULL;
+        depth++;
+    }
+    return NULL;
+}
+
+// every key below an inner node starts with path, which is enough to skip the node
+// when path is outside the range
+static int comparePath(const std::string& path, const std::string& bound){
+    return memcmp(path.data(), bound.data(), std::min(path.size(), bound.size()));
+}
+
+bool ArtIndex::scanNode(ArtNode* node, std::string& path, IndexRange& range, std::vector<Tuple>& tuples){
+    if(node->type == kArtLeaf){
+        ArtLeaf* leaf = static_cast<ArtLeaf*>(node);
+        int res = range.compare(leaf->key);
+        if(res == 0){
+            tuples.insert(tuples.end(), leaf->tuples.begin(), leaf->tuples.end());
+        }
+        return res > 0;
+    }
+    ArtInner* inner = static_cast<ArtInner*>(node);
+    size_t len = path.size();
+    path += inner->prefix;
+    bool done = false;
+    if(range.has_upper && comparePath(path, range.upper) > 0){
+        done = true;
+    }
+    else if(!range.has_lower || comparePath(path, range.lower) >= 0){
+        std::vector<std::pair<uint8_t, ArtNode*>> children;
+        listChildren(inner, children);
+        for(size_t i=0;i<children.size() && !done;i++){
+            path.push_back(static_cast<char>(children[i].first));
+            done = scanNode(children[i].second, path, range, tuples);
+            path.pop_back();
+        }
+    }
+    path.resize(len);
+    return done;
+}
+
+void ArtIndex::scan(IndexRange& range, std::vector<Tuple>& tuples){
+    std::lock_guard<std::mutex> guard(latch);
+    if(range.isPoint()){
+        ArtLeaf* leaf = lookup(range.lower);
+        if(leaf != NULL){
+            tuples.insert(tuples.end(), leaf->tuples.begin(), leaf->tuples.end());
+        }
+        return;
+    }
+    std::string path;
+    if(root != NULL){
+        scanNode(root, path, range, tuples);
+    }
+}
+
+void ArtIndex::dumpNode(ArtNode* node, std::vector<IndexEntry>& entries){
+    if(node->type == kArtLeaf){
+        ArtLeaf* leaf = static_cast<ArtLeaf*>(node);
+        for(auto tup : leaf->tuples){
+            entries.emplace_back(leaf->key, tup);
+        }
+        return;
+    }
+    std::vector<std::pair<uint8_t, ArtNode*>> children;
+    listChildren(static_cast<ArtInner*>(node), children);
+    for(auto& child : children){
+        dumpNode(child.second, entries);
+    }
+}
+
+void ArtIndex::dump(std::vector<IndexEntry>& entries){
+    std::lock_guard<std::mutex> guard(latch);
+    if(root != NULL){
+        dumpNode(root, entries);
+    }
+}
+
+}
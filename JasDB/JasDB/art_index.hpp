@@ -0,0 +1,122 @@
+//
+//  art_index.hpp
+//  JasDB
+//
+
+#ifndef art_index_hpp
+#define art_index_hpp
+
+#include <stdio.h>
+#include <mutex>
+#include <cstring>
+#include "index_store.hpp"
+
+namespace jasdb{
+
+enum ArtNodeType : uint8_t {
+    kArtLeaf,
+    kArtNode4,
+    kArtNode16,
+    kArtNode48,
+    kArtNode256
+};
+
+class ArtNode {
+public:
+    ArtNodeType type;
+    ArtNode(ArtNodeType type) : type(type){}
+    // children are not freed with their parent, nodes are copied when they grow or shrink
+    virtual ~ArtNode(){}
+};
+
+// A leaf holds the whole key, so a path which only leads to one key ends in a leaf right away.
+class ArtLeaf : public ArtNode {
+public:
+    std::string key;
+    std::vector<Tuple> tuples;
+    ArtLeaf(const std::string& key) : ArtNode(kArtLeaf), key(key){}
+};
+
+// Every inner node stores the bytes all keys below it share after the parent's byte,
+// so chains of nodes with a single child never exist.
+class ArtInner : public ArtNode {
+public:
+    std::string prefix;
+    uint16_t count;
+    ArtInner(ArtNodeType type) : ArtNode(type), count(0){}
+};
+
+// up to N children, kept sorted by their byte
+template<int N>
+class ArtSortedNode : public ArtInner {
+public:
+    uint8_t keys[N];
+    ArtNode* children[N];
+    ArtSortedNode() : ArtInner(N == 4 ? kArtNode4 : kArtNode16){}
+};
+
+typedef ArtSortedNode<4> ArtNode4;
+typedef ArtSortedNode<16> ArtNode16;
+
+class ArtNode48 : public ArtInner {
+public:
+    // position of the child of a byte in children plus one, 0 when there is none
+    uint8_t child_index[256];
+    ArtNode* children[48];
+    ArtNode48() : ArtInner(kArtNode48){
+        memset(child_index, 0, sizeof(child_index));
+        memset(children, 0, sizeof(children));
+    }
+};
+
+class ArtNode256 : public ArtInner {
+public:
+    ArtNode* children[256];
+    ArtNode256() : ArtInner(kArtNode256){
+        memset(children, 0, sizeof(children));
+    }
+};
+
+// Adaptive radix tree, for indexes created with USING ART.
+// The tree branches on one key byte per level, so a lookup costs the length of the key
+// instead of log(n) string comparisons, and a prefix of the key selects a subtree.
+// Inner nodes grow from 4 to 16, 48 and 256 children and shrink again, which keeps
+// sparse levels small. One latch serializes the sessions using the tree.
+class ArtIndex : public IndexStore {
+public:
+    ArtIndex(std::vector<ColumnDefinition*>* columns, std::vector<size_t>& col_ids);
+    ~ArtIndex();
+    void scan(IndexRange& range, std::vector<Tuple>& tuples) override;
+protected:
+    void insert(const std::string& key, Tuple tup) override;
+    void erase(const std::string& key, Tuple tup) override;
+    void clear() override;
+    void dump(std::vector<IndexEntry>& entries) override;
+    // NULL while the tree is empty
+    ArtNode* root;
+private:
+    std::mutex latch;
+    static void dumpNode(ArtNode* node, std::vector<IndexEntry>& entries);
+    void insertInto(ArtNode** ref, const std::string& key, size_t depth, Tuple tup);
+    void eraseFrom(ArtNode** ref, const std::string& key, size_t depth, Tuple tup);
+    ArtLeaf* lookup(const std::string& key);
+    // return true once a key above the range was reached
+    bool scanNode(ArtNode* node, std::string& path, IndexRange& range, std::vector<Tuple>& tuples);
+    static void freeNode(ArtNode* node);
+    static ArtNode** findChild(ArtInner* node, uint8_t byte);
+    // the children with their bytes in byte order
+    static void listChildren(ArtInner* node, std::vector<std::pair<uint8_t, ArtNode*>>& children);
+    static size_t capacity(ArtInner* node);
+    // the node has room for the child
+    static void addChild(ArtInner* node, uint8_t byte, ArtNode* child);
+    // the node has a child for byte
+    static void removeChild(ArtInner* node, uint8_t byte);
+    // copy node into the smallest node type with room for count children, node is freed
+    static ArtInner* resize(ArtInner* node, size_t count);
+    // bytes key and prefix share, starting at depth of key
+    static size_t matchPrefix(const std::string& prefix, const std::string& key, size_t depth);
+};
+
+}
+
+#endif /* art_index_hpp */
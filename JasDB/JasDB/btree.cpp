@@ -0,0 +1,256 @@
+//
+//  btree.cpp
+//  JasDB
+//
+
+#include "btree.hpp"
+#include <algorithm>
+#include <iterator>
+
+namespace jasdb{
+
+BTreeIndex::BTreeIndex(std::vector<ColumnDefinition*>* columns, std::vector<size_t>& col_ids) : IndexStore(columns, col_ids){
+    root = new BTreeNode(true, 0);
+}
+
+BTreeIndex::~BTreeIndex(){
+    delete root.load();
+}
+
+void BTreeIndex::clear(){
+    delete root.load();
+    root = new BTreeNode(true, 0);
+    built = false;
+}
+
+static const IndexEntry& smallestEntry(BTreeNode* node){
+    while(!node->leaf){
+        node = node->children.front();
+    }
+    return node->entries.front();
+}
+
+// chain the nodes of a level from left to right
+static void linkLevel(std::vector<BTreeNode*>& level){
+    for(size_t i=0;i+1<level.size();i++){
+        level[i]->next = level[i + 1];
+        level[i]->has_high = true;
+        level[i]->high = smallestEntry(level[i + 1]);
+    }
+}
+
+// sort the entries and build the tree bottom up, level by level. The nodes of a level share the entries or children
+// evenly, so all of them are full or nearly full and none is left almost empty at the end.
+void BTreeIndex::load(std::vector<IndexEntry>& entries){
+    sortEntries(entries);
+    if(entries.empty()){
+        return;
+    }
+    std::vector<BTreeNode*> level;
+    size_t count = (entries.size() + kBTreeNodeSize - 1) / kBTreeNodeSize;
+    for(size_t i=0;i<count;i++){
+        BTreeNode* leaf = new BTreeNode(true, 0);
+        leaf->entries.assign(std::make_move_iterator(entries.begin() + entries.size() * i / count),
+                             std::make_move_iterator(entries.begin() + entries.size() * (i + 1) / count));
+        level.push_back(leaf);
+    }
+    linkLevel(level);
+    while(level.size() > 1){
+        // an inner node has one child more than separators
+        std::vector<BTreeNode*> parents;
+        count = (level.size() + kBTreeNodeSize) / (kBTreeNodeSize + 1);
+        for(size_t i=0;i<count;i++){
+            BTreeNode* parent = new BTreeNode(false, level.front()->level + 1);
+            size_t begin = level.size() * i / count;
+            size_t end = level.size() * (i + 1) / count;
+            for(size_t j=begin;j<end;j++){
+                if(j > begin){
+                    parent->entries.push_back(smallestEntry(level[j]));
+                }
+                parent->children.push_back(level[j]);
+            }
+            parents.push_back(parent);
+        }
+        linkLevel(parents);
+        level.swap(parents);
+    }
+    delete root.load();
+    root = level.front();
+}
+
+BTreeNode* BTreeIndex::descend(const IndexEntry& entry, uint16_t level, std::vector<BTreeNode*>* path){
+    BTreeNode* node = root;
+    while(true){
+        node->latch.lock_shared();
+        BTreeNode* next;
+        if(node->beyond(entry)){
+            next = node->next;
+        }
+        else if(node->level == level){
+            node->latch.unlock_shared();
+            return node;
+        }
+        else{
+            if(path != NULL){
+                if(path->size() <= node->level){
+                    path->resize(node->level + 1, NULL);
+                }
+                (*path)[node->level] = node;
+            }
+            size_t i = std::upper_bound(node->entries.begin(), node->entries.end(), entry) - node->entries.begin();
+            next = node->children[i];
+        }
+        node->latch.unlock_shared();
+        node = next;
+    }
+}
+
+BTreeNode* BTreeIndex::latchForChange(BTreeNode* node, const IndexEntry& entry){
+    node->latch.lock();
+    while(node->beyond(entry)){
+        // nodes are never freed, the sibling can be latched after the node is released
+        BTreeNode* next = node->next;
+        node->latch.unlock();
+        next->latch.lock();
+        node = next;
+    }
+    return node;
+}
+
+void BTreeIndex::insert(const std::string& key, Tuple tup){
+    IndexEntry entry(key, tup);
+    std::vector<BTreeNode*> path;
+    BTreeNode* node = latchForChange(descend(entry, 0, &path), entry);
+    auto it = std::lower_bound(node->entries.begin(), node->entries.end(), entry);
+    if(it != node->entries.end() && !(entry < *it)){
+        // already indexed
+        node->latch.unlock();
+        return;
+    }
+    node->entries.insert(it, entry);
+    while(node->entries.size() > kBTreeNodeSize){
+        IndexEntry separator;
+        BTreeNode* right = split(node, separator);
+        if(node == root){
+            // the tree grows by one level, nobody else splits the latched root meanwhile
+            BTreeNode* new_root = new BTreeNode(false, node->level + 1);
+            new_root->entries.push_back(separator);
+            new_root->children.push_back(node);
+            new_root->children.push_back(right);
+            root = new_root;
+            break;
+        }
+        uint16_t level = node->level + 1;
+        node->latch.unlock();
+        // the parent seen on the way down, or the one the tree has grown since
+        BTreeNode* parent = path.size() > level && path[level] != NULL ? path[level] : descend(separator, level, NULL);
+        node = latchForChange(parent, separator);
+        size_t i = std::upper_bound(node->entries.begin(), node->entries.end(), separator) - node->entries.begin();
+        node->entries.insert(node->entries.begin() + i, separator);
+        node->children.insert(node->children.begin() + i + 1, right);
+    }
+    node->latch.unlock();
+}
+
+BTreeNode* BTreeIndex::split(BTreeNode* node, IndexEntry& separator){
+    BTreeNode* right = new BTreeNode(node->leaf, node->level);
+    size_t half = node->entries.size() / 2;
+    if(node->leaf){
+        right->entries.assign(node->entries.begin() + half, node->entries.end());
+        node->entries.resize(half);
+        separator = right->entries.front();
+    }
+    else{
+        // the middle separator moves up
+        separator = node->entries[half];
+        right->entries.assign(node->entries.begin() + half + 1, node->entries.end());
+        right->children.assign(node->children.begin() + half + 1, node->children.end());
+        node->entries.resize(half);
+        node->children.resize(half + 1);
+    }
+    // the right sibling takes over the high entry, so sessions arriving at node move on to it
+    right->next = node->next;
+    right->has_high = node->has_high;
+    right->high = node->high;
+    node->next = right;
+    node->has_high = true;
+    node->high = separator;
+    return right;
+}
+
+void BTreeIndex::erase(const std::string& key, Tuple tup){
+    IndexEntry entry(key, tup);
+    BTreeNode* node = latchForChange(descend(entry, 0, NULL), entry);
+    auto it = std::lower_bound(node->entries.begin(), node->entries.end(), entry);
+    if(it != node->entries.end() && !(entry < *it)){
+        node->entries.erase(it);
+    }
+    node->latch.unlock();
+}
+
+BTreeNode* BTreeIndex::findLeaf(IndexRange& range){
+    // skip the children whose entries are all below the range
+    auto below = [&range](const IndexEntry& entry){
+        return range.compare(entry.key) < 0;
+    };
+    BTreeNode* node = root;
+    node->latch.lock_shared();
+    while(true){
+        BTreeNode* next;
+        if(node->has_high && below(node->high)){
+            next = node->next;
+        }
+        else if(node->leaf){
+            return node;
+        }
+        else{
+            next = node->children[std::partition_point(node->entries.begin(), node->entries.end(), below) - node->entries.begin()];
+        }
+        node->latch.unlock_shared();
+        next->latch.lock_shared();
+        node = next;
+    }
+}
+
+// a leaf split while the scan is between leaves only moves entries the scan has already read
+template<typename Visit>
+void BTreeIndex::scanRange(IndexRange& range, Visit visit){
+    BTreeNode* node = findLeaf(range);
+    while(node != NULL){
+        BTreeNode* next = node->next;
+        for(auto& entry : node->entries){
+            int res = range.compare(entry.key);
+            if(res > 0){
+                next = NULL;
+                break;
+            }
+            if(res == 0){
+                visit(entry);
+            }
+        }
+        node->latch.unlock_shared();
+        if(next != NULL){
+            next->latch.lock_shared();
+        }
+        node = next;
+    }
+}
+
+void BTreeIndex::scan(IndexRange& range, std::vector<Tuple>& tuples){
+    scanRange(range, [&tuples](const IndexEntry& entry){
+        tuples.push_back(entry.tup);
+    });
+}
+
+void BTreeIndex::scanEntries(IndexRange& range, std::vector<IndexEntry>& entries){
+    scanRange(range, [&entries](const IndexEntry& entry){
+        entries.push_back(entry);
+    });
+}
+
+void BTreeIndex::dump(std::vector<IndexEntry>& entries){
+    IndexRange range;
+    scanEntries(range, entries);
+}
+
+}
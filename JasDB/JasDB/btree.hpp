@@ -0,0 +1,90 @@
+//
+//  btree.hpp
+//  JasDB
+//
+
+#ifndef btree_hpp
+#define btree_hpp
+
+#include <stdio.h>
+#include <atomic>
+#include <shared_mutex>
+#include "index_store.hpp"
+
+namespace jasdb{
+
+// most entries a node holds, a node with one more is split
+const uint32_t kBTreeNodeSize = 64;
+
+// Every node of a level links to its right sibling and knows the smallest entry the sibling may hold,
+// its high entry. A session which reaches a node after a split moved the entries it looks for
+// goes right instead of starting over.
+class BTreeNode {
+public:
+    bool leaf;
+    // 0 for leaves, the root has the highest level
+    uint16_t level;
+    // held shared to read the node and exclusive to change it, a session holds one node latch at a time
+    std::shared_mutex latch;
+    // entries of a leaf, or separators of an inner node: entries[i] is the smallest entry below children[i + 1]
+    std::vector<IndexEntry> entries;
+    std::vector<BTreeNode*> children;
+    // right sibling, NULL for the last node of a level. Leaves are chained in key order for range scans
+    BTreeNode* next;
+    // entries from high on are right of the node, the last node of a level has none
+    bool has_high;
+    IndexEntry high;
+    BTreeNode(bool leaf, uint16_t level) : leaf(leaf), level(level), next(NULL), has_high(false){}
+    ~BTreeNode(){
+        for(auto child : children){
+            delete child;
+        }
+    }
+    // entry belongs to a node on the right
+    bool beyond(const IndexEntry& entry){
+        return has_high && !(entry < high);
+    }
+};
+
+// B+tree kept in memory, in the way of a B-link tree (Lehman and Yao), so sessions don't serialize on it.
+// Readers latch one node at a time in shared mode and never hold a parent while they wait for a child.
+// Writers latch the leaf they change exclusively, a split links the new node from its left sibling
+// before the latch is released, and the separator is added to the parent afterwards, latching the
+// parent alone. Until then the new node is reached through its left sibling.
+// Nodes are never freed while the tree is used, they are not merged when entries are removed,
+// an empty leaf just stays in the chain until the next build. clear() and load() replace the whole
+// tree and run while no session uses the index, before it is built.
+class BTreeIndex : public IndexStore {
+public:
+    BTreeIndex(std::vector<ColumnDefinition*>* columns, std::vector<size_t>& col_ids);
+    ~BTreeIndex();
+    void scan(IndexRange& range, std::vector<Tuple>& tuples) override;
+    bool returnsEntries() override{
+        return true;
+    }
+    void scanEntries(IndexRange& range, std::vector<IndexEntry>& entries) override;
+protected:
+    void insert(const std::string& key, Tuple tup) override;
+    void erase(const std::string& key, Tuple tup) override;
+    void clear() override;
+    void load(std::vector<IndexEntry>& entries) override;
+    void dump(std::vector<IndexEntry>& entries) override;
+private:
+    std::atomic<BTreeNode*> root;
+    // the node of level where entry belongs, not latched. path gets the inner nodes passed on the way, by level
+    BTreeNode* descend(const IndexEntry& entry, uint16_t level, std::vector<BTreeNode*>* path);
+    // latch node exclusively and move right until entry belongs to the latched node
+    static BTreeNode* latchForChange(BTreeNode* node, const IndexEntry& entry);
+    // node is latched and has one entry too many, move the upper half into a new right sibling.
+    // The root gets a new parent right away, otherwise the separator still has to be added to the parent
+    BTreeNode* split(BTreeNode* node, IndexEntry& separator);
+    // the leaf which may hold the first entry inside range, latched shared
+    BTreeNode* findLeaf(IndexRange& range);
+    // call visit with every entry inside range in key order
+    template<typename Visit>
+    void scanRange(IndexRange& range, Visit visit);
+};
+
+}
+
+#endif /* btree_hpp */
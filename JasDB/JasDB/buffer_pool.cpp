@@ -0,0 +1,499 @@
+//
+//  buffer_pool.cpp
+//  JasDB
+//
+
+#include "buffer_pool.hpp"
+#include "log_manager.hpp"
+#include <iostream>
+#include <cstring>
+#include <cstdlib>
+#include <atomic>
+#include <algorithm>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/stat.h>
+#include <sys/mman.h>
+
+namespace jasdb{
+
+BufferPool global_buffer_pool(kDefaultBufferPoolSize);
+
+static std::atomic<uint32_t> next_file_id(0);
+
+PageFile::PageFile(std::string path) : path(path), fd(-1), page_count(0), map(NULL), map_size(0){
+    file_id = next_file_id++;
+}
+
+PageFile::~PageFile(){
+    close();
+}
+
+bool PageFile::open(bool truncate){
+    fd = ::open(path.c_str(), O_RDWR | O_CREAT | (truncate ? O_TRUNC : 0), 0644);
+    if(fd < 0){
+        std::cout << "Fail to open " << path << std::endl;
+        return true;
+    }
+    if(remap()){
+        return true;
+    }
+    page_count = static_cast<uint32_t>(map_size / kPageSize);
+    return false;
+}
+
+bool PageFile::remap(){
+    struct stat st;
+    if(fstat(fd, &st) != 0){
+        std::cout << "Fail to stat " << path << std::endl;
+        return true;
+    }
+    size_t size = static_cast<size_t>(st.st_size) / kPageSize * kPageSize;
+    if(map != NULL && size == map_size){
+        return false;
+    }
+    if(map != NULL){
+        munmap(map, map_size);
+        map = NULL;
+        map_size = 0;
+    }
+    if(size == 0){
+        return false;
+    }
+    void* addr = mmap(NULL, size, PROT_READ, MAP_SHARED, fd, 0);
+    if(addr == MAP_FAILED){
+        std::cout << "Fail to map " << path << std::endl;
+        return true;
+    }
+    map = static_cast<char*>(addr);
+    map_size = size;
+    return false;
+}
+
+void PageFile::close(){
+    std::unique_lock<std::shared_mutex> guard(map_latch);
+    if(map != NULL){
+        munmap(map, map_size);
+        map = NULL;
+        map_size = 0;
+    }
+    if(fd >= 0){
+        ::close(fd);
+        fd = -1;
+    }
+}
+
+bool PageFile::readPage(uint32_t page_id, char* buf){
+    size_t offset = static_cast<size_t>(page_id) * kPageSize;
+    {
+        std::shared_lock<std::shared_mutex> guard(map_latch);
+        if(offset + kPageSize <= map_size){
+            memcpy(buf, map + offset, kPageSize);
+            return false;
+        }
+    }
+    // pages appended since the file was mapped need a bigger mapping
+    std::unique_lock<std::shared_mutex> guard(map_latch);
+    if(offset + kPageSize > map_size && remap()){
+        return true;
+    }
+    if(offset + kPageSize <= map_size){
+        memcpy(buf, map + offset, kPageSize);
+        return false;
+    }
+    // a page which was allocated but never written back reads as zero
+    memset(buf, 0, kPageSize);
+    return false;
+}
+
+bool PageFile::writePage(uint32_t page_id, const char* buf){
+    off_t offset = static_cast<off_t>(page_id) * kPageSize;
+    if(pwrite(fd, buf, kPageSize, offset) != static_cast<ssize_t>(kPageSize)){
+        std::cout << "Fail to write page " << page_id << " of " << path << std::endl;
+        return true;
+    }
+    return false;
+}
+
+bool PageFile::sync(){
+    if(fd >= 0 && fsync(fd) != 0){
+        std::cout << "Fail to sync " << path << std::endl;
+        return true;
+    }
+    return false;
+}
+
+bool PageFile::syncPath(std::string path){
+    int fd = ::open(path.c_str(), O_RDONLY);
+    if(fd < 0 || fsync(fd) != 0){
+        std::cout << "Fail to sync " << path << std::endl;
+        if(fd >= 0){
+            ::close(fd);
+        }
+        return true;
+    }
+    ::close(fd);
+    return false;
+}
+
+void PageFile::remove(){
+    close();
+    unlink(path.c_str());
+    page_count = 0;
+}
+
+BufferPool::BufferPool(size_t memory_budget) : clock_hand(0){
+    allocateFrames(memory_budget / kPageSize);
+}
+
+BufferPool::~BufferPool(){
+    flushAll();
+    releaseFrames();
+}
+
+void BufferPool::allocateFrames(size_t count){
+    if(count < kScanRingSize * 2){
+        count = kScanRingSize * 2;
+    }
+    frames.resize(count);
+    for(size_t i=0;i<count;i++){
+        frames[i].data = static_cast<char*>(aligned_alloc(kPageSize, kPageSize));
+        free_frames.push_back(count - i - 1);
+    }
+}
+
+void BufferPool::releaseFrames(){
+    for(auto& frame : frames){
+        free(frame.data);
+    }
+    frames.clear();
+    free_frames.clear();
+    page_table.clear();
+    clock_hand = 0;
+}
+
+bool BufferPool::setMemoryBudget(size_t memory_budget){
+    std::unique_lock<std::mutex> lock(latch);
+    for(size_t i=0;i<frames.size();i++){
+        if(writeBack(lock, i)){
+            return true;
+        }
+    }
+    // the latch was released for the writes, check the pins afterwards
+    for(auto& frame : frames){
+        if(frame.pin_count > 0 || frame.writing || frame.dirty){
+            std::cout << "Can not resize buffer pool while pages are pinned." << std::endl;
+            return true;
+        }
+    }
+    releaseFrames();
+    allocateFrames(memory_budget / kPageSize);
+    return false;
+}
+
+size_t BufferPool::clockSweep(){
+    // every frame may need several passes to drop its usage count to zero
+    for(size_t n=0;n<frames.size() * (kMaxUsageCount + 1);n++){
+        size_t frame_id = clock_hand;
+        clock_hand = (clock_hand + 1) % frames.size();
+        Frame& frame = frames[frame_id];
+        if(frame.pin_count > 0 || frame.writing){
+            continue;
+        }
+        if(frame.usage_count > 0){
+            frame.usage_count--;
+            continue;
+        }
+        return frame_id;
+    }
+    return SIZE_MAX;
+}
+
+size_t BufferPool::getVictim(ScanRing* ring){
+    if(!free_frames.empty()){
+        size_t frame_id = free_frames.back();
+        free_frames.pop_back();
+        if(ring != NULL && ring->frames.size() < kScanRingSize){
+            ring->frames.push_back(frame_id);
+        }
+        return frame_id;
+    }
+    if(ring != NULL && !ring->frames.empty() && ring->frames.back() >= frames.size()){
+        // the pool was resized since this ring was filled
+        ring->frames.clear();
+        ring->next = 0;
+    }
+    if(ring != NULL && ring->frames.size() == kScanRingSize){
+        // reuse the next frame of the ring, unless someone else started using that page
+        size_t frame_id = ring->frames[ring->next];
+        Frame& frame = frames[frame_id];
+        if(frame.pin_count == 0 && !frame.writing && frame.usage_count <= 1){
+            ring->next = (ring->next + 1) % kScanRingSize;
+            return frame_id;
+        }
+        size_t victim = clockSweep();
+        if(victim != SIZE_MAX){
+            ring->frames[ring->next] = victim;
+            ring->next = (ring->next + 1) % kScanRingSize;
+        }
+        return victim;
+    }
+    size_t victim = clockSweep();
+    if(ring != NULL && victim != SIZE_MAX){
+        ring->frames.push_back(victim);
+    }
+    return victim;
+}
+
+bool BufferPool::writeBack(std::unique_lock<std::mutex>& lock, size_t frame_id){
+    Frame& frame = frames[frame_id];
+    // another session may be writing the page already, its copy can be older than the page
+    io_done.wait(lock, [&frame]{
+        return !frame.writing;
+    });
+    if(frame.file == NULL || !frame.dirty){
+        return false;
+    }
+    PageFile* file = frame.file;
+    uint32_t page_id = frame.page_id;
+    uint64_t changes = frame.changes;
+    // the frame stays dirty with its rec_lsn until the write is done, so checkpoints keep seeing it
+    std::vector<char> copy(frame.data, frame.data + kPageSize);
+    frame.writing = true;
+    lock.unlock();
+    uint64_t lsn;
+    memcpy(&lsn, copy.data(), sizeof(lsn));
+    // write ahead: the log has to reach the disk before the page it describes
+    bool failed = global_log_manager.flush(lsn) || file->writePage(page_id, copy.data());
+    lock.lock();
+    frame.writing = false;
+    if(!failed && frame.file == file && frame.page_id == page_id && frame.changes == changes){
+        frame.dirty = false;
+        frame.rec_lsn = 0;
+    }
+    io_done.notify_all();
+    return failed;
+}
+
+bool BufferPool::takeFrame(std::unique_lock<std::mutex>& lock, ScanRing* ring, size_t* frame_id){
+    while(true){
+        *frame_id = getVictim(ring);
+        if(*frame_id == SIZE_MAX){
+            return false;
+        }
+        Frame& frame = frames[*frame_id];
+        if(frame.file != NULL && frame.dirty){
+            if(writeBack(lock, *frame_id)){
+                return true;
+            }
+            // the page may have been pinned or changed while the latch was released, look again
+            continue;
+        }
+        if(frame.file != NULL){
+            page_table.erase(pageKey(frame.file, frame.page_id));
+            frame.file = NULL;
+        }
+        return false;
+    }
+}
+
+char* BufferPool::fetchPage(PageFile* file, uint32_t page_id, ScanRing* ring){
+    std::unique_lock<std::mutex> lock(latch);
+    size_t frame_id;
+    while(true){
+        auto it = page_table.find(pageKey(file, page_id));
+        if(it != page_table.end()){
+            Frame& frame = frames[it->second];
+            if(frame.reading){
+                // the frame may be given up if the read fails, look the page up again
+                io_done.wait(lock);
+                continue;
+            }
+            if(frame.pin_count++ == 0){
+                frame.pin_lsn = global_log_manager.currentLsn();
+            }
+            // pages touched by a scan ring only count once
+            if(frame.usage_count < (ring != NULL ? 1 : kMaxUsageCount)){
+                frame.usage_count++;
+            }
+            return frame.data;
+        }
+        if(page_id >= file->page_count){
+            return NULL;
+        }
+        if(takeFrame(lock, ring, &frame_id)){
+            return NULL;
+        }
+        if(frame_id == SIZE_MAX){
+            std::cout << "Buffer pool is full, all pages are pinned." << std::endl;
+            return NULL;
+        }
+        // another session may have read the page while a victim was written back
+        if(page_table.find(pageKey(file, page_id)) == page_table.end()){
+            break;
+        }
+        free_frames.push_back(frame_id);
+    }
+    Frame& frame = frames[frame_id];
+    frame.file = file;
+    frame.page_id = page_id;
+    frame.pin_count = 1;
+    frame.pin_lsn = global_log_manager.currentLsn();
+    frame.dirty = false;
+    frame.rec_lsn = 0;
+    frame.usage_count = ring != NULL ? 0 : 1;
+    frame.reading = true;
+    page_table[pageKey(file, page_id)] = frame_id;
+    // the copy out of the mapping may fault the page in from disk, other sessions go on meanwhile
+    lock.unlock();
+    bool failed = file->readPage(page_id, frame.data);
+    lock.lock();
+    frame.reading = false;
+    if(failed){
+        page_table.erase(pageKey(file, page_id));
+        frame.file = NULL;
+        frame.pin_count = 0;
+        free_frames.push_back(frame_id);
+    }
+    io_done.notify_all();
+    return failed ? NULL : frame.data;
+}
+
+char* BufferPool::newPage(PageFile* file, uint32_t* page_id){
+    std::unique_lock<std::mutex> lock(latch);
+    size_t frame_id;
+    if(takeFrame(lock, NULL, &frame_id)){
+        return NULL;
+    }
+    if(frame_id == SIZE_MAX){
+        std::cout << "Buffer pool is full, all pages are pinned." << std::endl;
+        return NULL;
+    }
+    Frame& frame = frames[frame_id];
+    *page_id = file->page_count++;
+    memset(frame.data, 0, kPageSize);
+    frame.file = file;
+    frame.page_id = *page_id;
+    frame.pin_count = 1;
+    frame.pin_lsn = global_log_manager.currentLsn();
+    // a new page only exists in memory, it has to be written back, every change of it comes after pin_lsn
+    frame.dirty = true;
+    frame.changes++;
+    frame.rec_lsn = frame.pin_lsn;
+    frame.usage_count = 1;
+    page_table[pageKey(file, *page_id)] = frame_id;
+    return frame.data;
+}
+
+void BufferPool::unpinPage(PageFile* file, uint32_t page_id, bool dirty){
+    std::lock_guard<std::mutex> guard(latch);
+    auto it = page_table.find(pageKey(file, page_id));
+    if(it == page_table.end()){
+        return;
+    }
+    Frame& frame = frames[it->second];
+    if(frame.pin_count > 0){
+        frame.pin_count--;
+    }
+    // the page LSN is the last change, an insert of many rows logs several under one pin.
+    // all of them come after the pin, so a clean frame is dirty since pin_lsn
+    if(dirty && !frame.dirty){
+        frame.rec_lsn = frame.pin_lsn;
+    }
+    frame.dirty = frame.dirty || dirty;
+    if(dirty){
+        frame.changes++;
+    }
+}
+
+void BufferPool::markDirty(PageFile* file, uint32_t page_id){
+    std::lock_guard<std::mutex> guard(latch);
+    auto it = page_table.find(pageKey(file, page_id));
+    if(it == page_table.end()){
+        return;
+    }
+    Frame& frame = frames[it->second];
+    // the page is still pinned, the change was made under the pin
+    if(!frame.dirty){
+        frame.rec_lsn = frame.pin_lsn;
+    }
+    frame.dirty = true;
+    frame.changes++;
+}
+
+bool BufferPool::flushFile(PageFile* file){
+    std::unique_lock<std::mutex> lock(latch);
+    for(size_t i=0;i<frames.size();i++){
+        if(frames[i].file == file && writeBack(lock, i)){
+            return true;
+        }
+    }
+    lock.unlock();
+    return file->sync();
+}
+
+bool BufferPool::checkpointFile(PageFile* file){
+    std::unique_lock<std::mutex> lock(latch);
+    for(size_t i=0;i<frames.size();i++){
+        Frame& frame = frames[i];
+        // a pinned page may be in the middle of a change, minRecLsn still reports it
+        if(frame.file == file && frame.pin_count == 0 && writeBack(lock, i)){
+            return true;
+        }
+    }
+    lock.unlock();
+    return file->sync();
+}
+
+uint64_t BufferPool::minRecLsn(PageFile* file){
+    std::lock_guard<std::mutex> guard(latch);
+    uint64_t lsn = UINT64_MAX;
+    for(auto& frame : frames){
+        if(frame.file != file){
+            continue;
+        }
+        if(frame.dirty){
+            lsn = std::min(lsn, frame.rec_lsn);
+        }
+        if(frame.pin_count > 0){
+            lsn = std::min(lsn, frame.pin_lsn);
+        }
+    }
+    return lsn;
+}
+
+bool BufferPool::flushAll(){
+    std::unique_lock<std::mutex> lock(latch);
+    for(size_t i=0;i<frames.size();i++){
+        if(writeBack(lock, i)){
+            return true;
+        }
+    }
+    return false;
+}
+
+void BufferPool::discardFile(PageFile* file){
+    std::unique_lock<std::mutex> lock(latch);
+    // reads and write backs of the file have to finish before the file goes away
+    io_done.wait(lock, [this, file]{
+        for(auto& frame : frames){
+            if(frame.file == file && (frame.reading || frame.writing)){
+                return false;
+            }
+        }
+        return true;
+    });
+    for(size_t i=0;i<frames.size();i++){
+        Frame& frame = frames[i];
+        if(frame.file == file){
+            page_table.erase(pageKey(file, frame.page_id));
+            frame.file = NULL;
+            frame.dirty = false;
+            frame.pin_count = 0;
+            frame.usage_count = 0;
+            free_frames.push_back(i);
+        }
+    }
+}
+
+}
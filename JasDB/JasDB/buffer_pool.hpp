@@ -0,0 +1,140 @@
+//
+//  buffer_pool.hpp
+//  JasDB
+//
+
+#ifndef buffer_pool_hpp
+#define buffer_pool_hpp
+
+#include <stdio.h>
+#include <stdint.h>
+#include <string>
+#include <vector>
+#include <unordered_map>
+#include <mutex>
+#include <shared_mutex>
+#include <condition_variable>
+#include "table_store.hpp"
+
+namespace jasdb{
+
+const size_t kDefaultBufferPoolSize = 64 * 1024 * 1024;
+// number of frames a sequential scan of a big table may recycle
+const size_t kScanRingSize = 32;
+const uint8_t kMaxUsageCount = 5;
+
+// A file made of kPageSize pages, page i lives at offset i * kPageSize.
+// The file is mapped read only, so a page missing in the buffer pool is copied
+// straight out of the OS page cache, and opening a file costs the same whatever its size.
+// Writes still go through pwrite, the buffer pool decides when a page reaches the file.
+// Pages are read by several sessions at once, a new mapping waits until the reads of the old one are done.
+class PageFile {
+public:
+    std::string path;
+    int fd;
+    uint32_t file_id;
+    uint32_t page_count;
+    char* map;
+    size_t map_size;
+    std::shared_mutex map_latch;
+    PageFile(std::string path);
+    ~PageFile();
+    bool open(bool truncate);
+    void close();
+    bool remap();
+    bool readPage(uint32_t page_id, char* buf);
+    bool writePage(uint32_t page_id, const char* buf);
+    bool sync();
+    void remove();
+    // fsync any file, e.g. one written with an ofstream before it is renamed
+    static bool syncPath(std::string path);
+};
+
+class Frame {
+public:
+    char* data;
+    PageFile* file;
+    uint32_t page_id;
+    int pin_count;
+    bool dirty;
+    uint8_t usage_count;
+    // LSN before the first change since the page was last written, set while the frame is dirty
+    uint64_t rec_lsn;
+    // LSN when the page was pinned, changes made under the pin come after it
+    uint64_t pin_lsn;
+    // the page is being read into the frame, it can't be used before the read is done
+    bool reading;
+    // a copy of the page is being written back, the frame is no victim until the write is done
+    bool writing;
+    // counts the changes reported for the page, a write back only cleans the frame when none came meanwhile
+    uint64_t changes;
+    Frame() : data(NULL), file(NULL), page_id(0), pin_count(0), dirty(false), usage_count(0), rec_lsn(0), pin_lsn(0),
+        reading(false), writing(false), changes(0){}
+};
+
+// Small set of frames a large sequential scan keeps reusing,
+// so one full scan cannot push the hot pages out of the pool.
+class ScanRing {
+public:
+    std::vector<size_t> frames;
+    size_t next;
+    ScanRing() : next(0){}
+};
+
+// Caches pages of all PageFiles in a fixed number of frames.
+// Every page starts with the LSN of its last change, a dirty page is only written
+// after the log is durable up to that LSN.
+// A page returned by fetchPage/newPage stays pinned until unpinPage is called.
+// Victims are found with a clock sweep over usage counts.
+// Dirty pages are written back without the latch: the page is copied, the log is flushed and the copy
+// written while other sessions keep using the pool, then the latch is taken again to clean the frame.
+// A missing page is read the same way, its frame is reserved in the page table first so a second
+// session asking for the page waits for the read instead of reading it again.
+class BufferPool {
+public:
+    BufferPool(size_t memory_budget);
+    ~BufferPool();
+    bool setMemoryBudget(size_t memory_budget);
+    size_t frameCount(){
+        return frames.size();
+    }
+    char* fetchPage(PageFile* file, uint32_t page_id, ScanRing* ring = NULL);
+    char* newPage(PageFile* file, uint32_t* page_id);
+    void unpinPage(PageFile* file, uint32_t page_id, bool dirty);
+    // the page stays pinned but was changed
+    void markDirty(PageFile* file, uint32_t page_id);
+    bool flushFile(PageFile* file);
+    // write the dirty pages of file one at a time, pages in use are skipped
+    bool checkpointFile(PageFile* file);
+    // lowest LSN of a change of file which may not be written yet, UINT64_MAX if there is none
+    uint64_t minRecLsn(PageFile* file);
+    bool flushAll();
+    // forget every page of file without writing it back
+    void discardFile(PageFile* file);
+private:
+    std::mutex latch;
+    // signalled when a read or a write back finishes
+    std::condition_variable io_done;
+    std::vector<Frame> frames;
+    std::unordered_map<uint64_t, size_t> page_table;
+    std::vector<size_t> free_frames;
+    size_t clock_hand;
+    static uint64_t pageKey(PageFile* file, uint32_t page_id){
+        return (static_cast<uint64_t>(file->file_id) << 32) | page_id;
+    }
+    void allocateFrames(size_t count);
+    void releaseFrames();
+    size_t getVictim(ScanRing* ring);
+    size_t clockSweep();
+    // an unpinned frame which holds no page anymore, dirty victims are written back first.
+    // frame_id is SIZE_MAX when every frame is pinned. The latch is released while a victim is written
+    bool takeFrame(std::unique_lock<std::mutex>& lock, ScanRing* ring, size_t* frame_id);
+    // write a dirty frame back, releasing the latch while the log is flushed and the page written
+    bool writeBack(std::unique_lock<std::mutex>& lock, size_t frame_id);
+};
+
+extern BufferPool global_buffer_pool;
+
+}
+
+#endif /* buffer_pool_hpp */
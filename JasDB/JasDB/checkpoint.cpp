@@ -0,0 +1,135 @@
+//
+//  checkpoint.cpp
+//  JasDB
+//
+
+#include "checkpoint.hpp"
+#include "metadata.hpp"
+#include "log_manager.hpp"
+#include "buffer_pool.hpp"
+#include <iostream>
+#include <fstream>
+#include <chrono>
+#include <algorithm>
+#include <vector>
+#include <cstdio>
+
+namespace jasdb{
+
+Checkpointer global_checkpointer;
+
+void Checkpointer::start(){
+    std::lock_guard<std::mutex> guard(latch);
+    if(running){
+        return;
+    }
+    running = true;
+    last_lsn = global_log_manager.currentLsn();
+    worker = std::thread(&Checkpointer::run, this);
+}
+
+void Checkpointer::stop(){
+    {
+        std::lock_guard<std::mutex> guard(latch);
+        if(!running){
+            return;
+        }
+        running = false;
+    }
+    cond.notify_all();
+    worker.join();
+}
+
+void Checkpointer::run(){
+    auto last_time = std::chrono::steady_clock::now();
+    std::unique_lock<std::mutex> lock(latch);
+    while(running){
+        cond.wait_for(lock, std::chrono::seconds(1));
+        if(!running){
+            break;
+        }
+        uint64_t lsn = global_log_manager.currentLsn();
+        bool timeout = std::chrono::steady_clock::now() - last_time >= std::chrono::seconds(kCheckpointInterval);
+        if(lsn - last_lsn >= kCheckpointLogSize || (timeout && lsn != last_lsn)){
+            lock.unlock();
+            checkpoint();
+            lock.lock();
+            last_time = std::chrono::steady_clock::now();
+        }
+    }
+}
+
+bool Checkpointer::checkpoint(){
+    std::lock_guard<std::mutex> checkpoint_guard(checkpoint_latch);
+    // every change before begin_lsn is either written back now or reported by recLsn()
+    uint64_t begin_lsn = global_log_manager.currentLsn();
+    uint64_t redo_lsn = begin_lsn;
+    // a table created from now on only has changes after begin_lsn
+    std::vector<std::pair<std::string, TableStore*>> tables;
+    {
+        std::lock_guard<std::mutex> guard(global_meta_data.latch);
+        for(auto it : global_meta_data.map_of_table){
+            tables.push_back(std::make_pair(it.first, it.second->table_store));
+        }
+    }
+    for(auto& table : tables){
+        {
+            std::lock_guard<std::mutex> guard(global_meta_data.latch);
+            auto it = global_meta_data.map_of_table.find(table.first);
+            if(it == global_meta_data.map_of_table.end() || it->second->table_store != table.second){
+                // dropped meanwhile
+                continue;
+            }
+            std::lock_guard<std::mutex> store_guard(store_latch);
+            current_store = table.second;
+        }
+        bool res = table.second->checkpoint();
+        uint64_t rec_lsn = table.second->recLsn();
+        {
+            std::lock_guard<std::mutex> store_guard(store_latch);
+            current_store = NULL;
+        }
+        store_cond.notify_all();
+        if(res){
+            return true;
+        }
+        redo_lsn = std::min(redo_lsn, rec_lsn);
+    }
+    if(writeRedoLsn(global_meta_data.data_dir, redo_lsn)){
+        return true;
+    }
+    last_lsn = begin_lsn;
+    // unfinished transactions may still need their records to roll back after a crash
+    return global_log_manager.truncate(std::min(redo_lsn, global_log_manager.oldestTxnLsn()));
+}
+
+void Checkpointer::forget(TableStore* store){
+    std::unique_lock<std::mutex> lock(store_latch);
+    store_cond.wait(lock, [this, store]{
+        return current_store != store;
+    });
+}
+
+uint64_t Checkpointer::readRedoLsn(std::string dir){
+    std::ifstream in(dir + "/checkpoint");
+    uint64_t lsn = 0;
+    if(in.is_open()){
+        in >> lsn;
+    }
+    return lsn;
+}
+
+bool Checkpointer::writeRedoLsn(std::string dir, uint64_t lsn){
+    std::string path = dir + "/checkpoint";
+    std::string tmp_path = path + ".tmp";
+    std::ofstream out(tmp_path, std::ios::trunc);
+    out << lsn << std::endl;
+    out.close();
+    if(!out.good() || PageFile::syncPath(tmp_path) || rename(tmp_path.c_str(), path.c_str()) != 0){
+        std::cout << "Fail to write " << path << std::endl;
+        return true;
+    }
+    return false;
+}
+
+}
@@ -0,0 +1,65 @@
+//
+//  checkpoint.hpp
+//  JasDB
+//
+
+#ifndef checkpoint_hpp
+#define checkpoint_hpp
+
+#include <stdio.h>
+#include <stdint.h>
+#include <string>
+#include <thread>
+#include <mutex>
+#include <atomic>
+#include <condition_variable>
+
+namespace jasdb{
+
+class TableStore;
+
+// a checkpoint is taken after this many seconds, or earlier after kCheckpointLogSize bytes of log
+const int kCheckpointInterval = 30;
+const uint64_t kCheckpointLogSize = 64 * 1024 * 1024;
+
+// Fuzzy checkpoints: tables are written back while sessions keep changing them.
+// Afterwards recovery only has to redo the log from the lowest LSN that may still be missing
+// in a table file, so the log before it (and before every running transaction) is deleted.
+// That keeps the work of a restart bounded by kCheckpointLogSize.
+class Checkpointer {
+public:
+    Checkpointer() : running(false), last_lsn(0), current_store(NULL){}
+    ~Checkpointer(){
+        stop();
+    }
+    // take checkpoints in a background thread
+    void start();
+    void stop();
+    bool checkpoint();
+    // called by DROP before it frees store, waits while a checkpoint writes the store back
+    void forget(TableStore* store);
+    // redo starts at this LSN, 0 when there was no checkpoint yet
+    static uint64_t readRedoLsn(std::string dir);
+private:
+    std::thread worker;
+    std::mutex latch;
+    std::condition_variable cond;
+    bool running;
+    // one checkpoint at a time
+    std::mutex checkpoint_latch;
+    // set by every checkpoint, also the ones called from outside while run() reads it
+    std::atomic<uint64_t> last_lsn;
+    // the store a checkpoint writes back. The catalog latch is only held to look a table up,
+    // so CREATE and DROP don't wait for the writes
+    std::mutex store_latch;
+    std::condition_variable store_cond;
+    TableStore* current_store;
+    void run();
+    static bool writeRedoLsn(std::string dir, uint64_t lsn);
+};
+
+extern Checkpointer global_checkpointer;
+
+}
+
+#endif /* checkpoint_hpp */
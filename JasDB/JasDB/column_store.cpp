@@ -0,0 +1,858 @@
+//
+//  column_store.cpp
+//  JasDB
+//
+
+#include "column_store.hpp"
+#include "transaction.hpp"
+#include "buffer_pool.hpp"
+#include <iostream>
+#include <cstring>
+#include <fstream>
+#include <sstream>
+#include <algorithm>
+#include <cstdio>
+
+using namespace hsql;
+
+namespace jasdb{
+
+ColumnChunk::ColumnChunk(uint32_t w, bool dictionary) : width(w), dict_encoded(dictionary){
+    nulls.reserve(kRowGroupSize);
+    if(dict_encoded){
+        codes.reserve(kRowGroupSize);
+        // code 0 is the empty value, NULL rows use it
+        std::string empty(sizeof(uint16_t), '\0');
+        dict.push_back(empty);
+        dict_index[empty] = 0;
+    }
+    else{
+        data.reserve(static_cast<size_t>(width) * kRowGroupSize);
+    }
+}
+
+void ColumnChunk::append(){
+    nulls.push_back(1);
+    if(dict_encoded){
+        codes.push_back(0);
+    }
+    else{
+        data.resize(data.size() + width, 0);
+    }
+}
+
+void ColumnChunk::set(uint32_t row, const char* value){
+    if(!dict_encoded){
+        memcpy(data.data() + static_cast<size_t>(row) * width, value, width);
+        return;
+    }
+    std::string key = dictKey(value);
+    auto it = dict_index.find(key);
+    if(it != dict_index.end()){
+        codes[row] = it->second;
+        return;
+    }
+    if(dict.size() >= kMaxDictionarySize){
+        // too many distinct values, a dictionary doesn't pay off for this chunk
+        toPlain();
+        set(row, value);
+        return;
+    }
+    uint16_t code = static_cast<uint16_t>(dict.size());
+    dict.push_back(key);
+    dict_index[key] = code;
+    codes[row] = code;
+}
+
+void ColumnChunk::get(uint32_t row, char* dst){
+    if(!dict_encoded){
+        memcpy(dst, data.data() + static_cast<size_t>(row) * width, width);
+        return;
+    }
+    const std::string& value = dict[codes[row]];
+    memset(dst, 0, width);
+    memcpy(dst, value.data(), value.size());
+}
+
+int32_t ColumnChunk::lookup(const char* value){
+    auto it = dict_index.find(dictKey(value));
+    if(it == dict_index.end()){
+        return -1;
+    }
+    return it->second;
+}
+
+void ColumnChunk::toPlain(){
+    data.assign(static_cast<size_t>(width) * codes.size(), 0);
+    for(size_t row=0;row<codes.size();row++){
+        const std::string& value = dict[codes[row]];
+        memcpy(data.data() + row * width, value.data(), value.size());
+    }
+    dict_encoded = false;
+    std::vector<uint16_t>().swap(codes);
+    std::vector<std::string>().swap(dict);
+    std::unordered_map<std::string, uint16_t>().swap(dict_index);
+}
+
+// nulls, encoding flag, then either the plain values
+// or the dictionary size, the dictionary values with their length and the codes
+bool ColumnChunk::write(std::ostream& out){
+    out.write(reinterpret_cast<const char*>(nulls.data()), nulls.size());
+    uint8_t flag = dict_encoded ? 1 : 0;
+    out.write(reinterpret_cast<const char*>(&flag), sizeof(flag));
+    if(!dict_encoded){
+        out.write(data.data(), data.size());
+        return !out.good();
+    }
+    uint32_t dict_size = static_cast<uint32_t>(dict.size());
+    out.write(reinterpret_cast<const char*>(&dict_size), sizeof(dict_size));
+    for(auto& value : dict){
+        out.write(value.data(), value.size());
+    }
+    out.write(reinterpret_cast<const char*>(codes.data()), codes.size() * sizeof(uint16_t));
+    return !out.good();
+}
+
+bool ColumnChunk::read(std::istream& in, uint32_t row_count){
+    nulls.resize(row_count);
+    in.read(reinterpret_cast<char*>(nulls.data()), nulls.size());
+    uint8_t flag = 0;
+    in.read(reinterpret_cast<char*>(&flag), sizeof(flag));
+    dict_encoded = flag != 0;
+    dict.clear();
+    dict_index.clear();
+    if(!dict_encoded){
+        data.resize(static_cast<size_t>(width) * row_count);
+        in.read(data.data(), data.size());
+        return !in.good();
+    }
+    uint32_t dict_size = 0;
+    in.read(reinterpret_cast<char*>(&dict_size), sizeof(dict_size));
+    for(uint32_t i=0;i<dict_size && in.good();i++){
+        uint16_t len = 0;
+        in.read(reinterpret_cast<char*>(&len), sizeof(len));
+        std::string value(sizeof(len) + len, '\0');
+        memcpy(&value[0], &len, sizeof(len));
+        in.read(&value[sizeof(len)], len);
+        dict_index[value] = static_cast<uint16_t>(dict.size());
+        dict.push_back(value);
+    }
+    codes.resize(row_count);
+    in.read(reinterpret_cast<char*>(codes.data()), codes.size() * sizeof(uint16_t));
+    return !in.good();
+}
+
+RowGroup::RowGroup(std::vector<ColumnDefinition*>* columns){
+    row_count = 0;
+    live_count = 0;
+    dirty = true;
+    deleted.words.reserve(kRowGroupSize / 64);
+    for(auto col_def : *columns){
+        bool dictionary = col_def->type.data_type == DataType::CHAR || col_def->type.data_type == DataType::VARCHAR;
+        chunks.push_back(new ColumnChunk(TupleLayout::columnWidth(col_def), dictionary));
+    }
+    zones.assign(columns->size(), ZoneMap(kRowGroupBloomBits));
+}
+
+RowGroup::~RowGroup(){
+    for(auto chunk : chunks){
+        delete chunk;
+    }
+}
+
+ColumnStore::ColumnStore(std::vector<ColumnDefinition*>* columns, std::string path, bool create) : TableStore(columns), path(path), layout(columns){
+    loaded = create;
+    dirty = create;
+    lsn = 0;
+    rec_lsn = 0;
+    flush_rec_lsn = 0;
+}
+
+ColumnStore::~ColumnStore(){
+    for(auto group : row_groups){
+        delete group;
+    }
+}
+
+// see writeFile and writeGroup for the layout of the file
+bool ColumnStore::load(){
+    if(loaded){
+        return false;
+    }
+    std::lock_guard<std::recursive_mutex> guard(latch);
+    if(loaded){
+        return false;
+    }
+    std::ifstream in(path, std::ios::binary);
+    if(!in.is_open()){
+        loaded = true;
+        return false;
+    }
+    uint32_t group_count = 0;
+    in.read(reinterpret_cast<char*>(&lsn), sizeof(lsn));
+    in.read(reinterpret_cast<char*>(&group_count), sizeof(group_count));
+    for(uint32_t g=0;g<group_count && in.good();g++){
+        RowGroup* group = new RowGroup(columns);
+        uint64_t offset = static_cast<uint64_t>(in.tellg());
+        in.read(reinterpret_cast<char*>(&group->row_count), sizeof(group->row_count));
+        group->deleted.resize(group->row_count);
+        in.read(reinterpret_cast<char*>(group->deleted.words.data()), group->deleted.words.size() * sizeof(uint64_t));
+        group->live_count = 0;
+        for(uint32_t row=0;row<group->row_count;row++){
+            group->live_count += group->deleted.test(row) ? 0 : 1;
+        }
+        for(auto chunk : group->chunks){
+            chunk->read(in, group->row_count);
+        }
+        group->dirty = false;
+        file_groups.push_back(std::make_pair(offset, static_cast<uint64_t>(in.tellg()) - offset));
+        // zone maps are not stored, the chunks are in memory anyway
+        for(size_t i=0;i<group->chunks.size() && in.good();i++){
+            ColumnChunk* chunk = group->chunks[i];
+            std::vector<char> field(chunk->width);
+            for(uint32_t row=0;row<group->row_count;row++){
+                if(!group->deleted.test(row)){
+                    chunk->get(row, field.data());
+                    group->zones[i].add((*columns)[i], field.data(), chunk->nulls[row]);
+                }
+            }
+        }
+        row_groups.push_back(group);
+    }
+    if(!in.good()){
+        // only a complete store may be used or flushed, the next use reads the file again
+        std::cout << "Fail to load " << path << std::endl;
+        for(auto group : row_groups){
+            delete group;
+        }
+        row_groups.clear();
+        file_groups.clear();
+        lsn = 0;
+        return true;
+    }
+    loaded = true;
+    return false;
+}
+
+void ColumnStore::writeGroup(RowGroup* group, std::ostream& out){
+    out.write(reinterpret_cast<const char*>(&group->row_count), sizeof(group->row_count));
+    out.write(reinterpret_cast<const char*>(group->deleted.words.data()), group->deleted.words.size() * sizeof(uint64_t));
+    for(auto chunk : group->chunks){
+        chunk->write(out);
+    }
+}
+
+bool ColumnStore::flush(){
+    std::lock_guard<std::mutex> flush_guard(flush_latch);
+    uint64_t file_lsn = 0;
+    std::vector<std::string> groups;
+    std::vector<uint32_t> written;
+    {
+        std::lock_guard<std::recursive_mutex> guard(latch);
+        if(!loaded || !dirty){
+            return false;
+        }
+        // a serialized group is never empty, it starts with its row count
+        groups.resize(row_groups.size());
+        for(uint32_t g=0;g<row_groups.size();g++){
+            RowGroup* group = row_groups[g];
+            if(group->dirty || g >= file_groups.size()){
+                std::ostringstream out;
+                writeGroup(group, out);
+                groups[g] = out.str();
+                group->dirty = false;
+                written.push_back(g);
+            }
+        }
+        file_lsn = lsn;
+        flush_rec_lsn = rec_lsn;
+        rec_lsn = 0;
+        dirty = false;
+    }
+    std::vector<std::pair<uint64_t, uint64_t>> extents;
+    bool res = writeFile(file_lsn, groups, extents);
+    std::lock_guard<std::recursive_mutex> guard(latch);
+    if(res){
+        // the next flush tries again
+        for(auto g : written){
+            row_groups[g]->dirty = true;
+        }
+        if(flush_rec_lsn != 0 && (rec_lsn == 0 || flush_rec_lsn < rec_lsn)){
+            rec_lsn = flush_rec_lsn;
+        }
+        dirty = true;
+    }
+    else{
+        file_groups.swap(extents);
+    }
+    flush_rec_lsn = 0;
+    return res;
+}
+
+// file layout: LSN of the last change, group count, then every group
+bool ColumnStore::writeFile(uint64_t file_lsn, std::vector<std::string>& groups, std::vector<std::pair<uint64_t, uint64_t>>& extents){
+    // write ahead: the file must not contain changes the log could lose
+    if(global_log_manager.flush(file_lsn)){
+        return true;
+    }
+    // write a new file and rename it, a crash never leaves half a file behind
+    std::string tmp_path = path + ".tmp";
+    std::ifstream old_file(path, std::ios::binary);
+    std::ofstream out(tmp_path, std::ios::binary | std::ios::trunc);
+    uint32_t group_count = static_cast<uint32_t>(groups.size());
+    out.write(reinterpret_cast<const char*>(&file_lsn), sizeof(file_lsn));
+    out.write(reinterpret_cast<const char*>(&group_count), sizeof(group_count));
+    uint64_t offset = sizeof(file_lsn) + sizeof(group_count);
+    std::vector<char> buffer;
+    bool res = false;
+    for(uint32_t g=0;g<group_count && !res;g++){
+        uint64_t size = groups[g].size();
+        if(size != 0){
+            out.write(groups[g].data(), size);
+        }
+        else{
+            // a group without changes still has the bytes of the last flush
+            size = file_groups[g].second;
+            buffer.resize(size);
+            old_file.seekg(file_groups[g].first);
+            res = !old_file.read(buffer.data(), size);
+            out.write(buffer.data(), size);
+        }
+        extents.push_back(std::make_pair(offset, size));
+        offset += size;
+    }
+    out.close();
+    if(res || !out.good() || PageFile::syncPath(tmp_path) || rename(tmp_path.c_str(), path.c_str()) != 0){
+        std::cout << "Fail to write " << path << std::endl;
+        return true;
+    }
+    return false;
+}
+
+void ColumnStore::drop(){
+    std::lock_guard<std::mutex> flush_guard(flush_latch);
+    std::lock_guard<std::recursive_mutex> guard(latch);
+    remove(path.c_str());
+    file_groups.clear();
+    loaded = true;
+    dirty = false;
+}
+
+RowGroup* ColumnStore::getRowGroup(Tuple* tup){
+    if(tup->block >= row_groups.size()){
+        return NULL;
+    }
+    RowGroup* group = row_groups[tup->block];
+    if(tup->slot >= group->row_count || group->deleted.test(tup->slot)){
+        return NULL;
+    }
+    return group;
+}
+
+void ColumnStore::encodeValue(RowGroup* group, size_t idx, uint32_t row, Expr* val){
+    ColumnChunk* chunk = group->chunks[idx];
+    std::vector<char> field(chunk->width, 0);
+    if(val == NULL || val->type == kExprLiteralNull){
+        chunk->nulls[row] = 1;
+        chunk->set(row, field.data());
+        group->zones[idx].add((*columns)[idx], field.data(), true);
+        return;
+    }
+    chunk->nulls[row] = 0;
+    TupleLayout::encodeField((*columns)[idx], val, field.data());
+    chunk->set(row, field.data());
+    group->zones[idx].add((*columns)[idx], field.data(), false);
+}
+
+uint32_t ColumnStore::appendRow(){
+    if(row_groups.empty() || row_groups.back()->row_count == kRowGroupSize){
+        row_groups.push_back(new RowGroup(columns));
+    }
+    RowGroup* group = row_groups.back();
+    for(auto chunk : group->chunks){
+        chunk->append();
+    }
+    group->deleted.resize(group->row_count + 1);
+    group->live_count++;
+    return group->row_count++;
+}
+
+// a row in TupleLayout encoding has the same field widths as the chunks
+void ColumnStore::readRow(RowGroup* group, uint32_t row, char* dst){
+    memset(dst, 0, layout.null_bytes);
+    for(size_t i=0;i<group->chunks.size();i++){
+        ColumnChunk* chunk = group->chunks[i];
+        if(chunk->nulls[row]){
+            dst[i >> 3] |= (1 << (i & 7));
+        }
+        chunk->get(row, dst + layout.offsets[i]);
+    }
+}
+
+void ColumnStore::writeRow(RowGroup* group, uint32_t row, const char* src){
+    for(size_t i=0;i<group->chunks.size();i++){
+        ColumnChunk* chunk = group->chunks[i];
+        chunk->nulls[row] = layout.isNull(i, src) ? 1 : 0;
+        chunk->set(row, src + layout.offsets[i]);
+        group->zones[i].add((*columns)[i], src + layout.offsets[i], chunk->nulls[row]);
+    }
+}
+
+bool ColumnStore::insertTuple(std::vector<Expr*>* values){
+    std::vector<std::vector<Expr*>*> rows(1, values);
+    return insertTuples(rows);
+}
+
+bool ColumnStore::insertTuples(std::vector<std::vector<Expr*>*>& rows){
+    std::lock_guard<std::recursive_mutex> guard(latch);
+    if(load()){
+        return true;
+    }
+    for(auto values : rows){
+        if(values == NULL || values->size() != columns->size()){
+            std::cout << "Column count doesn't match value count." << std::endl;
+            return true;
+        }
+    }
+    std::vector<char> row(layout.size);
+    for(auto values : rows){
+        layout.encode(values, row.data());
+        Tuple tup;
+        tup.slot = appendRow();
+        tup.block = static_cast<uint32_t>(row_groups.size() - 1);
+        writeRow(row_groups.back(), tup.slot, row.data());
+        indexInsert(&tup, row.data());
+        setLsn(row_groups.back(), global_transaction.log(this, kLogInsert, &tup, NULL, row.data(), layout.size));
+    }
+    return false;
+}
+
+bool ColumnStore::seqScan(Tuple* tup, bool* done){
+    *done = false;
+    if(load()){
+        return true;
+    }
+    uint32_t group_id = 0;
+    uint32_t row = 0;
+    if(tup->block != kInvalidBlock){
+        group_id = tup->block;
+        row = tup->slot + 1;
+    }
+    for(;group_id<row_groups.size();group_id++, row = 0){
+        RowGroup* group = row_groups[group_id];
+        if(group->live_count == 0){
+            continue;
+        }
+        row = group->deleted.nextLive(row, group->row_count);
+        if(row < group->row_count){
+            tup->block = group_id;
+            tup->slot = row;
+            return false;
+        }
+    }
+    *done = true;
+    return false;
+}
+
+// predicates on dictionary chunks are evaluated once per dictionary value,
+// then rows only look up their codes. return false when no code of some chunk matches
+bool ColumnStore::matchCodes(uint32_t group_id, ScanFilter* filter){
+    RowGroup* group = row_groups[group_id];
+    filter->block = group_id;
+    filter->code_matches.assign(filter->predicates.size(), std::vector<uint8_t>());
+    bool res = true;
+    for(size_t i=0;i<filter->predicates.size();i++){
+        ScanPredicate& predicate = filter->predicates[i];
+        ColumnChunk* chunk = group->chunks[predicate.idx];
+        if(!chunk->dict_encoded){
+            continue;
+        }
+        std::vector<uint8_t>& matches = filter->code_matches[i];
+        matches.assign(chunk->dict.size(), 0);
+        bool any = false;
+        if(predicate.op == kOpEquals){
+            int32_t code = chunk->lookup(predicate.field.data());
+            if(code >= 0){
+                matches[code] = 1;
+                any = true;
+            }
+        }
+        else{
+            for(size_t code=0;code<chunk->dict.size();code++){
+                matches[code] = predicate.match(chunk->dict[code].data()) ? 1 : 0;
+                any = any || matches[code];
+            }
+        }
+        res = res && any;
+    }
+    return res;
+}
+
+bool ColumnStore::filterScan(Tuple* tup, ScanFilter* filter, bool* done){
+    *done = false;
+    if(load()){
+        return true;
+    }
+    if(!filter->matchable()){
+        *done = true;
+        return false;
+    }
+    uint32_t group_id = 0;
+    uint32_t row = 0;
+    if(tup->block != kInvalidBlock){
+        group_id = tup->block;
+        row = tup->slot + 1;
+    }
+    else{
+        filter->block = kInvalidBlock;
+    }
+    for(;group_id<row_groups.size();group_id++, row = 0){
+        RowGroup* group = row_groups[group_id];
+        if(group->live_count == 0 || !filter->mayMatch(group->zones)){
+            continue;
+        }
+        if(filter->block != group_id && !matchCodes(group_id, filter)){
+            continue;
+        }
+        for(row = group->deleted.nextLive(row, group->row_count);row<group->row_count;row = group->deleted.nextLive(row + 1, group->row_count)){
+            if(matchRow(group_id, row, filter)){
+                tup->block = group_id;
+                tup->slot = row;
+                return false;
+            }
+        }
+    }
+    *done = true;
+    return false;
+}
+
+bool ColumnStore::matchRow(uint32_t group_id, uint32_t row, ScanFilter* filter){
+    RowGroup* group = row_groups[group_id];
+    for(size_t i=0;i<filter->predicates.size();i++){
+        ScanPredicate& predicate = filter->predicates[i];
+        ColumnChunk* chunk = group->chunks[predicate.idx];
+        if(chunk->nulls[row]){
+            return false;
+        }
+        if(chunk->dict_encoded){
+            if(chunk->codes[row] >= filter->code_matches[i].size()){
+                // the dictionary got a new value since the codes were matched
+                matchCodes(group_id, filter);
+            }
+            if(!filter->code_matches[i][chunk->codes[row]]){
+                return false;
+            }
+        }
+        else if(!predicate.match(chunk->field(row))){
+            return false;
+        }
+    }
+    return true;
+}
+
+bool ColumnStore::beginMorselScan(uint32_t* block_count){
+    if(load()){
+        return true;
+    }
+    *block_count = static_cast<uint32_t>(row_groups.size());
+    return false;
+}
+
+uint32_t ColumnStore::morselBlocks(){
+    return std::max<uint32_t>(1, kMorselRows / kRowGroupSize);
+}
+
+bool ColumnStore::scanMorsel(uint32_t begin, uint32_t end, ScanFilter* filter, std::vector<size_t>& col_ids,
+                             std::vector<Batch*>& batches, size_t* used){
+    *used = 0;
+    if(filter != NULL && !filter->matchable()){
+        return false;
+    }
+    if(filter != NULL){
+        filter->block = kInvalidBlock;
+    }
+    for(uint32_t group_id=begin;group_id<end && group_id<row_groups.size();group_id++){
+        RowGroup* group = row_groups[group_id];
+        if(group->live_count == 0){
+            continue;
+        }
+        if(filter != NULL && (!filter->mayMatch(group->zones) || !matchCodes(group_id, filter))){
+            continue;
+        }
+        for(uint32_t row = group->deleted.nextLive(0, group->row_count);row<group->row_count;row = group->deleted.nextLive(row + 1, group->row_count)){
+            if(filter != NULL && !matchRow(group_id, row, filter)){
+                continue;
+            }
+            Tuple tup;
+            tup.block = group_id;
+            tup.slot = row;
+            readColumns(&tup, col_ids, morselBatch(batches, used));
+        }
+    }
+    for(size_t i=0;i<*used;i++){
+        batches[i]->selectAll();
+    }
+    return false;
+}
+
+bool ColumnStore::matchTuple(Tuple* tup, ScanFilter* filter){
+    if(load()){
+        return false;
+    }
+    RowGroup* group = getRowGroup(tup);
+    if(group == NULL){
+        return false;
+    }
+    if(filter == NULL){
+        return true;
+    }
+    std::vector<char> field;
+    for(auto& predicate : filter->predicates){
+        ColumnChunk* chunk = group->chunks[predicate.idx];
+        if(chunk->nulls[tup->slot]){
+            return false;
+        }
+        field.resize(chunk->width);
+        chunk->get(tup->slot, field.data());
+        if(!predicate.match(field.data())){
+            return false;
+        }
+    }
+    return true;
+}
+
+bool ColumnStore::readTuple(Tuple* tup, char* data){
+    if(load()){
+        return true;
+    }
+    RowGroup* group = getRowGroup(tup);
+    if(group == NULL){
+        return true;
+    }
+    readRow(group, tup->slot, data);
+    return false;
+}
+
+void ColumnStore::readColumns(Tuple* tup, std::vector<size_t>& col_ids, Batch* batch){
+    RowGroup* group = getRowGroup(tup);
+    if(group == NULL){
+        return;
+    }
+    // only the chunks of the needed columns are touched
+    batch->tuples.push_back(*tup);
+    for(auto idx : col_ids){
+        ColumnChunk* chunk = group->chunks[idx];
+        batch->appendField(idx, chunk->field(tup->slot), chunk->nulls[tup->slot]);
+    }
+}
+
+bool ColumnStore::updateTuple(Tuple* tup, std::vector<size_t>& idxs, std::vector<Expr*>& values){
+    std::lock_guard<std::recursive_mutex> guard(latch);
+    RowGroup* group = getRowGroup(tup);
+    if(group == NULL){
+        std::cout << "Tuple not found." << std::endl;
+        return true;
+    }
+    std::vector<char> before(layout.size);
+    std::vector<char> after(layout.size);
+    readRow(group, tup->slot, before.data());
+    for(size_t i=0;i<idxs.size() && i<values.size();i++){
+        encodeValue(group, idxs[i], tup->slot, values[i]);
+    }
+    readRow(group, tup->slot, after.data());
+    indexUpdate(tup, before.data(), after.data());
+    setLsn(group, global_transaction.log(this, kLogUpdate, tup, before.data(), after.data(), layout.size));
+    return false;
+}
+
+bool ColumnStore::writeTuple(Tuple* tup, const char* data){
+    std::lock_guard<std::recursive_mutex> guard(latch);
+    RowGroup* group = getRowGroup(tup);
+    if(group == NULL){
+        std::cout << "Tuple not found." << std::endl;
+        return true;
+    }
+    std::vector<char> before(layout.size);
+    readRow(group, tup->slot, before.data());
+    writeRow(group, tup->slot, data);
+    indexUpdate(tup, before.data(), data);
+    setLsn(group, global_transaction.log(this, kLogUpdate, tup, before.data(), data, layout.size));
+    return false;
+}
+
+bool ColumnStore::deleteTuple(Tuple* tup){
+    std::lock_guard<std::recursive_mutex> guard(latch);
+    RowGroup* group = getRowGroup(tup);
+    if(group == NULL){
+        std::cout << "Tuple not found." << std::endl;
+        return true;
+    }
+    if(!indexes.empty()){
+        std::vector<char> row(layout.size);
+        readRow(group, tup->slot, row.data());
+        indexErase(tup, row.data());
+    }
+    group->deleted.set(tup->slot);
+    group->live_count--;
+    dead_tuples++;
+    setLsn(group, global_transaction.log(this, kLogDelete, tup, NULL, NULL, 0));
+    return false;
+}
+
+bool ColumnStore::restoreTuple(Tuple* tup){
+    std::lock_guard<std::recursive_mutex> guard(latch);
+    if(tup->block >= row_groups.size() || tup->slot >= row_groups[tup->block]->row_count
+       || !row_groups[tup->block]->deleted.test(tup->slot)){
+        std::cout << "Tuple not found." << std::endl;
+        return true;
+    }
+    RowGroup* group = row_groups[tup->block];
+    group->deleted.clear(tup->slot);
+    group->live_count++;
+    if(!indexes.empty()){
+        std::vector<char> row(layout.size);
+        readRow(group, tup->slot, row.data());
+        indexInsert(tup, row.data());
+    }
+    if(dead_tuples > 0){
+        dead_tuples--;
+    }
+    setLsn(group, global_transaction.log(this, kLogRestore, tup, NULL, NULL, 0));
+    return false;
+}
+
+// the live rows of a group are copied into a new one, which also drops
+// dictionary values and zone map bounds only deleted rows had.
+// index entries of the rows which move are moved along
+void ColumnStore::compactGroup(uint32_t group_id){
+    RowGroup* group = row_groups[group_id];
+    RowGroup* compacted = new RowGroup(columns);
+    std::vector<char> row_data(layout.size);
+    for(uint32_t row = group->deleted.nextLive(0, group->row_count);row<group->row_count;row = group->deleted.nextLive(row + 1, group->row_count)){
+        readRow(group, row, row_data.data());
+        if(row != compacted->row_count){
+            Tuple from, to;
+            from.block = to.block = group_id;
+            from.slot = row;
+            to.slot = compacted->row_count;
+            indexErase(&from, row_data.data());
+            indexInsert(&to, row_data.data());
+        }
+        for(auto chunk : compacted->chunks){
+            chunk->append();
+        }
+        compacted->deleted.resize(compacted->row_count + 1);
+        writeRow(compacted, compacted->row_count, row_data.data());
+        compacted->row_count++;
+        compacted->live_count++;
+    }
+    row_groups[group_id] = compacted;
+    delete group;
+}
+
+// Groups with many deleted rows are rewritten, rows get new positions inside their group.
+// Only the last group is appended to, so an earlier group just gets smaller.
+bool ColumnStore::vacuum(){
+    std::lock_guard<std::recursive_mutex> guard(latch);
+    if(load()){
+        return true;
+    }
+    dead_tuples = 0;
+    for(uint32_t group_id=0;group_id<row_groups.size();group_id++){
+        RowGroup* group = row_groups[group_id];
+        uint32_t dead = group->row_count - group->live_count;
+        if(dead == 0 || dead * 4 < group->row_count){
+            continue;
+        }
+        Tuple tup;
+        tup.block = group_id;
+        tup.slot = 0;
+        uint64_t compact_lsn = global_log_manager.append(kLogCompact, 0, table_id, &tup, NULL, 0);
+        compactGroup(group_id);
+        setLsn(row_groups[group_id], compact_lsn);
+    }
+    return false;
+}
+
+bool ColumnStore::prepareRedo(LogRecord*){
+    return load();
+}
+
+uint64_t ColumnStore::recLsn(){
+    std::lock_guard<std::recursive_mutex> guard(latch);
+    uint64_t res = UINT64_MAX;
+    if(rec_lsn != 0){
+        res = rec_lsn;
+    }
+    if(flush_rec_lsn != 0){
+        res = std::min(res, flush_rec_lsn);
+    }
+    return res;
+}
+
+bool ColumnStore::redo(LogRecord* record){
+    std::lock_guard<std::recursive_mutex> guard(latch);
+    if(load()){
+        return true;
+    }
+    if(record->lsn <= lsn){
+        // the file was written after this change
+        return false;
+    }
+    Tuple tup = record->tuple();
+    bool res = false;
+    if(record->header.type == kLogInsert){
+        // inserts always append, so the logged position is the next free one
+        bool next_row = !row_groups.empty() && tup.block == row_groups.size() - 1 && tup.slot == row_groups.back()->row_count;
+        bool next_group = tup.block == row_groups.size() && tup.slot == 0;
+        if(next_row || next_group){
+            appendRow();
+            writeRow(row_groups.back(), tup.slot, record->data.data());
+        }
+        else{
+            res = true;
+        }
+    }
+    else if(record->header.type == kLogCompact){
+        if(tup.block >= row_groups.size()){
+            res = true;
+        }
+        else{
+            compactGroup(tup.block);
+        }
+    }
+    else if(tup.block >= row_groups.size() || tup.slot >= row_groups[tup.block]->row_count){
+        res = true;
+    }
+    else{
+        RowGroup* group = row_groups[tup.block];
+        switch (record->header.type) {
+            case kLogUpdate:
+                writeRow(group, tup.slot, record->data.data() + layout.size);
+                break;
+            case kLogDelete:
+                if(!group->deleted.test(tup.slot)){
+                    group->deleted.set(tup.slot);
+                    group->live_count--;
+                    dead_tuples++;
+                }
+                break;
+            case kLogRestore:
+                if(group->deleted.test(tup.slot)){
+                    group->deleted.clear(tup.slot);
+                    group->live_count++;
+                }
+                break;
+            default:
+                break;
+        }
+    }
+    if(res){
+        std::cout << "Log record doesn't match " << path << std::endl;
+        return true;
+    }
+    setLsn(row_groups[tup.block], record->lsn);
+    return false;
+}
+
+}
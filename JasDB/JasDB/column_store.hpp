@@ -0,0 +1,195 @@
+//
+//  column_store.hpp
+//  JasDB
+//
+
+#ifndef column_store_hpp
+#define column_store_hpp
+
+#include <stdio.h>
+#include <mutex>
+#include <atomic>
+#include <cstring>
+#include <iostream>
+#include <unordered_map>
+#include "table_store.hpp"
+
+using namespace hsql;
+
+namespace jasdb{
+
+const uint32_t kRowGroupSize = 8192;
+// bits of the Bloom filter a row group keeps for each column, 8 per row
+const uint32_t kRowGroupBloomBits = kRowGroupSize * 8;
+
+// a dictionary chunk falls back to plain values once it holds this many distinct values
+const uint32_t kMaxDictionarySize = kRowGroupSize / 2;
+
+// Values of one column inside a row group.
+// Plain chunks store each value with the same width as in TupleLayout, so the encoding code is shared.
+// CHAR/VARCHAR chunks start dictionary encoded: every distinct value is kept once and rows
+// only store a 2 byte code, so low-cardinality strings take little memory and compare as integers.
+class ColumnChunk {
+public:
+    uint32_t width;
+    std::vector<uint8_t> nulls;
+    bool dict_encoded;
+    // plain values, width bytes per row
+    std::vector<char> data;
+    // dictionary values are kept in field encoding without the padding: 2 bytes length, then the bytes
+    std::vector<uint16_t> codes;
+    std::vector<std::string> dict;
+    std::unordered_map<std::string, uint16_t> dict_index;
+    ColumnChunk(uint32_t w, bool dictionary);
+    // add a NULL row
+    void append();
+    // the field of row, as encoded by TupleLayout::encodeField, padding may be missing
+    const char* field(uint32_t row){
+        if(dict_encoded){
+            return dict[codes[row]].data();
+        }
+        return data.data() + static_cast<size_t>(row) * width;
+    }
+    void set(uint32_t row, const char* value);
+    // copy the field of row with its padding
+    void get(uint32_t row, char* dst);
+    // code of a value in the dictionary, -1 if no row has it
+    int32_t lookup(const char* value);
+    bool write(std::ostream& out);
+    bool read(std::istream& in, uint32_t row_count);
+private:
+    std::string dictKey(const char* value){
+        uint16_t len;
+        memcpy(&len, value, sizeof(len));
+        return std::string(value, sizeof(len) + len);
+    }
+    void toPlain();
+};
+
+// One bit per row, set when the row is deleted.
+// Scans look at 64 rows at a time and step over words in which every row is deleted.
+class DeleteBitmap {
+public:
+    std::vector<uint64_t> words;
+    bool test(uint32_t row){
+        return (words[row >> 6] >> (row & 63)) & 1;
+    }
+    void set(uint32_t row){
+        words[row >> 6] |= 1ULL << (row & 63);
+    }
+    void clear(uint32_t row){
+        words[row >> 6] &= ~(1ULL << (row & 63));
+    }
+    void resize(uint32_t row_count){
+        words.resize((row_count + 63) / 64, 0);
+    }
+    // first row from row on which is not deleted, row_count if there is none
+    uint32_t nextLive(uint32_t row, uint32_t row_count){
+        while(row < row_count){
+            uint64_t live = ~words[row >> 6] >> (row & 63);
+            if(live != 0){
+                row += __builtin_ctzll(live);
+                return row < row_count ? row : row_count;
+            }
+            row = (row | 63) + 1;
+        }
+        return row_count;
+    }
+};
+
+// PAX layout: up to kRowGroupSize rows, every column in its own contiguous chunk.
+class RowGroup {
+public:
+    uint32_t row_count;
+    uint32_t live_count;
+    // changed since the group was last written to the file
+    bool dirty;
+    DeleteBitmap deleted;
+    std::vector<ColumnChunk*> chunks;
+    // one zone map per column, scans skip the group when a zone can't match their filter
+    std::vector<ZoneMap> zones;
+    RowGroup(std::vector<ColumnDefinition*>* columns);
+    ~RowGroup();
+};
+
+// Row groups are kept in memory and written to one file by flush().
+// An existing file is only read when the table is used for the first time,
+// so opening the database doesn't depend on the size of columnar tables.
+// The file remembers the LSN of the last change it contains, recovery redoes the later ones.
+// flush() serializes only the groups changed since the last one while it holds latch, the others are
+// copied from the old file after latch is released, so writers never wait for the disk.
+class ColumnStore : public TableStore {
+public:
+    std::vector<RowGroup*> row_groups;
+    std::string path;
+    std::atomic<bool> loaded;
+    bool dirty;
+    // rows are logged in the encoding of the row store
+    TupleLayout layout;
+    uint64_t lsn;
+    // LSN of the first change which is not in the file yet, 0 if there is none
+    uint64_t rec_lsn;
+    // rec_lsn of the changes a running flush writes, they are missing in the file until it is renamed
+    uint64_t flush_rec_lsn;
+    ColumnStore(std::vector<ColumnDefinition*>* columns, std::string path, bool create);
+    ~ColumnStore();
+    bool insertTuple(std::vector<Expr*>* values) override;
+    bool insertTuples(std::vector<std::vector<Expr*>*>& rows) override;
+    bool seqScan(Tuple* tup, bool* done) override;
+    void readColumns(Tuple* tup, std::vector<size_t>& col_ids, Batch* batch) override;
+    bool beginMorselScan(uint32_t* block_count) override;
+    uint32_t morselBlocks() override;
+    bool scanMorsel(uint32_t begin, uint32_t end, ScanFilter* filter, std::vector<size_t>& col_ids,
+                    std::vector<Batch*>& batches, size_t* used) override;
+    bool updateTuple(Tuple* tup, std::vector<size_t>& idxs, std::vector<Expr*>& values) override;
+    bool deleteTuple(Tuple* tup) override;
+    bool filterScan(Tuple* tup, ScanFilter* filter, bool* done) override;
+    bool matchTuple(Tuple* tup, ScanFilter* filter) override;
+    bool readTuple(Tuple* tup, char* data) override;
+    bool restoreTuple(Tuple* tup) override;
+    bool vacuum() override;
+    bool writeTuple(Tuple* tup, const char* data) override;
+    bool redo(LogRecord* record) override;
+    bool prepareRedo(LogRecord* record) override;
+    uint64_t recLsn() override;
+    bool flush() override;
+    void drop() override;
+private:
+    // held by changes, and by flush() while it takes the dirty groups
+    std::recursive_mutex latch;
+    // one flush at a time, drop() waits for it
+    std::mutex flush_latch;
+    // offset and size of every group in the file, valid for groups which aren't dirty.
+    // Only load and flush change it
+    std::vector<std::pair<uint64_t, uint64_t>> file_groups;
+    bool load();
+    // row count, deleted bitmap, then every column chunk
+    void writeGroup(RowGroup* group, std::ostream& out);
+    // groups holds every group serialized, or empty to copy it from the old file.
+    // extents gets where the groups are in the new file
+    bool writeFile(uint64_t file_lsn, std::vector<std::string>& groups, std::vector<std::pair<uint64_t, uint64_t>>& extents);
+    RowGroup* getRowGroup(Tuple* tup);
+    uint32_t appendRow();
+    void readRow(RowGroup* group, uint32_t row, char* dst);
+    void writeRow(RowGroup* group, uint32_t row, const char* src);
+    bool matchCodes(uint32_t group_id, ScanFilter* filter);
+    // row of a group filterScan or scanMorsel is in matches the predicates of filter
+    bool matchRow(uint32_t group_id, uint32_t row, ScanFilter* filter);
+    void compactGroup(uint32_t group_id);
+    // group was changed by the change with change_lsn
+    void setLsn(RowGroup* group, uint64_t change_lsn){
+        group->dirty = true;
+        if(change_lsn != 0){
+            lsn = change_lsn;
+            if(rec_lsn == 0){
+                rec_lsn = change_lsn;
+            }
+        }
+        dirty = true;
+    }
+    void encodeValue(RowGroup* group, size_t idx, uint32_t row, Expr* val);
+};
+
+}
+
+#endif /* column_store_hpp */
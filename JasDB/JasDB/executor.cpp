@@ -9,6 +9,10 @@
 #include "executor.hpp"
 #include "metadata.hpp"
 #include "optimizer.hpp"
+#include "transaction.hpp"
+#include "vacuum.hpp"
+#include "index_builder.hpp"
+#include "util.h"
 using namespace hsql;
 
 namespace jasdb{
@@ -17,8 +21,44 @@ void Executor::init() {
     op_tree = generateOperator(plan_tree);
 }
 
+// the table a select or a change of rows uses, NULL for other statements
+static Table* statementTable(Plan* plan){
+    switch(plan->plan_type){
+        case kInsert:
+            return static_cast<InsertPlan*>(plan)->table;
+        case kUpdate:
+            return static_cast<UpdatePlan*>(plan)->table;
+        case kDelete:
+            return static_cast<DeletePlan*>(plan)->table;
+        case kSelect:
+            return static_cast<SelectPlan*>(plan)->table;
+        default:
+            return NULL;
+    }
+}
+
 bool Executor::exec(){
-    return op_tree->exec();
+    // statements of different tables run side by side and commit together, an online index build only
+    // reads a table between them. create, drop and rollback, which may change any table, run alone
+    bool alone = plan_tree->plan_type == kCreate || plan_tree->plan_type == kDrop
+        || (plan_tree->plan_type == kTrx && static_cast<TrxPlan*>(plan_tree)->command == kRollbackTransaction);
+    std::shared_lock<std::shared_mutex> shared(global_index_builder.statement_latch, std::defer_lock);
+    std::unique_lock<std::shared_mutex> exclusive(global_index_builder.statement_latch, std::defer_lock);
+    if(alone){
+        exclusive.lock();
+    }
+    else{
+        shared.lock();
+    }
+    Table* table = statementTable(plan_tree);
+    std::unique_lock<std::mutex> table_guard;
+    if(table != NULL){
+        table_guard = std::unique_lock<std::mutex>(table->getTableStore()->statement_latch);
+    }
+    global_vacuum.enter();
+    bool res = op_tree->exec();
+    global_vacuum.leave();
+    return res;
 }
 
 BaseOperator* Executor::generateOperator(Plan *plan){
@@ -48,13 +88,19 @@ BaseOperator* Executor::generateOperator(Plan *plan){
             break;
         case kScan:{
             ScanPlan* scan_plan = static_cast<ScanPlan*>(plan);
-            if(scan_plan->type == kSeqScan){
+            if(scan_plan->type == kSeqScan && scan_plan->parallel){
+                op = new ParallelScanOperator(plan,next);
+            }
+            else if(scan_plan->type == kSeqScan){
                 op = new SeqScanOperator(plan,next);
             }
+            else if(scan_plan->type == kIndexScan){
+                op = new IndexScanOperator(plan,next);
+            }
             break;
         }
-        case kFilter:
-            op = new FilterOperator(plan,next);
+        case kSort:
+            op = new SortOperator(plan,next);
             break;
         case kTrx:
             op = new TrxOperator(plan,next);
@@ -69,13 +115,11 @@ BaseOperator* Executor::generateOperator(Plan *plan){
     return op;
 }
 
-bool CreateOperator::exec(TupleIter** iter){
+bool CreateOperator::exec(Batch** batch){
     CreatePlan* plan = static_cast<CreatePlan*>(plan_);
     if(plan->type == kCreateTable){
         // create table
-        Table* table = new Table(plan->schema,plan->tableName,plan->columns);
-        if(global_meta_data.insert_table(table)){
-            //
+        if(global_meta_data.get_table(plan->schema, plan->tableName) != NULL){
             if(plan->ifNotExist){
                 std::cout<<"Table already existed"<<std::endl;
                 return false;
@@ -84,7 +128,13 @@ bool CreateOperator::exec(TupleIter** iter){
                 std::cout<<"Table already existed"<<std::endl;
                 return true;
             }
+        }
+        Table* table = new Table(plan->schema,plan->tableName,plan->columns,plan->storage);
+        if(global_meta_data.insert_table(table)){
+            std::cout << "Fail to create table." << std::endl;
+            table->table_store->drop();
             delete table;
+            return true;
         }
         std::cout << "Create table successfully" << std::endl;
         return false;
@@ -109,7 +159,34 @@ bool CreateOperator::exec(TupleIter** iter){
         index = new Index();
         index->name = plan->indexName;
         index->columns = *plan->indexColumns;
+        if(plan->indexInclude != NULL){
+            index->include = *plan->indexInclude;
+        }
+        index->method = plan->indexMethod;
         table->add_index(index);
+        // a file left behind by an index of the same name
+        index->store->removeFile();
+        if(plan->concurrently){
+            // the catalog has the index right away, queries use it once the builder is done
+            index->store->beginBuild();
+            if(global_meta_data.save_catalog()){
+                index->store->abortBuild();
+                table->remove_index(index);
+                return true;
+            }
+            global_index_builder.add(table, index);
+            std::cout << "Index build started." << std::endl;
+            return false;
+        }
+        if(index->store->build(table->getTableStore())){
+            std::cout << "Fail to build index." << std::endl;
+            table->remove_index(index);
+            return true;
+        }
+        if(global_meta_data.save_catalog()){
+            table->remove_index(index);
+            return true;
+        }
         std::cout << "Create index successfully." << std::endl;
     }
     else{
@@ -119,10 +196,22 @@ bool CreateOperator::exec(TupleIter** iter){
     return false;
 }
 
-bool DropOperator::exec(TupleIter** iter){
+bool DropOperator::exec(Batch** batch){
     DropPlan* plan = static_cast<DropPlan*>(plan_);
+    // tables with an online index build stay until it has finished
+    std::vector<Table*> tables;
+    global_meta_data.get_all_tables(&tables);
+    for(auto table : tables){
+        if(plan->schema == NULL || table->schema != plan->schema || !global_index_builder.busy(table)){
+            continue;
+        }
+        if(plan->type == kDropSchema || (plan->name != NULL && table->name == plan->name)){
+            std::cout << "Index of table " << table->name << " is being built." << std::endl;
+            return true;
+        }
+    }
     if(plan->type == kDropSchema){
-        if(global_meta_data.drop_schema(plan->schema)){
+        if(!global_meta_data.find_schema(plan->schema)){
             if(plan->ifExists){
                 std::cout<<"Schema not existsed."<<std::endl;
                 return false;
@@ -132,11 +221,15 @@ bool DropOperator::exec(TupleIter** iter){
                 return true;
             }
         }
+        // true from now on means the catalog couldn't be saved
+        if(global_meta_data.drop_schema(plan->schema)){
+            return true;
+        }
         std::cout<<"Drop schema successfully."<<std::endl;
         return false;
     }
     else if(plan->type == kDropTable){
-        if(global_meta_data.drop_table(plan->schema, plan->name)){
+        if(global_meta_data.get_table(plan->schema, plan->name) == NULL){
             if(plan->ifExists){
                 std::cout<<"Table not existsed."<<std::endl;
                 return false;
@@ -146,11 +239,14 @@ bool DropOperator::exec(TupleIter** iter){
                 return true;
             }
         }
+        if(global_meta_data.drop_table(plan->schema, plan->name)){
+            return true;
+        }
         std::cout<<"Drop table successfully."<<std::endl;
         return false;
     }
     else if(plan->type == kDropIndex){
-        if(global_meta_data.drop_index(plan->schema, plan->name, plan->indexName)){
+        if(global_meta_data.get_index(plan->schema, plan->name, plan->indexName) == NULL){
             if(plan->ifExists){
                 std::cout<<"Index not existsed."<<std::endl;
                 return false;
@@ -160,6 +256,9 @@ bool DropOperator::exec(TupleIter** iter){
                 return true;
             }
         }
+        if(global_meta_data.drop_index(plan->schema, plan->name, plan->indexName)){
+            return true;
+        }
         std::cout<<"Drop index successfully."<<std::endl;
         return false;
     }
@@ -170,72 +269,116 @@ bool DropOperator::exec(TupleIter** iter){
     return false;
 }
 
-bool InsertOperator::exec(TupleIter** iter){
+bool InsertOperator::exec(Batch** batch){
     InsertPlan* plan = static_cast<InsertPlan*>(plan_);
     TableStore* table_store = plan->table->getTableStore();
-    if(table_store->insertTuple(plan->values)){
+    // outside BEGIN ... COMMIT every statement commits by itself
+    bool autocommit = !global_transaction.inProgress();
+    if(autocommit){
+        global_transaction.begin();
+    }
+    // all rows of one statement are appended as one batch, a failing row rolls back the statement
+    if(table_store->insertTuples(*plan->rows)){
+        if(autocommit){
+            global_transaction.rollback();
+        }
         return true;
     }
-    std::cout<<"Insert tuple sucessfully."<<std::endl;
+    if(autocommit && global_transaction.commit()){
+        return true;
+    }
+    if(plan->rows->size() == 1){
+        std::cout<<"Insert tuple sucessfully."<<std::endl;
+    }
+    else{
+        std::cout<<"Insert "<<plan->rows->size()<<" tuples sucessfully."<<std::endl;
+    }
     return false;
 }
 
-bool UpdateOperator::exec(TupleIter** iter){
+bool UpdateOperator::exec(Batch** batch){
     UpdatePlan* update = static_cast<UpdatePlan*>(plan_);
     Table* table = update->table;
     TableStore* table_store = table->getTableStore();
     int upd_cnt = 0;
+    bool autocommit = !global_transaction.inProgress();
+    if(autocommit){
+        global_transaction.begin();
+    }
     while(true){
-        TupleIter* tup_iter = NULL;
-        if(next->exec(&tup_iter)){
+        Batch* tuples = NULL;
+        if(next->exec(&tuples)){
+            if(autocommit){
+                global_transaction.rollback();
+            }
             return true;
         }
-        if(tup_iter == NULL){
+        if(tuples == NULL){
             break;
         }
-        else{
-            table_store->updateTuple(tup_iter->tup,tup_iter->idxs,update->values);
+        for(auto row : tuples->sel){
+            table_store->updateTuple(&tuples->tuples[row],update->indexes,update->values);
             upd_cnt++;
         }
     }
+    if(autocommit && global_transaction.commit()){
+        return true;
+    }
     std::cout<<"Update sucessfully."<<std::endl;
     return false;
 }
 
-bool DeleteOperator::exec(TupleIter** iter){
+bool DeleteOperator::exec(Batch** batch){
     Table* table = static_cast<DeletePlan*>(plan_)->table;
     TableStore* table_store = table->getTableStore();
     int del_cnt = 0;
+    bool autocommit = !global_transaction.inProgress();
+    if(autocommit){
+        global_transaction.begin();
+    }
     while(true){
-        TupleIter* tup_iter = NULL;
-        if(next->exec(&tup_iter)){
+        Batch* tuples = NULL;
+        if(next->exec(&tuples)){
+            if(autocommit){
+                global_transaction.rollback();
+            }
             return true;
         }
-        if(tup_iter == NULL){
+        if(tuples == NULL){
             break;
         }
-        else{
-            table_store->deleteTuple(tup_iter->tup);
+        for(auto row : tuples->sel){
+            table_store->deleteTuple(&tuples->tuples[row]);
             del_cnt++;
         }
     }
+    if(autocommit && global_transaction.commit()){
+        return true;
+    }
     std::cout<<"Delete sucessfully."<<std::endl;
     return false;
 }
 
-bool TrxOperator::exec(TupleIter** iter){
+bool TrxOperator::exec(Batch** batch){
     TrxPlan* plan = static_cast<TrxPlan*>(plan_);
     switch (plan->command) {
         case hsql::kBeginTransaction:
-            global_transaction.begin();
+            if(global_transaction.begin()){
+                return true;
+            }
             std::cout << "Start transaction" << std::endl;
             break;
         case hsql::kCommitTransaction:
-            global_transaction.commit();
+            // returns once the commit record is on disk, concurrent commits share one fsync
+            if(global_transaction.commit()){
+                return true;
+            }
             std::cout << "Commit transaction" << std::endl;
             break;
         case hsql::kRollbackTransaction:
-            global_transaction.rollback();
+            if(global_transaction.rollback()){
+                return true;
+            }
             std::cout << "Rollback transaction" << std::endl;
             break;
         default:
@@ -244,7 +387,7 @@ bool TrxOperator::exec(TupleIter** iter){
     return false;
 }
 
-bool ShowOperator::exec(TupleIter** iter){
+bool ShowOperator::exec(Batch** batch){
     ShowPlan* show_plan = static_cast<ShowPlan*>(plan_);
     if(show_plan->type == kShowTables){
         std::vector<Table*> tables;
@@ -261,7 +404,7 @@ bool ShowOperator::exec(TupleIter** iter){
             return true;
         }
         std::cout << "Columns in" << TableNameToString(table->schema, table->name) << std::endl;
-        for(auto col_def : *table->columns){
+        for(auto col_def : table->columns){
             if(col_def->type.data_type == DataType::CHAR || col_def->type.data_type == DataType::VARCHAR){
                 std::cout << col_def->name << "\t"
                             << DataTypeToString(col_def->type.data_type) << "("
@@ -281,88 +424,287 @@ bool ShowOperator::exec(TupleIter** iter){
     return false;
 }
 
-bool SelectOperator::exec(TupleIter** iter){
+bool SelectOperator::exec(Batch** batch){
     SelectPlan* plan = static_cast<SelectPlan*>(plan_);
-    std::vector<std::vector<Expr*>> tuples;
+    size_t row_count = 0;
+    PrintHeader(plan->out_cols);
     while(true){
-        TupleIter* tup_iter = NULL;
-        if(next->exec(&tup_iter)){
+        Batch* rows = NULL;
+        if(next->exec(&rows)){
             return true;
         }
-        if(tup_iter == NULL){
+        if(rows == NULL){
             break;
         }
-        else{
-            tuples.push_back(tup_iter->values);
+        // row i of every batch reuses the same values, only the columns the select reads are loaded
+        size_t width = rows->columns.size();
+        if(cells.size() < rows->sel.size() * width){
+            cells.resize(rows->sel.size() * width, NULL);
         }
+        tuples.resize(rows->sel.size());
+        for(size_t i=0;i<rows->sel.size();i++){
+            std::vector<Expr*>& values = tuples[i];
+            values.assign(width, NULL);
+            for(auto idx : plan->col_ids){
+                Expr*& cell = cells[i * width + idx];
+                if(cell == NULL){
+                    cell = new Expr(kExprLiteralNull);
+                }
+                rows->loadValue(idx, rows->sel[i], cell);
+                values[idx] = cell;
+            }
+        }
+        PrintRows(plan->col_ids, tuples);
+        std::cout.flush();
+        row_count += tuples.size();
     }
-    PrintTuple(plan->out_cols,plan->col_ids,tuples);
+    PrintFooter(row_count);
     return false;
 }
 
-bool SeqScanOperator::exec(TupleIter** iter){
+bool SeqScanOperator::exec(Batch** batch){
     ScanPlan* plan = static_cast<ScanPlan*>(plan_);
     TableStore* table_store = plan->table->getTableStore();
-    Tuple* tup = NULL;
-    if(finish){
-        return false;
+    *batch = NULL;
+    // the scan may end with tuples left to return
+    while(!finish){
+        if(table_store->scanBatch(&cursor, plan->filter, plan->col_ids, &batch_, &finish)){
+            return true;
+        }
+        if(!batch_.sel.empty()){
+            *batch = &batch_;
+            break;
+        }
     }
-    if(next_tuple == NULL){
-        tup = table_store->seqScan(NULL);
+    return false;
+}
+
+ParallelScanOperator::~ParallelScanOperator(){
+    stop();
+    for(auto& slot : slots){
+        for(auto batch : slot.batches){
+            delete batch;
+        }
     }
-    else{
-        tup = next_tuple;
+}
+
+bool ParallelScanOperator::start(){
+    ScanPlan* plan = static_cast<ScanPlan*>(plan_);
+    TableStore* table_store = plan->table->getTableStore();
+    started = true;
+    if(table_store->beginMorselScan(&block_count)){
+        return true;
     }
-    if(tup == NULL){
-        *iter = NULL;
+    morsel_blocks = table_store->morselBlocks();
+    morsel_count = (block_count + morsel_blocks - 1) / morsel_blocks;
+    size_t worker_count = std::min(global_worker_pool.size(), morsel_count);
+    if(worker_count <= 1){
+        slots.resize(1);
         return false;
     }
-    TupleIter* tup_iter = new TupleIter(tup);
-    table_store->parseTuple(tup,tup_iter->values);
-    tuples.push_back(tup_iter);
-    *iter = tup_iter;
-    next_tuple = table_store->seqScan(tup);
-    if(next_tuple == NULL){
-        // no next
-        finish = true;
-    }
+    parallel = true;
+    slots.resize(worker_count * 2);
+    schedule();
     return false;
 }
 
-bool FilterOperator::exec(TupleIter** iter){
-    *iter = NULL;
-    while(true){
-        TupleIter* tup_iter = NULL;
-        if(next->exec(&tup_iter)){
+void ParallelScanOperator::schedule(){
+    size_t first, end;
+    {
+        std::lock_guard<std::mutex> guard(latch);
+        first = next_morsel;
+        if(!stopping){
+            next_morsel = std::max(next_morsel, std::min(morsel_count, out_morsel + slots.size()));
+        }
+        end = next_morsel;
+        pending += end - first;
+    }
+    // a stopped pool runs the task right here, so the latch isn't held
+    for(size_t morsel=first;morsel<end;morsel++){
+        global_worker_pool.submit([this, morsel]{
+            run(morsel);
+        });
+    }
+}
+
+void ParallelScanOperator::stop(){
+    std::unique_lock<std::mutex> lock(latch);
+    stopping = true;
+    cond.wait(lock, [this]{
+        return pending == 0;
+    });
+}
+
+void ParallelScanOperator::run(size_t morsel){
+    ScanPlan* plan = static_cast<ScanPlan*>(plan_);
+    bool skip;
+    {
+        std::lock_guard<std::mutex> guard(latch);
+        skip = stopping;
+    }
+    bool failed = false;
+    if(!skip){
+        // the filter keeps the state of the running scan, every task needs its own
+        ScanFilter filter;
+        if(plan->filter != NULL){
+            filter = *plan->filter;
+        }
+        failed = scan(morsel, plan->filter != NULL ? &filter : NULL);
+    }
+    // the operator may be gone once pending is 0 and the latch is released
+    std::lock_guard<std::mutex> guard(latch);
+    MorselSlot& slot = slots[morsel % slots.size()];
+    slot.failed = failed;
+    slot.done = true;
+    pending--;
+    cond.notify_all();
+}
+
+bool ParallelScanOperator::scan(size_t morsel, ScanFilter* filter){
+    ScanPlan* plan = static_cast<ScanPlan*>(plan_);
+    TableStore* table_store = plan->table->getTableStore();
+    // only the worker which took the morsel touches the slot until it is done
+    MorselSlot& slot = slots[morsel % slots.size()];
+    uint32_t begin = static_cast<uint32_t>(morsel * morsel_blocks);
+    uint32_t end = std::min(block_count, begin + morsel_blocks);
+    return table_store->scanMorsel(begin, end, filter, plan->col_ids, slot.batches, &slot.used);
+}
+
+bool ParallelScanOperator::exec(Batch** batch){
+    ScanPlan* plan = static_cast<ScanPlan*>(plan_);
+    *batch = NULL;
+    if(!started && start()){
+        return true;
+    }
+    while(out_morsel < morsel_count){
+        MorselSlot& slot = slots[out_morsel % slots.size()];
+        if(!parallel){
+            slot.failed = scan(out_morsel, plan->filter);
+            slot.done = true;
+        }
+        else{
+            std::unique_lock<std::mutex> lock(latch);
+            cond.wait(lock, [&slot]{
+                return slot.done;
+            });
+        }
+        if(slot.failed){
+            stop();
             return true;
         }
-        if(tup_iter == NULL){
-            break;
+        if(out_batch < slot.used){
+            *batch = slot.batches[out_batch++];
+            return false;
         }
-        if(execEqualExpr(tup_iter)){
-            *iter = tup_iter;
-            break;
+        // the caller is done with the last batch of the morsel, the next morsel may take the slot
+        {
+            std::lock_guard<std::mutex> guard(latch);
+            slot.done = false;
+            out_batch = 0;
+            out_morsel++;
+        }
+        if(parallel){
+            schedule();
         }
     }
+    stop();
     return false;
 }
 
-bool FilterOperator::execEqualExpr(TupleIter *iter){
-    FilterPlan* filter = static_cast<FilterPlan*>(plan_);
-    Expr* val = filter->val;
-    auto col_id = filter->idx;
-    Expr* col_val = iter->values[col_id];
-    if(col_val->type != val->type){
-        return false;
+bool IndexScanOperator::exec(Batch** batch){
+    ScanPlan* plan = static_cast<ScanPlan*>(plan_);
+    TableStore* table_store = plan->table->getTableStore();
+    IndexStore* index = plan->index->store;
+    *batch = NULL;
+    if(!started){
+        started = true;
+        // indexes of the catalog are read or built the first time a query uses them
+        if(!index->built && index->open(table_store)){
+            std::cout << "Fail to build index." << std::endl;
+            return true;
+        }
+        if(plan->index_only){
+            index->scanEntries(plan->range, entries);
+        }
+        else{
+            index->scan(plan->range, matches);
+        }
     }
-    if(col_val->type == kExprLiteralInt){
-        return (col_val->ival == val->ival);
+    batch_.clear();
+    if(plan->index_only){
+        fillIndexOnly();
     }
-    if(col_val->type == kExprLiteralString){
-        return (strcmp(col_val->name, val->name) == 0);
+    while(pos < matches.size() && batch_.tuples.size() < kBatchSize){
+        Tuple tup = matches[pos++];
+        // the index only covers the range, the other predicates are checked here
+        if(table_store->matchTuple(&tup, plan->filter)){
+            table_store->readColumns(&tup, plan->col_ids, &batch_);
+        }
+    }
+    batch_.selectAll();
+    if(!batch_.sel.empty()){
+        *batch = &batch_;
     }
     return false;
 }
 
+void IndexScanOperator::fillIndexOnly(){
+    ScanPlan* plan = static_cast<ScanPlan*>(plan_);
+    IndexStore* index = plan->index->store;
+    row.resize(index->layout.size);
+    while(pos < entries.size() && batch_.tuples.size() < kBatchSize){
+        IndexEntry& entry = entries[pos++];
+        index->decodeKey(entry.key, row.data());
+        if(plan->filter != NULL && !plan->filter->match(&index->layout, row.data())){
+            continue;
+        }
+        batch_.appendRow(entry.tup, &index->layout, plan->col_ids, row.data());
+    }
+}
 
+bool SortOperator::exec(Batch** batch){
+    SortPlan* plan = static_cast<SortPlan*>(plan_);
+    *batch = NULL;
+    if(sort == NULL){
+        sort = new ExternalSort(&layout, plan->keys, plan->descending, global_meta_data.data_dir);
+        row.resize(layout.size);
+        while(true){
+            Batch* rows = NULL;
+            if(next->exec(&rows)){
+                return true;
+            }
+            if(rows == NULL){
+                break;
+            }
+            for(auto r : rows->sel){
+                rows->writeRow(r, &layout, plan->col_ids, row.data());
+                if(sort->add(rows->tuples[r], row.data())){
+                    return true;
+                }
+            }
+        }
+        if(sort->finish()){
+            return true;
+        }
+    }
+    batch_.clear();
+    while(batch_.tuples.size() < kBatchSize){
+        Tuple tup;
+        const char* data = NULL;
+        if(sort->next(&tup, &data)){
+            return true;
+        }
+        if(data == NULL){
+            break;
+        }
+        batch_.appendRow(tup, &layout, plan->col_ids, data);
+    }
+    batch_.selectAll();
+    if(!batch_.sel.empty()){
+        *batch = &batch_;
+    }
+    return false;
 }
+
+
+}
\ No newline at end of file
@@ -9,22 +9,14 @@
 #define executor_hpp
 
 #include <stdio.h>
+#include <mutex>
+#include <condition_variable>
 #include "optimizer.hpp"
+#include "external_sort.hpp"
+#include "worker_pool.hpp"
 
 namespace jasdb{
 
-class TupleIter{
-public:
-    Tuple* tuple;
-    std::vector<Expr*> values;
-    TupleIter(Tuple* t) : tuple(t){}
-    ~TupleIter(){
-        for(auto expr : values){
-            delete expr;
-        }
-    }
-};
-
 class BaseOperator{
 public:
     Plan* plan_;
@@ -33,88 +25,201 @@ public:
     virtual ~BaseOperator(){
         delete next;
     }
-    virtual bool exec(TupleIter** iter = NULL) = 0;
+    // operators which produce tuples set batch to their next one, NULL after the last.
+    // The batch belongs to the operator and is valid until its next call
+    virtual bool exec(Batch** batch = NULL) = 0;
 };
 
 class CreateOperator : public BaseOperator{
 public:
     CreateOperator(Plan* plan, BaseOperator* next) : BaseOperator(plan,next){}
     ~CreateOperator(){}
-    bool exec(TupleIter** iter = NULL) override;
+    bool exec(Batch** batch = NULL) override;
 };
 
 class DropOperator : public BaseOperator {
 public:
     DropOperator(Plan* plan, BaseOperator* next) : BaseOperator(plan,next){}
     ~DropOperator(){}
-    bool exec(TupleIter** iter = NULL) override;
+    bool exec(Batch** batch = NULL) override;
 };
 
 class InsertOperator : public BaseOperator{
 public:
     InsertOperator(Plan* plan, BaseOperator* next) : BaseOperator(plan,next){}
     ~InsertOperator(){}
-    bool exec(TupleIter** iter = NULL) override;
+    bool exec(Batch** batch = NULL) override;
 };
 
 class UpdateOperator : public BaseOperator{
 public:
     UpdateOperator(Plan* plan, BaseOperator* next) : BaseOperator(plan,next){}
     ~UpdateOperator(){}
-    bool exec(TupleIter** iter = NULL) override;
+    bool exec(Batch** batch = NULL) override;
 };
 
 class DeleteOperator : public BaseOperator{
 public:
     DeleteOperator(Plan* plan, BaseOperator* next) : BaseOperator(plan,next){}
     ~DeleteOperator(){}
-    bool exec(TupleIter** iter = NULL) override;
+    bool exec(Batch** batch = NULL) override;
 };
 
 class TrxOperator : public BaseOperator{
 public:
     TrxOperator(Plan* plan, BaseOperator* next) : BaseOperator(plan,next){}
     ~TrxOperator(){}
-    bool exec(TupleIter** iter = NULL) override;
+    bool exec(Batch** batch = NULL) override;
 };
 
 class ShowOperator : public BaseOperator{
 public:
     ShowOperator(Plan* plan, BaseOperator* next) : BaseOperator(plan,next){}
     ~ShowOperator(){}
-    bool exec(TupleIter** iter = NULL) override;
+    bool exec(Batch** batch = NULL) override;
 };
 
+// Prints the header, then the rows of each batch as soon as the scan returns it, then the row count,
+// memory stays bounded by one batch. The values handed to PrintRows are allocated for the first batch
+// and reused for the others.
 class SelectOperator : public BaseOperator{
 public:
     SelectOperator(Plan* plan, BaseOperator* next) : BaseOperator(plan,next){}
-    ~SelectOperator(){}
-    bool exec(TupleIter** iter = NULL) override;
+    ~SelectOperator(){
+        for(auto cell : cells){
+            delete cell;
+        }
+    }
+    bool exec(Batch** batch = NULL) override;
+private:
+    // one value per row of a batch and column, row by row
+    std::vector<Expr*> cells;
+    std::vector<std::vector<Expr*>> tuples;
 };
 
 class SeqScanOperator : public BaseOperator{
 public:
-    std::vector<TupleIter*> tuples;
-    SeqScanOperator(Plan* plan, BaseOperator* next) : BaseOperator(plan,next){
+    SeqScanOperator(Plan* plan, BaseOperator* next) : BaseOperator(plan,next),
+        batch_(&static_cast<ScanPlan*>(plan)->table->columns){
         finish = false;
-        next_tuple = NULL;
     }
     ~SeqScanOperator(){
-        for(auto iter : tuples){
-            delete iter;
-        }
+        static_cast<ScanPlan*>(plan_)->table->getTableStore()->endScan();
     }
-    bool exec(TupleIter** iter = NULL) override;
+    bool exec(Batch** batch = NULL) override;
     bool finish;
-    Tuple* next_tuple;
+    Tuple cursor;
+private:
+    Batch batch_;
+};
+
+// A morsel of a parallel scan, its batches stay until the select has taken all of them.
+class MorselSlot {
+public:
+    std::vector<Batch*> batches;
+    size_t used;
+    bool done;
+    bool failed;
+    MorselSlot() : used(0), done(false), failed(false){}
 };
 
-class FilterOperator : public BaseOperator{
+// Sequential scan of a select on all cores. The table is split into morsels of about kMorselRows tuples,
+// each morsel is a task of global_worker_pool, so a free worker takes the next morsel of any statement
+// and slow morsels don't hold the others up. The batches are returned in morsel order, which keeps the
+// order of a scan on one thread, and the tasks handed in are at most two morsels per worker ahead of the
+// select. A table of one morsel, or a scan while the pool is stopped, is scanned without workers.
+// The tasks only read, they are finished before exec returns NULL or fails, so they are covered by the
+// table latch and vacuum entry of their statement.
+class ParallelScanOperator : public BaseOperator{
 public:
-    FilterOperator(Plan* plan, BaseOperator* next) : BaseOperator(plan,next){}
-    ~FilterOperator(){}
-    bool exec(TupleIter** iter = NULL) override;
-    bool execEqualExpr(TupleIter* iter);
+    ParallelScanOperator(Plan* plan, BaseOperator* next) : BaseOperator(plan,next){
+        started = false;
+        parallel = false;
+        stopping = false;
+        block_count = 0;
+        morsel_blocks = 1;
+        morsel_count = 0;
+        pending = 0;
+        next_morsel = 0;
+        out_morsel = 0;
+        out_batch = 0;
+    }
+    ~ParallelScanOperator();
+    bool exec(Batch** batch = NULL) override;
+private:
+    bool started;
+    // morsels are scanned by the pool
+    bool parallel;
+    bool stopping;
+    uint32_t block_count;
+    uint32_t morsel_blocks;
+    size_t morsel_count;
+    std::mutex latch;
+    std::condition_variable cond;
+    // morsel m is scanned into slots[m % slots.size()]
+    std::vector<MorselSlot> slots;
+    // tasks handed to the pool which haven't finished
+    size_t pending;
+    // the next morsel handed to the pool
+    size_t next_morsel;
+    // the morsel and batch exec returns next
+    size_t out_morsel;
+    size_t out_batch;
+    // return true when the table can't be read
+    bool start();
+    // hand the morsels with a free slot to the pool
+    void schedule();
+    // wait for the tasks handed in, those which haven't begun skip their morsel
+    void stop();
+    void run(size_t morsel);
+    bool scan(size_t morsel, ScanFilter* filter);
+};
+
+// Looks the range of the plan up in its index, then reads the tuples it found in key order.
+// The tuples are collected before the first one is returned, so an update moving keys
+// inside the range doesn't make the scan see a tuple twice.
+// An index only scan decodes the entries instead and never reads the table, the index
+// drops the entry of a tuple together with the tuple, so every entry belongs to a live one.
+class IndexScanOperator : public BaseOperator{
+public:
+    IndexScanOperator(Plan* plan, BaseOperator* next) : BaseOperator(plan,next),
+        batch_(&static_cast<ScanPlan*>(plan)->table->columns){
+        started = false;
+        pos = 0;
+    }
+    ~IndexScanOperator(){}
+    bool exec(Batch** batch = NULL) override;
+    bool started;
+    std::vector<Tuple> matches;
+    // entries of an index only scan
+    std::vector<IndexEntry> entries;
+    size_t pos;
+private:
+    Batch batch_;
+    // an entry decoded into TupleLayout encoding
+    std::vector<char> row;
+    void fillIndexOnly();
+};
+
+// Returns the tuples of the scan below ordered by the ORDER BY columns.
+// The first call reads every tuple into the sort, which spills to run files once its budget is used,
+// then the sorted tuples come out a batch at a time.
+class SortOperator : public BaseOperator{
+public:
+    SortOperator(Plan* plan, BaseOperator* next) : BaseOperator(plan,next),
+        layout(&static_cast<SortPlan*>(plan)->table->columns), batch_(&static_cast<SortPlan*>(plan)->table->columns){
+        sort = NULL;
+    }
+    ~SortOperator(){
+        delete sort;
+    }
+    bool exec(Batch** batch = NULL) override;
+private:
+    TupleLayout layout;
+    ExternalSort* sort;
+    Batch batch_;
+    // a tuple of the scan in TupleLayout encoding
+    std::vector<char> row;
 };
 
 class Executor{
@@ -0,0 +1,268 @@
+//
+//  external_sort.cpp
+//  JasDB
+//
+
+#include "external_sort.hpp"
+#include <iostream>
+#include <cstring>
+#include <cstdio>
+#include <algorithm>
+#include <atomic>
+#include <dirent.h>
+
+namespace jasdb{
+
+// run files are named sort.<n>.run
+static std::atomic<uint64_t> run_seq(0);
+
+SortRun::~SortRun(){
+    in.close();
+    remove(path.c_str());
+}
+
+bool SortRun::open(){
+    in.open(path, std::ios::binary);
+    if(!in.is_open()){
+        std::cout << "Fail to open " << path << std::endl;
+        return true;
+    }
+    buffer.resize(std::max<size_t>(1, kSortReadBuffer / record_size) * record_size);
+    return fill();
+}
+
+bool SortRun::advance(){
+    pos += record_size;
+    if(pos >= buffered){
+        return fill();
+    }
+    return false;
+}
+
+bool SortRun::fill(){
+    in.read(buffer.data(), buffer.size());
+    if(in.bad()){
+        std::cout << "Fail to read " << path << std::endl;
+        return true;
+    }
+    buffered = static_cast<size_t>(in.gcount());
+    buffered -= buffered % record_size;
+    pos = 0;
+    return false;
+}
+
+ExternalSort::ExternalSort(TupleLayout* layout, std::vector<size_t>& keys, std::vector<bool>& descending, std::string dir,
+                           size_t memory_budget, size_t merge_ways)
+    : spills(0), merges(0), layout(layout), keys(keys), descending(descending), dir(dir),
+      merge_ways(std::max<size_t>(2, merge_ways)), pos(0), last(NULL){
+    record_size = sizeof(Tuple) + layout->size;
+    capacity = std::max<size_t>(1, memory_budget / (record_size + sizeof(const char*)));
+}
+
+ExternalSort::~ExternalSort(){
+    for(auto run : runs){
+        delete run;
+    }
+}
+
+void ExternalSort::removeRuns(const std::string& dir){
+    DIR* d = opendir(dir.c_str());
+    if(d == NULL){
+        return;
+    }
+    while(struct dirent* entry = readdir(d)){
+        size_t len = strlen(entry->d_name);
+        if(strncmp(entry->d_name, "sort.", 5) == 0 && len > 4 && strcmp(entry->d_name + len - 4, ".run") == 0){
+            remove((dir + "/" + entry->d_name).c_str());
+        }
+    }
+    closedir(d);
+}
+
+int ExternalSort::compare(const char* a, const char* b){
+    const char* row_a = a + sizeof(Tuple);
+    const char* row_b = b + sizeof(Tuple);
+    for(size_t i=0;i<keys.size();i++){
+        size_t idx = keys[i];
+        bool null_a = layout->isNull(idx, row_a);
+        bool null_b = layout->isNull(idx, row_b);
+        int res;
+        if(null_a || null_b){
+            res = null_a == null_b ? 0 : (null_a ? -1 : 1);
+        }
+        else{
+            res = TupleLayout::compareField((*layout->columns)[idx], row_a + layout->offsets[idx], row_b + layout->offsets[idx]);
+        }
+        if(res != 0){
+            return descending[i] ? -res : res;
+        }
+    }
+    Tuple tup_a, tup_b;
+    memcpy(&tup_a, a, sizeof(Tuple));
+    memcpy(&tup_b, b, sizeof(Tuple));
+    if(tup_a.block != tup_b.block){
+        return tup_a.block < tup_b.block ? -1 : 1;
+    }
+    return tup_a.slot < tup_b.slot ? -1 : (tup_a.slot > tup_b.slot ? 1 : 0);
+}
+
+bool ExternalSort::add(Tuple tup, const char* row){
+    size_t count = records.size() / record_size;
+    if(count == capacity){
+        if(spill()){
+            return true;
+        }
+        count = 0;
+    }
+    if(records.size() == records.capacity()){
+        // grow up to the budget, a small sort doesn't take all of it
+        records.reserve(std::min(capacity, std::max<size_t>(count * 2, 64)) * record_size);
+    }
+    records.resize(records.size() + record_size);
+    char* record = records.data() + count * record_size;
+    memcpy(record, &tup, sizeof(Tuple));
+    memcpy(record + sizeof(Tuple), row, layout->size);
+    return false;
+}
+
+void ExternalSort::sortRecords(){
+    size_t count = records.size() / record_size;
+    sorted.resize(count);
+    for(size_t i=0;i<count;i++){
+        sorted[i] = records.data() + i * record_size;
+    }
+    std::sort(sorted.begin(), sorted.end(), [this](const char* a, const char* b){
+        return compare(a, b) < 0;
+    });
+}
+
+SortRun* ExternalSort::newRun(){
+    return new SortRun(dir + "/sort." + std::to_string(run_seq++) + ".run", record_size);
+}
+
+bool ExternalSort::spill(){
+    sortRecords();
+    SortRun* run = newRun();
+    runs.push_back(run);
+    // runs only live as long as the sort, they are never synced
+    std::ofstream out(run->path, std::ios::binary | std::ios::trunc);
+    for(auto record : sorted){
+        out.write(record, record_size);
+    }
+    out.close();
+    if(!out.good()){
+        std::cout << "Fail to write " << run->path << std::endl;
+        return true;
+    }
+    records.clear();
+    sorted.clear();
+    spills++;
+    return false;
+}
+
+bool ExternalSort::merge(std::vector<SortRun*>& inputs, SortRun* output){
+    std::vector<SortRun*> merging;
+    for(auto run : inputs){
+        if(run->open()){
+            return true;
+        }
+        if(run->head() != NULL){
+            merging.push_back(run);
+        }
+    }
+    std::make_heap(merging.begin(), merging.end(), heapOrder());
+    std::ofstream out(output->path, std::ios::binary | std::ios::trunc);
+    while(!merging.empty()){
+        std::pop_heap(merging.begin(), merging.end(), heapOrder());
+        SortRun* run = merging.back();
+        out.write(run->head(), record_size);
+        if(run->advance()){
+            return true;
+        }
+        if(run->head() != NULL){
+            std::push_heap(merging.begin(), merging.end(), heapOrder());
+        }
+        else{
+            merging.pop_back();
+        }
+    }
+    out.close();
+    if(!out.good()){
+        std::cout << "Fail to write " << output->path << std::endl;
+        return true;
+    }
+    return false;
+}
+
+bool ExternalSort::finish(){
+    if(runs.empty()){
+        sortRecords();
+        return false;
+    }
+    if(!records.empty() && spill()){
+        return true;
+    }
+    // the rows are in runs now, the merge only needs its read buffers
+    std::vector<char>().swap(records);
+    std::vector<const char*>().swap(sorted);
+    // the oldest runs are merged first, so every row is written about as often as every other
+    while(runs.size() > merge_ways){
+        std::vector<SortRun*> inputs(runs.begin(), runs.begin() + merge_ways);
+        SortRun* output = newRun();
+        runs.push_back(output);
+        if(merge(inputs, output)){
+            return true;
+        }
+        merges++;
+        runs.erase(runs.begin(), runs.begin() + merge_ways);
+        for(auto run : inputs){
+            delete run;
+        }
+    }
+    for(auto run : runs){
+        if(run->open()){
+            return true;
+        }
+        if(run->head() != NULL){
+            heap.push_back(run);
+        }
+    }
+    std::make_heap(heap.begin(), heap.end(), heapOrder());
+    return false;
+}
+
+bool ExternalSort::next(Tuple* tup, const char** row){
+    *row = NULL;
+    const char* record = NULL;
+    if(runs.empty()){
+        if(pos < sorted.size()){
+            record = sorted[pos++];
+        }
+    }
+    else{
+        // the run of the row returned last moves on only now, so that row stayed valid
+        if(last != NULL){
+            if(last->advance()){
+                return true;
+            }
+            if(last->head() != NULL){
+                heap.push_back(last);
+                std::push_heap(heap.begin(), heap.end(), heapOrder());
+            }
+            last = NULL;
+        }
+        if(!heap.empty()){
+            std::pop_heap(heap.begin(), heap.end(), heapOrder());
+            last = heap.back();
+            heap.pop_back();
+            record = last->head();
+        }
+    }
+    if(record != NULL){
+        memcpy(tup, record, sizeof(Tuple));
+        *row = record + sizeof(Tuple);
+    }
+    return false;
+}
+
+}
@@ -0,0 +1,102 @@
+//
+//  external_sort.hpp
+//  JasDB
+//
+
+#ifndef external_sort_hpp
+#define external_sort_hpp
+
+#include <stdio.h>
+#include <fstream>
+#include "table_store.hpp"
+
+namespace jasdb{
+
+// rows one sort keeps in memory, the rest goes into runs
+const size_t kSortMemoryBudget = 16 * 1024 * 1024;
+// most runs merged at once
+const size_t kSortMergeWays = 64;
+// bytes read from a run at a time while merging
+const size_t kSortReadBuffer = 64 * 1024;
+
+// Sorted records in a temporary file, read back one buffer at a time.
+// The file is removed with the run.
+class SortRun {
+public:
+    std::string path;
+    SortRun(std::string path, size_t record_size) : path(path), record_size(record_size), buffered(0), pos(0){}
+    ~SortRun();
+    // start reading the run from its first record
+    bool open();
+    // the record read next, NULL after the last one
+    const char* head(){
+        return pos < buffered ? buffer.data() + pos : NULL;
+    }
+    bool advance();
+private:
+    size_t record_size;
+    std::ifstream in;
+    std::vector<char> buffer;
+    size_t buffered;
+    size_t pos;
+    bool fill();
+};
+
+// Sorts tuples with their rows in TupleLayout encoding by some of their columns.
+// Rows are collected until they use memory_budget, then they are sorted and written into a run
+// in dir. Once every row was added, runs are merged merge_ways at a time until a single merge
+// returns the rows in order, so a sort never holds more than its budget plus one read buffer per run.
+// A sort which fits into its budget never writes a file.
+// NULL comes before every other value of an ascending key and after them for a descending one,
+// tuples with equal keys keep the order of the table.
+class ExternalSort {
+public:
+    // runs written and merges of runs into a new run so far
+    size_t spills;
+    size_t merges;
+    // keys are column positions, descending has one entry per key. merge_ways is at least 2
+    ExternalSort(TupleLayout* layout, std::vector<size_t>& keys, std::vector<bool>& descending, std::string dir,
+                 size_t memory_budget = kSortMemoryBudget, size_t merge_ways = kSortMergeWays);
+    ~ExternalSort();
+    bool add(Tuple tup, const char* row);
+    // called once after the last add, before next
+    bool finish();
+    // the next tuple in order and its row, row is NULL after the last one. The row stays valid until the next call
+    bool next(Tuple* tup, const char** row);
+    // remove the runs of a sort which didn't finish before a crash
+    static void removeRuns(const std::string& dir);
+private:
+    TupleLayout* layout;
+    std::vector<size_t> keys;
+    std::vector<bool> descending;
+    std::string dir;
+    size_t merge_ways;
+    // a record is the Tuple followed by the row
+    size_t record_size;
+    // records which fit into the budget
+    size_t capacity;
+    std::vector<char> records;
+    // records in order, pointing into records
+    std::vector<const char*> sorted;
+    size_t pos;
+    std::vector<SortRun*> runs;
+    // runs of the last merge, ordered by their head, and the run whose head next returned last
+    std::vector<SortRun*> heap;
+    SortRun* last;
+    int compare(const char* a, const char* b);
+    // order of a heap of runs with the smallest head on top
+    auto heapOrder(){
+        return [this](SortRun* a, SortRun* b){
+            return compare(a->head(), b->head()) > 0;
+        };
+    }
+    void sortRecords();
+    // write the records in memory into a new run
+    bool spill();
+    bool merge(std::vector<SortRun*>& inputs, SortRun* output);
+    SortRun* newRun();
+};
+
+}
+
+#endif /* external_sort_hpp */
@@ -0,0 +1,142 @@
+//
+//  hash_index.cpp
+//  JasDB
+//
+
+#include "hash_index.hpp"
+#include <functional>
+#include <algorithm>
+
+namespace jasdb{
+
+HashIndex::HashIndex(std::vector<ColumnDefinition*>* columns, std::vector<size_t>& col_ids) : IndexStore(columns, col_ids){
+    slots.resize(kHashIndexMinSlots);
+    used = 0;
+    removed = 0;
+}
+
+void HashIndex::clear(){
+    std::lock_guard<std::mutex> guard(latch);
+    std::vector<HashSlot>(kHashIndexMinSlots).swap(slots);
+    used = 0;
+    removed = 0;
+    built = false;
+}
+
+uint64_t HashIndex::hashKey(const std::string& key){
+    uint64_t hash = std::hash<std::string>()(key);
+    // the two smallest values mark empty and removed slots
+    return hash <= kHashRemoved ? hash + 2 : hash;
+}
+
+int64_t HashIndex::find(const std::string& key, uint64_t hash){
+    size_t mask = slots.size() - 1;
+    for(size_t i = hash & mask;slots[i].hash != kHashEmpty;i = (i + 1) & mask){
+        if(slots[i].hash == hash && slots[i].key == key){
+            return static_cast<int64_t>(i);
+        }
+    }
+    return -1;
+}
+
+// move every key into slot_count new slots, which also drops the removed markers
+void HashIndex::resize(size_t slot_count){
+    std::vector<HashSlot> old_slots(slot_count);
+    old_slots.swap(slots);
+    size_t mask = slots.size() - 1;
+    for(auto& slot : old_slots){
+        if(slot.hash <= kHashRemoved){
+            continue;
+        }
+        size_t i = slot.hash & mask;
+        while(slots[i].hash != kHashEmpty){
+            i = (i + 1) & mask;
+        }
+        slots[i].hash = slot.hash;
+        slots[i].key.swap(slot.key);
+        slots[i].tuples.swap(slot.tuples);
+    }
+    removed = 0;
+}
+
+void HashIndex::insert(const std::string& key, Tuple tup){
+    std::lock_guard<std::mutex> guard(latch);
+    uint64_t hash = hashKey(key);
+    int64_t pos = find(key, hash);
+    if(pos >= 0){
+        slots[pos].tuples.push_back(tup);
+        return;
+    }
+    // keep at least 30% of the slots empty, so probe sequences stay short
+    if((used + removed + 1) * 10 > slots.size() * 7){
+        size_t slot_count = kHashIndexMinSlots;
+        while((used + 1) * 2 > slot_count){
+            slot_count *= 2;
+        }
+        resize(std::max(slot_count, slots.size()));
+    }
+    size_t mask = slots.size() - 1;
+    size_t i = hash & mask;
+    while(slots[i].hash > kHashRemoved){
+        i = (i + 1) & mask;
+    }
+    if(slots[i].hash == kHashRemoved){
+        removed--;
+    }
+    slots[i].hash = hash;
+    slots[i].key = key;
+    slots[i].tuples.assign(1, tup);
+    used++;
+}
+
+void HashIndex::erase(const std::string& key, Tuple tup){
+    std::lock_guard<std::mutex> guard(latch);
+    int64_t pos = find(key, hashKey(key));
+    if(pos < 0){
+        return;
+    }
+    HashSlot& slot = slots[pos];
+    for(size_t i=0;i<slot.tuples.size();i++){
+        if(slot.tuples[i].block == tup.block && slot.tuples[i].slot == tup.slot){
+            slot.tuples[i] = slot.tuples.back();
+            slot.tuples.pop_back();
+            break;
+        }
+    }
+    if(slot.tuples.empty()){
+        slot.hash = kHashRemoved;
+        std::string().swap(slot.key);
+        std::vector<Tuple>().swap(slot.tuples);
+        used--;
+        removed++;
+    }
+}
+
+void HashIndex::scan(IndexRange& range, std::vector<Tuple>& tuples){
+    std::lock_guard<std::mutex> guard(latch);
+    if(range.isPoint()){
+        int64_t pos = find(range.lower, hashKey(range.lower));
+        if(pos >= 0){
+            tuples.insert(tuples.end(), slots[pos].tuples.begin(), slots[pos].tuples.end());
+        }
+        return;
+    }
+    for(auto& slot : slots){
+        if(slot.hash > kHashRemoved && range.compare(slot.key) == 0){
+            tuples.insert(tuples.end(), slot.tuples.begin(), slot.tuples.end());
+        }
+    }
+}
+
+void HashIndex::dump(std::vector<IndexEntry>& entries){
+    std::lock_guard<std::mutex> guard(latch);
+    for(auto& slot : slots){
+        if(slot.hash > kHashRemoved){
+            for(auto tup : slot.tuples){
+                entries.emplace_back(slot.key, tup);
+            }
+        }
+    }
+}
+
+}
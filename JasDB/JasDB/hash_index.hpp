@@ -0,0 +1,60 @@
+//
+//  hash_index.hpp
+//  JasDB
+//
+
+#ifndef hash_index_hpp
+#define hash_index_hpp
+
+#include <stdio.h>
+#include <mutex>
+#include "index_store.hpp"
+
+namespace jasdb{
+
+// slots of an empty hash index, the count is always a power of two
+const uint32_t kHashIndexMinSlots = 1024;
+
+// One distinct key and every tuple holding it.
+class HashSlot {
+public:
+    // kHashEmpty, kHashRemoved, or the hash of key
+    uint64_t hash;
+    std::string key;
+    std::vector<Tuple> tuples;
+    HashSlot() : hash(0){}
+};
+
+// Open addressing hash table with linear probing, for indexes created with USING HASH.
+// An equality lookup probes a few neighbouring slots instead of walking down a tree,
+// but the keys have no order, so any other range has to read every slot.
+class HashIndex : public IndexStore {
+public:
+    HashIndex(std::vector<ColumnDefinition*>* columns, std::vector<size_t>& col_ids);
+    void scan(IndexRange& range, std::vector<Tuple>& tuples) override;
+    bool ordered() override{
+        return false;
+    }
+protected:
+    void insert(const std::string& key, Tuple tup) override;
+    void erase(const std::string& key, Tuple tup) override;
+    void clear() override;
+    void dump(std::vector<IndexEntry>& entries) override;
+private:
+    static const uint64_t kHashEmpty = 0;
+    // the key of the slot was removed, probes go on past it
+    static const uint64_t kHashRemoved = 1;
+    std::mutex latch;
+    std::vector<HashSlot> slots;
+    // slots holding a key, and slots holding kHashRemoved
+    size_t used;
+    size_t removed;
+    static uint64_t hashKey(const std::string& key);
+    // slot of key, -1 if it isn't there
+    int64_t find(const std::string& key, uint64_t hash);
+    void resize(size_t slot_count);
+};
+
+}
+
+#endif /* hash_index_hpp */
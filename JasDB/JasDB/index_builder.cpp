@@ -0,0 +1,114 @@
+//
+//  index_builder.cpp
+//  JasDB
+//
+
+#include "index_builder.hpp"
+#include "metadata.hpp"
+#include "vacuum.hpp"
+#include <iostream>
+
+namespace jasdb{
+
+IndexBuilder global_index_builder;
+
+void IndexBuilder::start(){
+    std::lock_guard<std::mutex> guard(latch);
+    if(running){
+        return;
+    }
+    running = true;
+    worker = std::thread(&IndexBuilder::run, this);
+}
+
+void IndexBuilder::stop(){
+    {
+        std::lock_guard<std::mutex> guard(latch);
+        if(!running){
+            return;
+        }
+        running = false;
+    }
+    cond.notify_all();
+    worker.join();
+    for(auto& job : jobs){
+        job.second->store->abortBuild();
+    }
+    jobs.clear();
+}
+
+void IndexBuilder::add(Table* table, Index* index){
+    {
+        std::lock_guard<std::mutex> guard(latch);
+        jobs.push_back(std::make_pair(table, index));
+    }
+    cond.notify_all();
+}
+
+bool IndexBuilder::busy(Table* table){
+    std::lock_guard<std::mutex> guard(latch);
+    for(auto& job : jobs){
+        if(job.first == table){
+            return true;
+        }
+    }
+    return false;
+}
+
+bool IndexBuilder::isRunning(){
+    std::lock_guard<std::mutex> guard(latch);
+    return running;
+}
+
+void IndexBuilder::run(){
+    std::unique_lock<std::mutex> lock(latch);
+    while(running){
+        if(jobs.empty()){
+            cond.wait(lock);
+            continue;
+        }
+        std::pair<Table*, Index*> job = jobs.front();
+        lock.unlock();
+        bool finished = build(job.first, job.second);
+        lock.lock();
+        if(finished){
+            jobs.pop_front();
+        }
+    }
+}
+
+bool IndexBuilder::build(Table* table, Index* index){
+    IndexStore* store = index->store;
+    TableStore* table_store = table->getTableStore();
+    std::vector<IndexEntry> entries;
+    bool done = false;
+    bool failed = false;
+    while(!done && !failed){
+        std::unique_lock<std::shared_mutex> guard(statement_latch);
+        if(!isRunning()){
+            return false;
+        }
+        // vacuum moves tuples, it waits until the chunk is read
+        global_vacuum.enter();
+        failed = store->readChunk(table_store, entries, kIndexBuildChunk, &done);
+        global_vacuum.leave();
+    }
+    if(!failed){
+        store->loadEntries(entries);
+    }
+    std::unique_lock<std::shared_mutex> guard(statement_latch);
+    global_vacuum.enter();
+    if(failed){
+        std::cout << "Fail to build index " << index->name << "." << std::endl;
+        store->abortBuild();
+        table->remove_index(index);
+        global_meta_data.save_catalog();
+    }
+    else{
+        store->finishBuild();
+    }
+    global_vacuum.leave();
+    return true;
+}
+
+}
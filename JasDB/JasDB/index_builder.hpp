@@ -0,0 +1,61 @@
+//
+//  index_builder.hpp
+//  JasDB
+//
+
+#ifndef index_builder_hpp
+#define index_builder_hpp
+
+#include <stdio.h>
+#include <stdint.h>
+#include <thread>
+#include <mutex>
+#include <shared_mutex>
+#include <deque>
+#include <condition_variable>
+
+namespace jasdb{
+
+class Table;
+class Index;
+
+// tuples an online build reads at a time, sessions wait for one chunk at most
+const uint32_t kIndexBuildChunk = 4096;
+
+// Background builds of indexes created with CONCURRENTLY.
+// Statements share the statement latch while they run. The builder takes it exclusively for one chunk
+// of the table at a time, so statements go on between chunks, and the index logs their changes to the tuples
+// the builder has already read. The entries are sorted and loaded without the latch, then the log
+// is merged under it and the index becomes usable.
+class IndexBuilder {
+public:
+    std::shared_mutex statement_latch;
+    IndexBuilder() : running(false){}
+    ~IndexBuilder(){
+        stop();
+    }
+    void start();
+    // builds which haven't finished are given up, their indexes are built the first time a query uses them
+    void stop();
+    // build index in the background, its store has begun the build
+    void add(Table* table, Index* index);
+    // true while an index of table waits or is built
+    bool busy(Table* table);
+private:
+    std::thread worker;
+    std::mutex latch;
+    std::condition_variable cond;
+    bool running;
+    // the first one is being built
+    std::deque<std::pair<Table*, Index*>> jobs;
+    void run();
+    bool isRunning();
+    // return false when the builder was stopped before the index was built
+    bool build(Table* table, Index* index);
+};
+
+extern IndexBuilder global_index_builder;
+
+}
+
+#endif /* index_builder_hpp */
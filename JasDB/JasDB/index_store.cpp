@@ -0,0 +1,559 @@
+//
+//  index_store.cpp
+//  JasDB
+//
+
+#include "index_store.hpp"
+#include "buffer_pool.hpp"
+#include <cstring>
+#include <algorithm>
+#include <thread>
+#include <fstream>
+#include <iostream>
+#include <unordered_map>
+#include <unordered_set>
+#include <unistd.h>
+
+using namespace hsql;
+
+namespace jasdb{
+
+bool IndexRange::restrict(ScanPredicate& predicate){
+    std::string key;
+    bool partial = false;
+    bool inclusive = predicate.isEquality() || predicate.op == kOpLessEq || predicate.op == kOpGreaterEq;
+    bool lower_bound = predicate.isEquality() || predicate.op == kOpGreater || predicate.op == kOpGreaterEq;
+    bool upper_bound = predicate.isEquality() || predicate.op == kOpLess || predicate.op == kOpLessEq;
+    if(predicate.op == kOpLike && !predicate.isEquality()){
+        // keys starting with the prefix, a bound only has to match the start of a key
+        key = predicate.likePrefix();
+        if(key.empty()){
+            return true;
+        }
+        lower_bound = upper_bound = inclusive = partial = true;
+    }
+    else if(IndexStore::encodeValue(predicate.col_def, predicate.ival, predicate.sval, key)){
+        // a clamped value has to stay inside the range, the filter drops what it lets through
+        inclusive = true;
+    }
+    if(lower_bound){
+        // a key starting with a partial bound is at least as tight
+        int res = has_lower ? compareBound(key, lower) : 1;
+        if(res > 0 || (res == 0 && (!inclusive || lower_partial))){
+            has_lower = true;
+            lower = key;
+            lower_inclusive = inclusive;
+            lower_partial = partial;
+        }
+    }
+    if(upper_bound){
+        int res = has_upper ? compareBound(key, upper) : -1;
+        if(partial && res < 0 && upper.compare(0, key.size(), key) == 0){
+            // the prefix of the bound reaches further than the bound
+            res = 1;
+        }
+        if(res < 0 || (res == 0 && (!inclusive || upper_partial))){
+            has_upper = true;
+            upper = key;
+            upper_inclusive = inclusive;
+            upper_partial = partial;
+        }
+    }
+    return false;
+}
+
+void IndexRange::append(IndexRange& next){
+    // a bound which stops after the prefix includes every key starting with it
+    std::string prefix = lower;
+    has_lower = has_lower || next.has_lower;
+    lower = prefix + next.lower;
+    lower_inclusive = next.has_lower ? next.lower_inclusive : true;
+    lower_partial = next.has_lower ? next.lower_partial : true;
+    has_upper = has_upper || next.has_upper;
+    upper = prefix + next.upper;
+    upper_inclusive = next.has_upper ? next.upper_inclusive : true;
+    upper_partial = next.has_upper ? next.upper_partial : true;
+}
+
+int IndexRange::compare(const std::string& key){
+    if(has_lower){
+        int res = compareBound(key, lower);
+        if(res < 0 || (res == 0 && !lower_inclusive)){
+            return -1;
+        }
+    }
+    if(has_upper){
+        int res = compareBound(key, upper);
+        if(res > 0 || (res == 0 && !upper_inclusive)){
+            return 1;
+        }
+    }
+    return 0;
+}
+
+int IndexRange::compareBound(const std::string& key, const std::string& bound){
+    int res = memcmp(key.data(), bound.data(), std::min(key.size(), bound.size()));
+    if(res != 0){
+        return res;
+    }
+    return key.size() < bound.size() ? -1 : 0;
+}
+
+// big endian with the sign bit flipped, so negative values come first
+static void appendInt(uint64_t v, int bytes, std::string& key){
+    v ^= 1ULL << (bytes * 8 - 1);
+    for(int i=bytes-1;i>=0;i--){
+        key.push_back(static_cast<char>((v >> (i * 8)) & 0xff));
+    }
+}
+
+void IndexStore::encodeKey(ColumnDefinition* col_def, const char* field, std::string& key){
+    switch (col_def->type.data_type) {
+        case DataType::INT:
+        {
+            int32_t v;
+            memcpy(&v, field, sizeof(v));
+            appendInt(static_cast<uint32_t>(v), sizeof(v), key);
+            break;
+        }
+        case DataType::LONG:
+        {
+            int64_t v;
+            memcpy(&v, field, sizeof(v));
+            appendInt(static_cast<uint64_t>(v), sizeof(v), key);
+            break;
+        }
+        case DataType::CHAR:
+        case DataType::VARCHAR:
+        {
+            // strings never contain '\0', ending them with it keeps a shorter string first
+            uint16_t len;
+            memcpy(&len, field, sizeof(len));
+            key.append(field + sizeof(len), len);
+            key.push_back('\0');
+            break;
+        }
+        default:
+            break;
+    }
+}
+
+bool IndexStore::encodeValue(ColumnDefinition* col_def, int64_t ival, const std::string& sval, std::string& key){
+    switch (col_def->type.data_type) {
+        case DataType::INT:
+        {
+            int64_t v = std::max<int64_t>(INT32_MIN, std::min<int64_t>(INT32_MAX, ival));
+            appendInt(static_cast<uint32_t>(static_cast<int32_t>(v)), sizeof(int32_t), key);
+            return v != ival;
+        }
+        case DataType::LONG:
+            appendInt(static_cast<uint64_t>(ival), sizeof(int64_t), key);
+            return false;
+        default:
+            key.append(sval);
+            key.push_back('\0');
+            return false;
+    }
+}
+
+bool IndexStore::makeKey(const char* row, std::string& key){
+    key.clear();
+    for(auto idx : col_ids){
+        if(layout.isNull(idx, row)){
+            return false;
+        }
+        encodeKey((*columns)[idx], row + layout.offsets[idx], key);
+    }
+    for(auto idx : include_ids){
+        if(layout.isNull(idx, row)){
+            key.push_back('\0');
+            continue;
+        }
+        key.push_back('\1');
+        encodeKey((*columns)[idx], row + layout.offsets[idx], key);
+    }
+    return true;
+}
+
+// the inverse of encodeKey, return the position after the field
+static size_t decodeField(ColumnDefinition* col_def, const std::string& key, size_t pos, char* field){
+    switch (col_def->type.data_type) {
+        case DataType::INT:
+        case DataType::LONG:
+        {
+            size_t bytes = col_def->type.data_type == DataType::INT ? sizeof(int32_t) : sizeof(int64_t);
+            uint64_t v = 0;
+            for(size_t i=0;i<bytes;i++){
+                v = (v << 8) | static_cast<uint8_t>(key[pos + i]);
+            }
+            v ^= 1ULL << (bytes * 8 - 1);
+            if(bytes == sizeof(int32_t)){
+                int32_t v32 = static_cast<int32_t>(static_cast<uint32_t>(v));
+                memcpy(field, &v32, sizeof(v32));
+            }
+            else{
+                memcpy(field, &v, sizeof(v));
+            }
+            return pos + bytes;
+        }
+        case DataType::CHAR:
+        case DataType::VARCHAR:
+        {
+            size_t end = key.find('\0', pos);
+            uint16_t len = static_cast<uint16_t>(end - pos);
+            memcpy(field, &len, sizeof(len));
+            memcpy(field + sizeof(len), key.data() + pos, len);
+            return end + 1;
+        }
+        default:
+            return pos;
+    }
+}
+
+void IndexStore::decodeKey(const std::string& key, char* row){
+    memset(row, 0, layout.size);
+    memset(row, 0xff, layout.null_bytes);
+    size_t pos = 0;
+    for(auto idx : col_ids){
+        row[idx >> 3] &= ~(1 << (idx & 7));
+        pos = decodeField((*columns)[idx], key, pos, row + layout.offsets[idx]);
+    }
+    for(auto idx : include_ids){
+        if(key[pos++] == '\0'){
+            continue;
+        }
+        row[idx >> 3] &= ~(1 << (idx & 7));
+        pos = decodeField((*columns)[idx], key, pos, row + layout.offsets[idx]);
+    }
+}
+
+bool IndexStore::covers(std::vector<size_t>& cols, ScanFilter* filter){
+    if(cols.empty()){
+        return false;
+    }
+    auto inside = [this](size_t idx){
+        return std::find(col_ids.begin(), col_ids.end(), idx) != col_ids.end()
+            || std::find(include_ids.begin(), include_ids.end(), idx) != include_ids.end();
+    };
+    for(auto idx : cols){
+        if(!inside(idx)){
+            return false;
+        }
+    }
+    if(filter != NULL){
+        for(auto& predicate : filter->predicates){
+            if(!inside(predicate.idx)){
+                return false;
+            }
+        }
+    }
+    return true;
+}
+
+// the keys are read first and handed to the index at once, so an index can be built
+// from all of its entries instead of searching the place of every key
+bool IndexStore::build(TableStore* store){
+    clear();
+    std::vector<char> row(layout.size);
+    std::vector<IndexEntry> entries;
+    std::string key;
+    Tuple tup;
+    bool done = false;
+    while(true){
+        // a table which can't be read fully must not leave a built index missing some of its tuples
+        if(store->seqScan(&tup, &done)){
+            store->endScan();
+            return true;
+        }
+        if(done){
+            break;
+        }
+        if(store->readTuple(&tup, row.data())){
+            store->endScan();
+            return true;
+        }
+        if(makeKey(row.data(), key)){
+            entries.emplace_back(key, tup);
+        }
+    }
+    load(entries);
+    built = true;
+    return false;
+}
+
+bool IndexStore::open(TableStore* store){
+    std::vector<IndexEntry> entries;
+    if(saved && !readFile(entries)){
+        clear();
+        load(entries);
+        built = true;
+        return false;
+    }
+    return build(store);
+}
+
+bool IndexStore::readFile(std::vector<IndexEntry>& entries){
+    std::ifstream in(path, std::ios::binary | std::ios::ate);
+    if(!in.is_open()){
+        return true;
+    }
+    // nothing read from the file is trusted, a short or garbled file must not make us allocate more than it holds
+    uint64_t left = static_cast<uint64_t>(in.tellg());
+    in.seekg(0);
+    IndexFileHeader header;
+    if(left < sizeof(header) || !in.read(reinterpret_cast<char*>(&header), sizeof(header)) || header.magic != kIndexFileMagic
+       || header.version != 1 || header.key_columns != col_ids.size() || header.include_columns != include_ids.size()){
+        return true;
+    }
+    left -= sizeof(header);
+    const uint64_t entry_fixed = sizeof(uint32_t) + sizeof(uint32_t) + sizeof(uint32_t);
+    if(header.entry_count > left / entry_fixed){
+        return true;
+    }
+    entries.resize(header.entry_count);
+    for(auto& entry : entries){
+        uint32_t len = 0;
+        if(left < entry_fixed || !in.read(reinterpret_cast<char*>(&len), sizeof(len)) || len > left - entry_fixed){
+            return true;
+        }
+        left -= entry_fixed + len;
+        entry.key.resize(len);
+        if(!in.read(&entry.key[0], len)
+           || !in.read(reinterpret_cast<char*>(&entry.tup.block), sizeof(entry.tup.block))
+           || !in.read(reinterpret_cast<char*>(&entry.tup.slot), sizeof(entry.tup.slot))){
+            return true;
+        }
+    }
+    // the entries have to fill the file exactly
+    return left != 0;
+}
+
+// written to a new file which replaces the old one, like the catalog
+bool IndexStore::save(){
+    std::vector<IndexEntry> entries;
+    dump(entries);
+    std::string tmp_path = path + ".tmp";
+    std::ofstream out(tmp_path, std::ios::binary | std::ios::trunc);
+    IndexFileHeader header;
+    header.magic = kIndexFileMagic;
+    header.version = 1;
+    header.key_columns = static_cast<uint32_t>(col_ids.size());
+    header.include_columns = static_cast<uint32_t>(include_ids.size());
+    header.entry_count = entries.size();
+    out.write(reinterpret_cast<const char*>(&header), sizeof(header));
+    for(auto& entry : entries){
+        uint32_t len = static_cast<uint32_t>(entry.key.size());
+        out.write(reinterpret_cast<const char*>(&len), sizeof(len));
+        out.write(entry.key.data(), len);
+        out.write(reinterpret_cast<const char*>(&entry.tup.block), sizeof(entry.tup.block));
+        out.write(reinterpret_cast<const char*>(&entry.tup.slot), sizeof(entry.tup.slot));
+    }
+    out.close();
+    if(!out.good() || PageFile::syncPath(tmp_path) || rename(tmp_path.c_str(), path.c_str()) != 0){
+        std::cout << "Fail to write " << path << std::endl;
+        return true;
+    }
+    saved = true;
+    return false;
+}
+
+void IndexStore::removeFile(){
+    saved = false;
+    if(unlink(path.c_str()) == 0){
+        // the directory has to forget the file before the change which made it stale is logged
+        PageFile::syncPath(path.substr(0, path.rfind('/')));
+    }
+}
+
+void IndexStore::load(std::vector<IndexEntry>& entries){
+    for(auto& entry : entries){
+        insert(entry.key, entry.tup);
+    }
+}
+
+// every thread sorts one run, then neighbouring runs are merged in parallel until one is left
+void IndexStore::sortEntries(std::vector<IndexEntry>& entries){
+    size_t worker_count = std::max(1u, std::min(8u, std::thread::hardware_concurrency()));
+    if(entries.size() < kIndexSortRun || worker_count == 1){
+        std::sort(entries.begin(), entries.end());
+        return;
+    }
+    // run i is entries[bounds[i], bounds[i + 1])
+    std::vector<size_t> bounds;
+    for(size_t i=0;i<=worker_count;i++){
+        bounds.push_back(entries.size() * i / worker_count);
+    }
+    std::vector<std::thread> workers;
+    for(size_t i=0;i+1<bounds.size();i++){
+        workers.push_back(std::thread([&entries, &bounds, i](){
+            std::sort(entries.begin() + bounds[i], entries.begin() + bounds[i + 1]);
+        }));
+    }
+    for(auto& worker : workers){
+        worker.join();
+    }
+    while(bounds.size() > 2){
+        workers.clear();
+        std::vector<size_t> merged;
+        for(size_t i=0;i+2<bounds.size();i+=2){
+            workers.push_back(std::thread([&entries, &bounds, i](){
+                std::inplace_merge(entries.begin() + bounds[i], entries.begin() + bounds[i + 1], entries.begin() + bounds[i + 2]);
+            }));
+            merged.push_back(bounds[i]);
+        }
+        if(bounds.size() % 2 == 0){
+            // an odd number of runs, the last one waits for the next round
+            merged.push_back(bounds[bounds.size() - 2]);
+        }
+        merged.push_back(bounds.back());
+        for(auto& worker : workers){
+            worker.join();
+        }
+        bounds.swap(merged);
+    }
+}
+
+void IndexStore::beginBuild(){
+    clear();
+    std::lock_guard<std::mutex> guard(build_latch);
+    build_pos = Tuple();
+    build_all = false;
+    build_log.clear();
+    building = true;
+}
+
+bool IndexStore::readChunk(TableStore* store, std::vector<IndexEntry>& entries, size_t count, bool* done){
+    std::vector<char> row(layout.size);
+    std::string key;
+    Tuple tup = build_pos;
+    *done = false;
+    for(size_t i=0;i<count;i++){
+        if(store->seqScan(&tup, done)){
+            store->endScan();
+            return true;
+        }
+        if(*done){
+            break;
+        }
+        if(store->readTuple(&tup, row.data())){
+            store->endScan();
+            return true;
+        }
+        if(makeKey(row.data(), key)){
+            entries.emplace_back(key, tup);
+        }
+    }
+    // the scan goes on from tup with the next chunk
+    store->endScan();
+    std::lock_guard<std::mutex> guard(build_latch);
+    build_pos = tup;
+    build_all = *done;
+    return false;
+}
+
+void IndexStore::finishBuild(){
+    std::lock_guard<std::mutex> guard(build_latch);
+    // a logged insert may add an entry the build has read already, and only the B+tree checks
+    // for that itself. The tuples of every key in the log are looked up once, then each change
+    // is applied when it changes what the key lists
+    std::unordered_map<std::string, std::unordered_set<uint64_t>> listed;
+    for(auto& change : build_log){
+        const std::string& key = change.second.key;
+        auto it = listed.find(key);
+        if(it == listed.end()){
+            IndexRange range;
+            range.has_lower = range.has_upper = true;
+            range.lower = range.upper = key;
+            std::vector<Tuple> tuples;
+            scan(range, tuples);
+            it = listed.emplace(key, std::unordered_set<uint64_t>()).first;
+            for(auto& tup : tuples){
+                it->second.insert((static_cast<uint64_t>(tup.block) << 32) | tup.slot);
+            }
+        }
+        uint64_t tup_id = (static_cast<uint64_t>(change.second.tup.block) << 32) | change.second.tup.slot;
+        if(change.first){
+            if(it->second.insert(tup_id).second){
+                insert(key, change.second.tup);
+            }
+        }
+        else if(it->second.erase(tup_id) > 0){
+            erase(key, change.second.tup);
+        }
+    }
+    std::vector<std::pair<bool, IndexEntry>>().swap(build_log);
+    built = true;
+    building = false;
+}
+
+void IndexStore::abortBuild(){
+    {
+        std::lock_guard<std::mutex> guard(build_latch);
+        std::vector<std::pair<bool, IndexEntry>>().swap(build_log);
+        building = false;
+    }
+    clear();
+}
+
+void IndexStore::change(bool insert, const std::string& key, Tuple tup){
+    if(building){
+        std::lock_guard<std::mutex> guard(build_latch);
+        // the build still reads the tuples after build_pos, they have their latest key then
+        bool read = build_all || (build_pos.block != kInvalidBlock
+                                  && (tup.block < build_pos.block || (tup.block == build_pos.block && tup.slot <= build_pos.slot)));
+        if(read){
+            build_log.push_back(std::make_pair(insert, IndexEntry(key, tup)));
+        }
+        return;
+    }
+    if(insert){
+        this->insert(key, tup);
+    }
+    else{
+        erase(key, tup);
+    }
+}
+
+void IndexStore::insertRow(Tuple* tup, const char* row){
+    if(saved){
+        removeFile();
+    }
+    std::string key;
+    if((built || building) && makeKey(row, key)){
+        change(true, key, *tup);
+    }
+}
+
+void IndexStore::eraseRow(Tuple* tup, const char* row){
+    if(saved){
+        removeFile();
+    }
+    std::string key;
+    if((built || building) && makeKey(row, key)){
+        change(false, key, *tup);
+    }
+}
+
+void IndexStore::updateRow(Tuple* tup, const char* before, const char* after){
+    if(saved){
+        removeFile();
+    }
+    if(!built && !building){
+        return;
+    }
+    std::string old_key, new_key;
+    bool has_old = makeKey(before, old_key);
+    bool has_new = makeKey(after, new_key);
+    if(has_old == has_new && old_key == new_key){
+        // no key column changed
+        return;
+    }
+    if(has_old){
+        change(false, old_key, *tup);
+    }
+    if(has_new){
+        change(true, new_key, *tup);
+    }
+}
+
+}
@@ -0,0 +1,195 @@
+//
+//  index_store.hpp
+//  JasDB
+//
+
+#ifndef index_store_hpp
+#define index_store_hpp
+
+#include <stdio.h>
+#include <stdint.h>
+#include <vector>
+#include <string>
+#include <atomic>
+#include <mutex>
+#include "table_store.hpp"
+
+using namespace hsql;
+
+namespace jasdb{
+
+enum IndexMethod {
+    kIndexBTree,
+    kIndexHash,
+    kIndexArt
+};
+
+// fewer entries of an index build are sorted by a single thread
+const size_t kIndexSortRun = 1 << 16;
+
+// Keys between lower and upper, an index scan returns the tuples whose key lies inside.
+// A bound only has to be a prefix of the keys it is compared with.
+class IndexRange {
+public:
+    bool has_lower;
+    bool has_upper;
+    bool lower_inclusive;
+    bool upper_inclusive;
+    // the bound is the start of keys, from a LIKE pattern, not a whole key
+    bool lower_partial;
+    bool upper_partial;
+    std::string lower;
+    std::string upper;
+    IndexRange() : has_lower(false), has_upper(false), lower_inclusive(true), upper_inclusive(true), lower_partial(false), upper_partial(false){}
+    // narrow the range by a predicate on a single key column, op is one of = < <= > >= LIKE.
+    // return true when the predicate can't narrow it, like a LIKE pattern starting with a wildcard
+    bool restrict(ScanPredicate& predicate);
+    // the range is a point or empty, the range of the next key column follows it in both bounds
+    void append(IndexRange& next);
+    // <0, 0, >0 when key is below, inside or above the range
+    int compare(const std::string& key);
+    // only the key lower == upper is inside
+    bool isPoint(){
+        return has_lower && has_upper && lower_inclusive && upper_inclusive && !lower_partial && !upper_partial && lower == upper;
+    }
+    // <0, 0, >0 when the first bound.size() bytes of key are smaller, equal or bigger than bound
+    static int compareBound(const std::string& key, const std::string& bound);
+};
+
+// Key of an index and the tuple holding it.
+// Tuples with the same key are ordered by their position, so every entry is unique.
+class IndexEntry {
+public:
+    std::string key;
+    Tuple tup;
+    IndexEntry(){}
+    IndexEntry(const std::string& key, Tuple tup) : key(key), tup(tup){}
+    bool operator<(const IndexEntry& other) const{
+        int res = key.compare(other.key);
+        if(res != 0){
+            return res < 0;
+        }
+        if(tup.block != other.tup.block){
+            return tup.block < other.tup.block;
+        }
+        return tup.slot < other.tup.slot;
+    }
+};
+
+// File of an index, the header is followed by the entries in key order as <key length><key><block><slot>.
+// The indexes live in memory and have no pages a root could point at, opening the file loads
+// its entries into an empty index the way a build does, without reading the table.
+struct IndexFileHeader {
+    uint32_t magic;
+    uint32_t version;
+    uint32_t key_columns;
+    uint32_t include_columns;
+    uint64_t entry_count;
+};
+
+const uint32_t kIndexFileMagic = 0x5844494a;
+
+// Secondary index over some columns of a table, it maps keys to the tuples holding them.
+// A key is the concatenation of its fields in an encoding whose byte order is the order
+// of the values, so every index type compares keys with memcmp.
+// Rows with a NULL key field are not indexed, no predicate matches NULL anyway.
+// Included columns follow the key fields, a byte before each tells if it is NULL. Ranges only
+// compare the leading bytes of a key, so they are never searched, but an index which returns its
+// entries answers queries on its columns alone (see IndexScanOperator).
+// An index is empty until build() reads its table, afterwards the table store keeps it up to date.
+// A clean shutdown saves every built index to its file, and the first query using the index after a
+// restart reads the file instead of the table. The first change of the table removes the file before
+// the change is logged, so the file never misses a change recovery could bring back.
+// An online build reads the table in chunks instead (see IndexBuilder), meanwhile the changes to
+// tuples it has already read are logged and applied once the entries are loaded.
+class IndexStore {
+public:
+    // columns of the table
+    std::vector<ColumnDefinition*>* columns;
+    // positions of the key columns in the table
+    std::vector<size_t> col_ids;
+    // positions of the columns of INCLUDE, set before the index is built
+    std::vector<size_t> include_ids;
+    TupleLayout layout;
+    std::atomic<bool> built;
+    // an online build runs, queries don't use the index until it has finished
+    std::atomic<bool> building;
+    // the index file, it is saved while it holds the entries of the table as it is now
+    std::string path;
+    std::atomic<bool> saved;
+    IndexStore(std::vector<ColumnDefinition*>* columns, std::vector<size_t>& col_ids) : columns(columns), col_ids(col_ids), layout(columns), built(false), building(false), saved(false), build_all(false){}
+    virtual ~IndexStore(){}
+    // add every live tuple of store
+    bool build(TableStore* store);
+    // load the index file if it is saved, otherwise build the index from store
+    bool open(TableStore* store);
+    // write the entries of the built index to its file
+    bool save();
+    // the file is gone from disk once this returns
+    void removeFile();
+    // online build: empty the index and log changes from now on
+    void beginBuild();
+    // add the keys of up to count tuples after the previous chunk to entries, done is set at the end of the table.
+    // return true on failure
+    bool readChunk(TableStore* store, std::vector<IndexEntry>& entries, size_t count, bool* done);
+    void loadEntries(std::vector<IndexEntry>& entries){
+        load(entries);
+    }
+    // apply the logged changes, each entry is listed once afterwards and the index is built
+    void finishBuild();
+    void abortBuild();
+    // a row in TupleLayout encoding was added to or removed from the table
+    void insertRow(Tuple* tup, const char* row);
+    void eraseRow(Tuple* tup, const char* row);
+    void updateRow(Tuple* tup, const char* before, const char* after);
+    // tuples whose key is inside range, in key order if the index is ordered
+    virtual void scan(IndexRange& range, std::vector<Tuple>& tuples) = 0;
+    // false when only a point range can be looked up, other ranges read the whole index
+    virtual bool ordered(){
+        return true;
+    }
+    // true when scanEntries returns the keys of the entries, so an index only scan can decode them
+    virtual bool returnsEntries(){
+        return false;
+    }
+    // entries whose key is inside range, in key order
+    virtual void scanEntries(IndexRange&, std::vector<IndexEntry>&){}
+    // every column in cols and every column filter checks is a key or included column,
+    // an empty cols stands for all columns and is never covered
+    bool covers(std::vector<size_t>& cols, ScanFilter* filter);
+    // the key and included fields of key in TupleLayout encoding, the other fields of row are NULL
+    void decodeKey(const std::string& key, char* row);
+    // encode a field as key, appended to key
+    static void encodeKey(ColumnDefinition* col_def, const char* field, std::string& key);
+    // encode the value of a predicate as key, a value the column can't hold is clamped to the nearest one,
+    // return true when it was clamped
+    static bool encodeValue(ColumnDefinition* col_def, int64_t ival, const std::string& sval, std::string& key);
+protected:
+    // key doesn't list tup yet, finishBuild drops the logged inserts of entries the build has read
+    virtual void insert(const std::string& key, Tuple tup) = 0;
+    virtual void erase(const std::string& key, Tuple tup) = 0;
+    virtual void clear() = 0;
+    // add the entries of a build to the empty index, one by one unless the index knows better
+    virtual void load(std::vector<IndexEntry>& entries);
+    // every entry of the index, in any order
+    virtual void dump(std::vector<IndexEntry>& entries) = 0;
+    // key and included fields of row, return false when a key field is NULL
+    bool makeKey(const char* row, std::string& key);
+    // sort with up to 8 threads
+    static void sortEntries(std::vector<IndexEntry>& entries);
+private:
+    std::mutex build_latch;
+    // the last tuple an online build has read, or every tuple
+    Tuple build_pos;
+    bool build_all;
+    // changes to tuples the online build has read, true for an insert
+    std::vector<std::pair<bool, IndexEntry>> build_log;
+    // apply a change of the table, or log it during an online build
+    void change(bool insert, const std::string& key, Tuple tup);
+    // return true when the file is missing, was written for other columns or is cut short or garbled
+    bool readFile(std::vector<IndexEntry>& entries);
+};
+
+}
+
+#endif /* index_store_hpp */
@@ -0,0 +1,319 @@
+//
+//  log_manager.cpp
+//  JasDB
+//
+
+#include "log_manager.hpp"
+#include "buffer_pool.hpp"
+#include <iostream>
+#include <cstring>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/stat.h>
+#include <cstdio>
+#include <cstdlib>
+#include <algorithm>
+#include <dirent.h>
+
+namespace jasdb{
+
+LogManager global_log_manager;
+
+const uint64_t kLogMagic = 0x4c4157424453414aULL;
+
+// segment header: magic, then the LSN of the first record in the segment
+struct LogFileHeader {
+    uint64_t magic;
+    uint64_t base_lsn;
+};
+
+LogManager::LogManager() : fd(-1), next_lsn(1), flushed_lsn(1), flushing(false), next_txn_id(1), sync_count(0){}
+
+LogManager::~LogManager(){
+    close();
+}
+
+bool LogManager::open(std::string dir){
+    close();
+    this->dir = dir;
+    segments.clear();
+    DIR* d = opendir(dir.c_str());
+    if(d == NULL){
+        std::cout << "Fail to open " << dir << std::endl;
+        return true;
+    }
+    while(struct dirent* entry = readdir(d)){
+        if(strncmp(entry->d_name, "wal.", 4) == 0 && strstr(entry->d_name, ".tmp") == NULL){
+            LogSegment segment;
+            segment.base_lsn = strtoull(entry->d_name + 4, NULL, 10);
+            segment.path = dir + "/" + entry->d_name;
+            segments.push_back(segment);
+        }
+    }
+    closedir(d);
+    if(segments.empty()){
+        next_lsn = flushed_lsn = 1;
+        return addSegment(1);
+    }
+    std::sort(segments.begin(), segments.end(), [](const LogSegment& a, const LogSegment& b){
+        return a.base_lsn < b.base_lsn;
+    });
+    LogSegment& last = segments.back();
+    fd = ::open(last.path.c_str(), O_RDWR);
+    struct stat st;
+    if(fd < 0 || fstat(fd, &st) != 0 || static_cast<size_t>(st.st_size) < sizeof(LogFileHeader)){
+        std::cout << "Fail to open " << last.path << std::endl;
+        return true;
+    }
+    next_lsn = flushed_lsn = last.base_lsn + (st.st_size - sizeof(LogFileHeader));
+    return false;
+}
+
+void LogManager::close(){
+    if(fd >= 0){
+        flushAll();
+        ::close(fd);
+        fd = -1;
+    }
+}
+
+bool LogManager::addSegment(uint64_t base_lsn){
+    char name[32];
+    // zero padded, so the names sort like the LSNs
+    snprintf(name, sizeof(name), "wal.%020llu", static_cast<unsigned long long>(base_lsn));
+    LogSegment segment;
+    segment.base_lsn = base_lsn;
+    segment.path = dir + "/" + name;
+    int new_fd = ::open(segment.path.c_str(), O_RDWR | O_CREAT | O_TRUNC, 0644);
+    LogFileHeader file_header;
+    file_header.magic = kLogMagic;
+    file_header.base_lsn = base_lsn;
+    // the directory has to know the file before a commit in it is reported durable
+    if(new_fd < 0 || pwrite(new_fd, &file_header, sizeof(file_header), 0) != sizeof(file_header) || fsync(new_fd) != 0
+       || PageFile::syncPath(dir)){
+        std::cout << "Fail to create " << segment.path << std::endl;
+        if(new_fd >= 0){
+            ::close(new_fd);
+        }
+        return true;
+    }
+    if(fd >= 0){
+        ::close(fd);
+    }
+    fd = new_fd;
+    segments.push_back(segment);
+    return false;
+}
+
+uint32_t LogManager::checksum(const LogRecordHeader* header, const char* data, uint32_t len){
+    // FNV-1a over the header with checksum = 0 and the data
+    LogRecordHeader copy = *header;
+    copy.checksum = 0;
+    uint32_t hash = 2166136261u;
+    const unsigned char* bytes = reinterpret_cast<const unsigned char*>(&copy);
+    for(size_t i=0;i<sizeof(copy);i++){
+        hash = (hash ^ bytes[i]) * 16777619u;
+    }
+    bytes = reinterpret_cast<const unsigned char*>(data);
+    for(uint32_t i=0;i<len;i++){
+        hash = (hash ^ bytes[i]) * 16777619u;
+    }
+    return hash;
+}
+
+uint64_t LogManager::append(LogType type, uint64_t txn_id, uint32_t table_id, Tuple* tup, const char* data, uint32_t len){
+    LogRecordHeader header;
+    memset(&header, 0, sizeof(header));
+    header.txn_id = txn_id;
+    header.size = static_cast<uint32_t>(sizeof(header)) + len;
+    header.table_id = table_id;
+    header.block = tup != NULL ? tup->block : kInvalidBlock;
+    header.slot = tup != NULL ? tup->slot : 0;
+    header.type = type;
+    header.checksum = checksum(&header, data, len);
+    std::lock_guard<std::mutex> guard(latch);
+    buffer.append(reinterpret_cast<const char*>(&header), sizeof(header));
+    buffer.append(data, len);
+    next_lsn += header.size;
+    return next_lsn;
+}
+
+bool LogManager::flush(uint64_t lsn){
+    std::unique_lock<std::mutex> lock(latch);
+    while(flushed_lsn < lsn){
+        if(flushing){
+            // someone else is writing, the records we wait for are either in its group or in the next one
+            flushed_cond.wait(lock);
+            continue;
+        }
+        flushing = true;
+        std::string group;
+        group.swap(buffer);
+        uint64_t group_begin = flushed_lsn;
+        uint64_t group_end = next_lsn;
+        int group_fd = fd;
+        uint64_t segment_base = segments.empty() ? group_begin : segments.back().base_lsn;
+        lock.unlock();
+        bool res = false;
+        if(group_fd >= 0 && !group.empty()){
+            off_t offset = static_cast<off_t>(sizeof(LogFileHeader) + (group_begin - segment_base));
+            if(pwrite(group_fd, group.data(), group.size(), offset) != static_cast<ssize_t>(group.size()) || fdatasync(group_fd) != 0){
+                std::cout << "Fail to write log." << std::endl;
+                res = true;
+            }
+            sync_count++;
+        }
+        lock.lock();
+        flushing = false;
+        if(!res){
+            flushed_lsn = group_end;
+            if(group_fd >= 0 && group_end - segment_base >= kLogSegmentSize){
+                res = addSegment(group_end);
+            }
+        }
+        else{
+            // put the records back, they are retried by the next flush
+            buffer.insert(0, group);
+        }
+        flushed_cond.notify_all();
+        if(res){
+            return true;
+        }
+    }
+    return false;
+}
+
+bool LogManager::flushAll(){
+    return flush(currentLsn());
+}
+
+bool LogManager::readSegment(LogSegment& segment, bool last, std::vector<LogRecord*>& records){
+    int seg_fd = ::open(segment.path.c_str(), O_RDONLY);
+    struct stat st;
+    if(seg_fd < 0 || fstat(seg_fd, &st) != 0 || static_cast<size_t>(st.st_size) < sizeof(LogFileHeader)){
+        std::cout << "Fail to read " << segment.path << std::endl;
+        if(seg_fd >= 0){
+            ::close(seg_fd);
+        }
+        return true;
+    }
+    std::string content(st.st_size, '\0');
+    bool res = pread(seg_fd, &content[0], content.size(), 0) != static_cast<ssize_t>(content.size());
+    ::close(seg_fd);
+    LogFileHeader file_header;
+    memcpy(&file_header, content.data(), sizeof(file_header));
+    if(res || file_header.magic != kLogMagic || file_header.base_lsn != segment.base_lsn){
+        std::cout << "Invalid log segment " << segment.path << std::endl;
+        return true;
+    }
+    size_t offset = sizeof(LogFileHeader);
+    while(offset + sizeof(LogRecordHeader) <= content.size()){
+        LogRecord* record = new LogRecord();
+        memcpy(&record->header, content.data() + offset, sizeof(LogRecordHeader));
+        uint32_t size = record->header.size;
+        if(size < sizeof(LogRecordHeader) || offset + size > content.size()){
+            delete record;
+            break;
+        }
+        record->data.assign(content.data() + offset + sizeof(LogRecordHeader), size - sizeof(LogRecordHeader));
+        if(checksum(&record->header, record->data.data(), static_cast<uint32_t>(record->data.size())) != record->header.checksum){
+            delete record;
+            break;
+        }
+        offset += size;
+        record->lsn = segment.base_lsn + (offset - sizeof(LogFileHeader));
+        records.push_back(record);
+    }
+    if(offset != content.size()){
+        if(!last){
+            // older segments were synced completely before the next one was started
+            std::cout << "Corrupted log segment " << segment.path << std::endl;
+            return true;
+        }
+        // the last group was not completely written before the crash, it was never acknowledged
+        if(ftruncate(fd, offset) != 0){
+            std::cout << "Fail to truncate " << segment.path << std::endl;
+            return true;
+        }
+    }
+    if(last){
+        next_lsn = flushed_lsn = segment.base_lsn + (offset - sizeof(LogFileHeader));
+    }
+    return false;
+}
+
+bool LogManager::readAll(std::vector<LogRecord*>& records){
+    if(flushAll()){
+        return true;
+    }
+    std::lock_guard<std::mutex> guard(latch);
+    for(size_t i=0;i<segments.size();i++){
+        if(readSegment(segments[i], i + 1 == segments.size(), records)){
+            return true;
+        }
+    }
+    return false;
+}
+
+bool LogManager::truncate(uint64_t lsn){
+    std::lock_guard<std::mutex> guard(latch);
+    // every record of a segment ends at or before the base LSN of the next segment
+    size_t count = 0;
+    while(count + 1 < segments.size() && segments[count + 1].base_lsn < lsn){
+        count++;
+    }
+    for(size_t i=0;i<count;i++){
+        if(unlink(segments[i].path.c_str()) != 0){
+            std::cout << "Fail to remove " << segments[i].path << std::endl;
+            segments.erase(segments.begin(), segments.begin() + i);
+            return true;
+        }
+    }
+    segments.erase(segments.begin(), segments.begin() + count);
+    // a removed segment mustn't come back after a crash with records the checkpoint gave up
+    return count > 0 && PageFile::syncPath(dir);
+}
+
+bool LogManager::reset(){
+    if(flushAll()){
+        return true;
+    }
+    std::lock_guard<std::mutex> guard(latch);
+    if(fd < 0 || (segments.size() == 1 && segments.back().base_lsn == next_lsn)){
+        // already empty
+        return false;
+    }
+    // the new segment exists before the old ones are removed, so LSNs never start over
+    std::vector<LogSegment> old_segments = segments;
+    segments.clear();
+    if(addSegment(next_lsn)){
+        segments.insert(segments.begin(), old_segments.begin(), old_segments.end());
+        return true;
+    }
+    for(auto& segment : old_segments){
+        unlink(segment.path.c_str());
+    }
+    return PageFile::syncPath(dir);
+}
+
+void LogManager::beginTxn(uint64_t txn_id){
+    std::lock_guard<std::mutex> guard(latch);
+    // every record of the transaction ends after this LSN
+    active_txns[txn_id] = next_lsn;
+}
+
+void LogManager::endTxn(uint64_t txn_id){
+    std::lock_guard<std::mutex> guard(latch);
+    active_txns.erase(txn_id);
+}
+
+uint64_t LogManager::oldestTxnLsn(){
+    std::lock_guard<std::mutex> guard(latch);
+    uint64_t lsn = UINT64_MAX;
+    for(auto it : active_txns){
+        lsn = std::min(lsn, it.second);
+    }
+    return lsn;
+}
+
+}
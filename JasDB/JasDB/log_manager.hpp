@@ -0,0 +1,132 @@
+//
+//  log_manager.hpp
+//  JasDB
+//
+
+#ifndef log_manager_hpp
+#define log_manager_hpp
+
+#include <stdio.h>
+#include <stdint.h>
+#include <string>
+#include <vector>
+#include <mutex>
+#include <atomic>
+#include <condition_variable>
+#include <unordered_map>
+#include "table_store.hpp"
+
+namespace jasdb{
+
+enum LogType : uint16_t {
+    kLogInsert = 1,  // data is the new row
+    kLogUpdate,      // data is the old row followed by the new row
+    kLogDelete,
+    kLogRestore,     // undo of a delete
+    kLogCommit,
+    kLogAbort,
+    kLogCompact      // vacuum reclaimed the deleted tuples of a block, redo only
+};
+
+// the log is split into segment files of about this size, a checkpoint deletes the old ones
+const uint64_t kLogSegmentSize = 16 * 1024 * 1024;
+
+// Fixed part of every log record, followed by size - sizeof(LogRecordHeader) bytes of data.
+// Rows are logged in their TupleLayout encoding, the same bytes the row store keeps in its pages.
+struct LogRecordHeader {
+    uint64_t txn_id;
+    uint32_t size;
+    uint32_t checksum;
+    uint32_t table_id;
+    uint32_t block;
+    uint32_t slot;
+    uint16_t type;
+    uint16_t reserved;
+};
+
+class LogRecord {
+public:
+    LogRecordHeader header;
+    // LSN of a record is the log position right after it
+    uint64_t lsn;
+    std::string data;
+    Tuple tuple(){
+        Tuple tup;
+        tup.block = header.block;
+        tup.slot = header.slot;
+        return tup;
+    }
+    bool isChange(){
+        return header.type >= kLogInsert && header.type <= kLogRestore;
+    }
+    // changes, and what vacuum did to the blocks
+    bool needsRedo(){
+        return isChange() || header.type == kLogCompact;
+    }
+};
+
+// A log file covering the LSNs from base_lsn up to the base_lsn of the next segment.
+class LogSegment {
+public:
+    uint64_t base_lsn;
+    std::string path;
+};
+
+// Append only redo log, stored as segment files wal.<base LSN> in one directory.
+// Records are collected in memory and written out by flush(lsn). When several sessions commit
+// at the same time, the first one writes and syncs everything appended so far while the others
+// wait for it, so one fsync makes a whole group of commits durable.
+class LogManager {
+public:
+    LogManager();
+    ~LogManager();
+    bool open(std::string dir);
+    void close();
+    // return the LSN of the new record
+    uint64_t append(LogType type, uint64_t txn_id, uint32_t table_id, Tuple* tup, const char* data, uint32_t len);
+    // make every record up to lsn durable
+    bool flush(uint64_t lsn);
+    bool flushAll();
+    // read every complete record, a torn record at the end of the last segment is cut off
+    bool readAll(std::vector<LogRecord*>& records);
+    // delete the segments which only hold records before lsn
+    bool truncate(uint64_t lsn);
+    // drop all records, only allowed when every table is flushed
+    bool reset();
+    uint64_t nextTxnId(){
+        return next_txn_id++;
+    }
+    uint64_t currentLsn(){
+        return next_lsn;
+    }
+    uint64_t syncCount(){
+        return sync_count;
+    }
+    // records of running transactions are needed to undo them, truncate() keeps them
+    void beginTxn(uint64_t txn_id);
+    void endTxn(uint64_t txn_id);
+    uint64_t oldestTxnLsn();
+private:
+    std::string dir;
+    std::vector<LogSegment> segments;
+    // the last segment, records are appended to it
+    int fd;
+    std::mutex latch;
+    std::condition_variable flushed_cond;
+    std::atomic<uint64_t> next_lsn;
+    uint64_t flushed_lsn;
+    bool flushing;
+    std::string buffer;
+    std::unordered_map<uint64_t, uint64_t> active_txns;
+    std::atomic<uint64_t> next_txn_id;
+    std::atomic<uint64_t> sync_count;
+    bool addSegment(uint64_t base_lsn);
+    bool readSegment(LogSegment& segment, bool last, std::vector<LogRecord*>& records);
+    static uint32_t checksum(const LogRecordHeader* header, const char* data, uint32_t len);
+};
+
+extern LogManager global_log_manager;
+
+}
+
+#endif /* log_manager_hpp */
@@ -6,9 +6,44 @@
 //
 
 #include <iostream>
+#include <string>
+#include "parser.hpp"
+#include "optimizer.hpp"
+#include "executor.hpp"
+#include "metadata.hpp"
+
+using namespace jasdb;
 
 int main(int argc, const char * argv[]) {
-    // insert code here...
-    std::cout << "Hello, World!\n";
-    return 0;
+    // only the catalog is read here, table files are mapped and read on demand
+    std::string dir = argc > 1 ? argv[1] : "jasdb_data";
+    if(global_meta_data.open(dir)){
+        return 1;
+    }
+    std::string line;
+    std::cout << "jasdb> " << std::flush;
+    while(std::getline(std::cin, line)){
+        if(line == "exit" || line == "quit"){
+            break;
+        }
+        if(!line.empty()){
+            Parser parser;
+            if(!parser.parseStatement(line)){
+                Optimizer optimizer;
+                for(size_t i=0;i<parser.get_result()->size();i++){
+                    Plan* plan = optimizer.create_plan_tree(parser.get_result()->getStatement(i));
+                    if(plan == NULL){
+                        continue;
+                    }
+                    Executor executor(plan);
+                    executor.init();
+                    executor.exec();
+                    delete executor.op_tree;
+                    delete plan;
+                }
+            }
+        }
+        std::cout << "jasdb> " << std::flush;
+    }
+    return global_meta_data.close() ? 1 : 0;
 }
@@ -6,37 +6,69 @@
 //
 
 #include "metadata.hpp"
+#include "log_manager.hpp"
+#include "transaction.hpp"
+#include "buffer_pool.hpp"
+#include "checkpoint.hpp"
+#include "vacuum.hpp"
+#include "index_builder.hpp"
+#include "worker_pool.hpp"
+#include "btree.hpp"
+#include "hash_index.hpp"
+#include "art_index.hpp"
+#include "external_sort.hpp"
+#include <thread>
+#include <atomic>
+#include <algorithm>
 #include<iostream>
 #include <cstring>
 #include <vector>
+#include <sys/stat.h>
+#include <fstream>
+#include <sstream>
+#include <cstdio>
 
 using namespace hsql;
 
 namespace jasdb{
     MetaData global_meta_data;
-    std::vector<ColumnDefinition*> columns_;
 
-    Table::Table(std::string schema, std::string name,std::vector<ColumnDefinition*>* columns){
-        std::string schema_dup = schema;
-        std::string name_dup = name;
+    Table::Table(std::string schema, std::string name,std::vector<ColumnDefinition*>* columns, StorageType storage, bool create){
+        this->id = 0;
+        this->schema = schema;
+        this->name = name;
+        this->storage = storage;
+        // the column definitions belong to the parser result, so keep our own copy
         for(auto col : *columns){
-            std::vector<ConstraintType>* constraints = new std::vector<ConstraintType>();
-            *constraints = *col->column_constraints;
-            std::string col_name_dup = col->name;
-            ColumnDefinition* col = new ColumnDefinition(col_name_dup,col->type,constraints);
-            col->nullable = col->nullable;
-            columns_.push_back(col);
+            std::unordered_set<ConstraintType>* constraints = new std::unordered_set<ConstraintType>();
+            if(col->column_constraints != NULL){
+                *constraints = *col->column_constraints;
+            }
+            ColumnDefinition* col_dup = new ColumnDefinition(strdup(col->name),col->type,constraints);
+            col_dup->nullable = col->nullable;
+            this->columns.push_back(col_dup);
+        }
+        if(storage == kColumnStorage){
+            table_store = new ColumnStore(&this->columns, global_meta_data.get_data_path(schema, name), create);
+        }
+        else{
+            table_store = new RowStore(&this->columns, global_meta_data.get_data_path(schema, name), create);
         }
-        tableStore_ = new TableStore(&columns_);
     }
     Table::~Table(){
-        
+        delete table_store;
+        for(auto index : indexes){
+            delete index;
+        }
+        for(auto col : columns){
+            delete col;
+        }
     }
     ColumnDefinition* Table::get_column(std::string name){
         if(name.size() == 0){
             return NULL;
         }
-        for(auto col:columns_){
+        for(auto col:columns){
             if(name == col->name){
                 return col;
             }
@@ -48,7 +80,7 @@ namespace jasdb{
         if(name.size() == 0){
             return NULL;
         }
-        for(auto index:indexes_){
+        for(auto index:indexes){
             if(name == index->name){
                 return index;
             }
@@ -56,19 +88,67 @@ namespace jasdb{
         return NULL;
     }
     
+    void Table::add_index(Index* index){
+        std::vector<size_t> col_ids;
+        for(auto col : index->columns){
+            col_ids.push_back(std::find(columns.begin(), columns.end(), col) - columns.begin());
+        }
+        if(index->method == kIndexHash){
+            index->store = new HashIndex(&columns, col_ids);
+        }
+        else if(index->method == kIndexArt){
+            index->store = new ArtIndex(&columns, col_ids);
+        }
+        else{
+            index->store = new BTreeIndex(&columns, col_ids);
+        }
+        for(auto col : index->include){
+            index->store->include_ids.push_back(std::find(columns.begin(), columns.end(), col) - columns.begin());
+        }
+        index->store->path = global_meta_data.get_index_path(schema, name, index->name);
+        indexes.push_back(index);
+        table_store->indexes.push_back(index->store);
+    }
+
+    void Table::remove_index(Index* index){
+        index->store->removeFile();
+        auto& stores = table_store->indexes;
+        stores.erase(std::remove(stores.begin(), stores.end(), index->store), stores.end());
+        indexes.erase(std::remove(indexes.begin(), indexes.end(), index), indexes.end());
+        delete index;
+    }
+    
+    std::string MetaData::get_data_path(std::string schema, std::string name){
+        mkdir(data_dir.c_str(), 0755);
+        return data_dir + "/" + get_table_key(schema, name) + ".tbl";
+    }
+
+    std::string MetaData::get_index_path(std::string schema, std::string name, std::string index_name){
+        return data_dir + "/" + get_table_key(schema, name) + "." + index_name + ".idx";
+    }
+
     bool MetaData::insert_table(Table *table){
+        std::lock_guard<std::mutex> guard(latch);
         if(get_table(table->schema,table->name) != NULL){
             // already have this table
             return true;
         }
         else{
-            TableName table_name;
-            set_table_name(table_name, table->schema, table->name);
+            std::string table_name = get_table_key(table->schema, table->name);
+            if(table->id == 0){
+                table->id = ++next_table_id;
+            }
+            table->table_store->table_id = table->id;
             map_of_table.emplace(table_name,table);
+            if(save_catalog()){
+                // recovery wouldn't know the table, so no statement may change it
+                map_of_table.erase(table_name);
+                return true;
+            }
             return false;
         }
     }
-    bool MetaData::drop_index(std::string name, std::string schema, std::string index_name){
+    bool MetaData::drop_index(std::string schema, std::string name, std::string index_name){
         // get table pointer from shcema based on table name
         Table* table = get_table(schema,name);
         // no this table
@@ -76,15 +156,12 @@ namespace jasdb{
             std::cout<<"Table is not exists"<<std::endl;
             return true;
         }
-        bool res = true;
-        for(auto i=0;i<table->indexes.size();i++){
-            Index* index = table->indexes[i];
-            if(index->name == index_name){
-                table->indexes.erase(table->indexes.begin()+i);
-                res = false;
-            }
+        Index* index = table->get_index(index_name);
+        if(index == NULL){
+            return true;
         }
-        return res;
+        table->remove_index(index);
+        return save_catalog();
     }
 
     bool MetaData::drop_table(std::string schema, std::string name){
@@ -94,19 +171,24 @@ namespace jasdb{
             return true;
         }
         // construct the key which need to be removed from map_of_table from MetaData
-        TableName table_name;
-        
-        // because wo have many shcema, thus we want to indentify a table we need to use schema+name
-        set_table_name(table_name, schema, name);
+        std::string table_name = get_table_key(schema, name);
+        std::lock_guard<std::mutex> guard(latch);
         map_of_table.erase(table_name);
         
         //free this table space, delete [pointer] is freeing space this pointer pointing to
+        global_transaction.forget(table->table_store);
+        global_checkpointer.forget(table->table_store);
+        table->table_store->drop();
+        for(auto index : table->indexes){
+            index->store->removeFile();
+        }
         delete table;
-        return false;
+        return save_catalog();
     }
 
     bool MetaData::drop_schema(std::string schema){
         //delete all tables in this schema
+        std::lock_guard<std::mutex> guard(latch);
         auto iterator = map_of_table.begin();
         bool res = true;
         while(iterator != map_of_table.end()){
@@ -115,6 +197,12 @@ namespace jasdb{
                 // this table in this schema so need to be deleted
                 std::cout<<"Drop table " << table->name << " in schema " << schema << std::endl;
                 iterator = map_of_table.erase(iterator);
+                global_transaction.forget(table->table_store);
+                global_checkpointer.forget(table->table_store);
+                table->table_store->drop();
+                for(auto index : table->indexes){
+                    index->store->removeFile();
+                }
                 delete table;
                 res = false;
             }
@@ -122,6 +210,9 @@ namespace jasdb{
                 iterator++;
             }
         }
+        if(!res){
+            return save_catalog();
+        }
         return res;
     }
     
@@ -152,8 +243,7 @@ namespace jasdb{
             return NULL;
         }
         // construct key
-        TableName table_name;
-        set_table_name(table_name, schema, name);
+        std::string table_name = get_table_key(schema, name);
         auto it = map_of_table.find(table_name);
         if(it == map_of_table.end()){
             return NULL;
@@ -176,5 +266,255 @@ namespace jasdb{
         }
         return NULL;
     }
-}
 
+    // catalog is a text file, one line per table, column and index:
+    // table <id> <schema> <name> <storage> <column count> <dead tuple count>
+    // column <name> <data type> <length> <nullable> <constraint count> <constraints...>
+    // index <name> <column count> <column names...> <method> <included column count> <included column names...>
+    bool MetaData::save_catalog(){
+        std::string path = data_dir + "/catalog";
+        std::string tmp_path = path + ".tmp";
+        mkdir(data_dir.c_str(), 0755);
+        std::ofstream out(tmp_path, std::ios::trunc);
+        out << "jasdb_catalog 1 " << next_table_id << std::endl;
+        for(auto it : map_of_table){
+            Table* table = it.second;
+            out << "table " << table->id << " " << table->schema << " " << table->name << " "
+                << table->storage << " " << table->columns.size() << " " << table->table_store->dead_tuples << std::endl;
+            for(auto col : table->columns){
+                out << "column " << col->name << " " << static_cast<int>(col->type.data_type) << " "
+                    << col->type.length << " " << col->nullable << " " << col->column_constraints->size();
+                for(auto constraint : *col->column_constraints){
+                    out << " " << static_cast<int>(constraint);
+                }
+                out << std::endl;
+            }
+            for(auto index : table->indexes){
+                out << "index " << index->name << " " << index->columns.size();
+                for(auto col : index->columns){
+                    out << " " << col->name;
+                }
+                out << " " << index->method << " " << index->include.size();
+                for(auto col : index->include){
+                    out << " " << col->name;
+                }
+                out << std::endl;
+            }
+        }
+        out.close();
+        // replace the old catalog at once, a crash leaves either the old or the new one.
+        // The directory is synced as well, so the rename and the table files created or removed
+        // before it survive a crash together with the first commit that relies on them
+        if(!out.good() || PageFile::syncPath(tmp_path) || rename(tmp_path.c_str(), path.c_str()) != 0
+           || PageFile::syncPath(data_dir)){
+            std::cout << "Fail to save catalog." << std::endl;
+            return true;
+        }
+        return false;
+    }
+
+    bool MetaData::load_catalog(){
+        std::ifstream in(data_dir + "/catalog");
+        if(!in.is_open()){
+            // new database
+            return false;
+        }
+        std::string line, word;
+        int version = 0;
+        std::getline(in, line);
+        std::istringstream head(line);
+        head >> word >> version >> next_table_id;
+        if(word != "jasdb_catalog" || version != 1){
+            std::cout << "Invalid catalog." << std::endl;
+            return true;
+        }
+        Table* table = NULL;
+        while(std::getline(in, line)){
+            std::istringstream fields(line);
+            fields >> word;
+            if(word == "table"){
+                uint32_t id = 0;
+                int storage = 0;
+                size_t column_count = 0;
+                uint32_t dead_tuples = 0;
+                std::string schema, name;
+                // the deleted tuple count vacuum hasn't reclaimed yet
+                fields >> id >> schema >> name >> storage >> column_count >> dead_tuples;
+                std::vector<ColumnDefinition*> columns;
+                for(size_t i=0;i<column_count && std::getline(in, line);i++){
+                    std::istringstream col_fields(line);
+                    std::string col_name;
+                    int data_type = 0;
+                    int64_t length = 0;
+                    bool nullable = true;
+                    size_t constraint_count = 0;
+                    col_fields >> word >> col_name >> data_type >> length >> nullable >> constraint_count;
+                    std::unordered_set<ConstraintType>* constraints = new std::unordered_set<ConstraintType>();
+                    for(size_t j=0;j<constraint_count;j++){
+                        int constraint = 0;
+                        col_fields >> constraint;
+                        constraints->insert(static_cast<ConstraintType>(constraint));
+                    }
+                    ColumnDefinition* col = new ColumnDefinition(strdup(col_name.c_str()), ColumnType(static_cast<DataType>(data_type), length), constraints);
+                    col->nullable = nullable;
+                    columns.push_back(col);
+                }
+                table = new Table(schema, name, &columns, static_cast<StorageType>(storage), false);
+                table->id = id;
+                table->table_store->table_id = id;
+                table->table_store->dead_tuples = dead_tuples;
+                map_of_table.emplace(get_table_key(schema, name), table);
+                for(auto col : columns){
+                    delete col;
+                }
+            }
+            else if(word == "index" && table != NULL){
+                Index* index = new Index();
+                size_t column_count = 0;
+                fields >> index->name >> column_count;
+                for(size_t i=0;i<column_count;i++){
+                    std::string col_name;
+                    fields >> col_name;
+                    ColumnDefinition* col = table->get_column(col_name);
+                    if(col != NULL){
+                        index->columns.push_back(col);
+                    }
+                }
+                int method = kIndexBTree;
+                fields >> method;
+                index->method = static_cast<IndexMethod>(method);
+                // catalogs written before INCLUDE end after the method
+                size_t include_count = 0;
+                fields >> include_count;
+                for(size_t i=0;i<include_count;i++){
+                    std::string col_name;
+                    fields >> col_name;
+                    ColumnDefinition* col = table->get_column(col_name);
+                    if(col != NULL){
+                        index->include.push_back(col);
+                    }
+                }
+                table->add_index(index);
+                // read the first time a query uses the index, the file is checked then
+                index->store->saved = true;
+            }
+        }
+        return false;
+    }
+
+    bool MetaData::open(std::string dir){
+        data_dir = dir;
+        mkdir(data_dir.c_str(), 0755);
+        ExternalSort::removeRuns(data_dir);
+        if(load_catalog() || global_log_manager.open(data_dir) || recover()){
+            return true;
+        }
+        global_checkpointer.start();
+        global_vacuum.start();
+        global_index_builder.start();
+        global_worker_pool.start();
+        return false;
+    }
+
+    // Redo every logged change the table files don't have yet, then undo the changes
+    // of transactions which neither committed nor rolled back before the crash.
+    // The redo is split by table, and by page for row stores, over several threads.
+    bool MetaData::recover(){
+        std::vector<LogRecord*> records;
+        if(global_log_manager.readAll(records)){
+            return true;
+        }
+        std::unordered_map<uint32_t, TableStore*> stores;
+        for(auto it : map_of_table){
+            stores[it.second->id] = it.second->table_store;
+        }
+        // older records are already in the table files and only kept for the undo
+        uint64_t redo_lsn = Checkpointer::readRedoLsn(data_dir);
+        std::unordered_set<uint64_t> finished;
+        size_t worker_count = std::max(1u, std::min(8u, std::thread::hardware_concurrency()));
+        std::vector<std::vector<std::pair<TableStore*, LogRecord*>>> partitions(worker_count);
+        bool res = false;
+        for(auto record : records){
+            if(record->header.type == kLogCommit || record->header.type == kLogAbort){
+                finished.insert(record->header.txn_id);
+            }
+            // records of dropped tables are skipped
+            auto it = stores.find(record->header.table_id);
+            if(!record->needsRedo() || it == stores.end() || record->lsn < redo_lsn){
+                continue;
+            }
+            if(it->second->prepareRedo(record)){
+                res = true;
+                break;
+            }
+            uint64_t key = (static_cast<uint64_t>(record->header.table_id) << 32) | it->second->redoPartition(record);
+            partitions[std::hash<uint64_t>()(key) % worker_count].push_back(std::make_pair(it->second, record));
+        }
+        if(!res){
+            std::atomic<bool> failed(false);
+            std::vector<std::thread> workers;
+            for(auto& partition : partitions){
+                workers.push_back(std::thread([&partition, &failed](){
+                    for(auto& change : partition){
+                        if(change.first->redo(change.second)){
+                            failed = true;
+                            return;
+                        }
+                    }
+                }));
+            }
+            for(auto& worker : workers){
+                worker.join();
+            }
+            res = failed;
+        }
+        if(!res){
+            for(auto rit = records.rbegin(); rit != records.rend(); rit++){
+                LogRecord* record = *rit;
+                auto it = stores.find(record->header.table_id);
+                if(record->isChange() && it != stores.end() && finished.count(record->header.txn_id) == 0){
+                    Tuple tup = record->tuple();
+                    Transaction::undo(it->second, static_cast<LogType>(record->header.type), &tup, record->data.data());
+                }
+            }
+        }
+        if(!records.empty() && !res){
+            std::cout << "Recovered " << records.size() << " log records." << std::endl;
+        }
+        for(auto record : records){
+            delete record;
+        }
+        if(res){
+            std::cout << "Recovery failed." << std::endl;
+            return true;
+        }
+        // every table has all the changes now, the log can start over
+        return close();
+    }
+
+    bool MetaData::close(){
+        global_index_builder.stop();
+        global_worker_pool.stop();
+        global_vacuum.stop();
+        global_checkpointer.stop();
+        bool res = global_log_manager.flushAll();
+        for(auto it : map_of_table){
+            if(it.second->table_store->flush()){
+                res = true;
+            }
+            // the next start reads the indexes in use from their files instead of the tables
+            for(auto index : it.second->indexes){
+                if(index->store->built && !index->store->saved && index->store->save()){
+                    res = true;
+                }
+            }
+        }
+        if(save_catalog()){
+            res = true;
+        }
+        if(!res){
+            res = global_log_manager.reset();
+        }
+        return res;
+    }
+}
@@ -12,7 +12,12 @@
 #include <cstring>
 #include "sql-parser-master/src/sql/CreateStatement.h"
 #include "sql-parser-master/src/sql/Table.h"
+#include "table_store.hpp"
+#include "column_store.hpp"
+#include "index_store.hpp"
 #include <unordered_map>
+#include <unordered_set>
+#include <mutex>
 
 using namespace hsql;
 
@@ -21,30 +26,50 @@ namespace jasdb {
     public:
         std::string name;
         std::vector<ColumnDefinition*> columns;
-        Index(){}
+        // columns of INCLUDE, stored in the entries but not part of the key
+        std::vector<ColumnDefinition*> include;
+        IndexMethod method;
+        // the entries, filled from the table the first time the index is used
+        IndexStore* store;
+        Index() : method(kIndexBTree), store(NULL){}
+        ~Index(){
+            delete store;
+        }
     };
 
     class Table {
     public:
+        uint32_t id;
         std::string schema;
         std::string name;
         std::vector<ColumnDefinition*> columns;
         std::vector<Index*> indexes;
+        StorageType storage;
         TableStore* table_store;
-        Table(std::string schema, std::string name,std::vector<ColumnDefinition*>* columns);
+        // create is false when the table is opened from the catalog
+        Table(std::string schema, std::string name,std::vector<ColumnDefinition*>* columns, StorageType storage = kRowStorage, bool create = true);
         ~Table();
         ColumnDefinition* get_column(std::string name);
         Index* get_index(std::string name);
-        void add_index(Index* index){
-            indexes.push_back(index);
+        TableStore* getTableStore(){
+            return table_store;
         }
+        // the table store keeps the index up to date from now on
+        void add_index(Index* index);
+        void remove_index(Index* index);
     };
     
     class MetaData{
     public:
-        std::unordered_map<TableName, Table*> map_of_table;
+        std::unordered_map<std::string, Table*> map_of_table;
+        // directory holding the catalog and the data files of all tables
+        std::string data_dir;
+        uint32_t next_table_id;
+        // held while tables are added or dropped, and by checkpoints while they look a table up
+        std::mutex latch;
         MetaData(){
-            
+            data_dir = "jasdb_data";
+            next_table_id = 0;
         }
         ~MetaData(){
             
@@ -52,12 +77,24 @@ namespace jasdb {
         bool insert_table(Table* table);
         bool drop_table(std::string schema, std::string name);
         bool drop_schema(std::string schema);
-        bool drop_index(std::string name, std::string schema, std::string index_name);
+        bool drop_index(std::string schema, std::string name, std::string index_name);
         void get_all_tables(std::vector<Table*>* tables);
         bool find_schema(std::string schema);
         Table* get_table(std::string schema, std::string name);
         Index* get_index(std::string schema, std::string name, std::string index_name);
-        void set_table_name(TableName table_name,std::string schema, std::string name){};
+        // because wo have many shcema, thus we want to indentify a table we need to use schema+name
+        std::string get_table_key(std::string schema, std::string name){
+            return schema + "." + name;
+        }
+        std::string get_data_path(std::string schema, std::string name);
+        std::string get_index_path(std::string schema, std::string name, std::string index_name);
+        // open the database in dir, only the catalog is read here
+        bool open(std::string dir);
+        // write back every table and the catalog, the log is emptied afterwards
+        bool close();
+        bool recover();
+        bool save_catalog();
+        bool load_catalog();
     };
     extern MetaData global_meta_data;
 }
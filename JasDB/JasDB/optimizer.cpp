@@ -7,6 +7,9 @@
 
 #include "optimizer.hpp"
 #include <iostream>
+#include <strings.h>
+#include <utility>
+#include <algorithm>
 using namespace hsql;
 
 namespace jasdb{
@@ -45,6 +48,15 @@ Plan* Optimizer::create_create_plan_tree(const CreateStatement *stmt){
     plan->columns = stmt->columns;
     plan->next = NULL;
     
+    // CREATE TABLE ... WITH (storage = column)
+    if(stmt->tableOptions != NULL){
+        for(auto option : *stmt->tableOptions){
+            if(strcasecmp(option->name, "storage") == 0 && strcasecmp(option->value, "column") == 0){
+                plan->storage = kColumnStorage;
+            }
+        }
+    }
+    
     // Create index for an existed table
     if(plan->type == kCreateIndex){
         Table* table = global_meta_data.get_table(plan->schema, plan->tableName);
@@ -53,6 +65,13 @@ Plan* Optimizer::create_create_plan_tree(const CreateStatement *stmt){
             delete plan;
             return NULL;
         }
+        if(stmt->indexMethod != NULL && strcasecmp(stmt->indexMethod, "hash") == 0){
+            plan->indexMethod = kIndexHash;
+        }
+        else if(stmt->indexMethod != NULL && strcasecmp(stmt->indexMethod, "art") == 0){
+            plan->indexMethod = kIndexArt;
+        }
+        plan->concurrently = stmt->concurrently;
         if(stmt->indexColumns != NULL){
             plan->indexColumns = new std::vector<ColumnDefinition*>;
         }
@@ -60,12 +79,23 @@ Plan* Optimizer::create_create_plan_tree(const CreateStatement *stmt){
             ColumnDefinition* col_def = table->get_column(column_name);
             if(col_def == NULL){
                 std::cout << "Column not found." << std::endl;
-                delete plan->indexColumns;
                 delete plan;
                 return NULL;
             }
             plan->indexColumns->push_back(col_def);
         }
+        if(stmt->indexInclude != NULL){
+            plan->indexInclude = new std::vector<ColumnDefinition*>;
+            for(auto column_name : *stmt->indexInclude){
+                ColumnDefinition* col_def = table->get_column(column_name);
+                if(col_def == NULL){
+                    std::cout << "Column not found." << std::endl;
+                    delete plan;
+                    return NULL;
+                }
+                plan->indexInclude->push_back(col_def);
+            }
+        }
         return plan;
     }
     
@@ -87,7 +117,7 @@ Plan* Optimizer::create_insert_plan_tree(const InsertStatement *stmt){
     InsertPlan* plan = new InsertPlan();
     plan->type = stmt->type;
     plan->table = global_meta_data.get_table(stmt->schema, stmt->tableName);
-    plan->values = stmt->values;
+    plan->rows = stmt->valuesList;
     return plan;
 }
 
@@ -98,13 +128,16 @@ Plan* Optimizer::create_update_plan_tree(const UpdateStatement *stmt){
     scan->table = table;
     Plan* plan = scan;
     if(stmt->where != NULL){
-        Plan* filter = create_filter_plan_tree(table->columns, stmt->where);
-        filter->next = plan;
-        plan = filter;
+        scan->filter = create_scan_filter(table->columns, stmt->where);
+        if(scan->filter == NULL){
+            delete scan;
+            return NULL;
+        }
+        choose_index_scan(table, scan);
     }
     UpdatePlan* update_plan = new UpdatePlan();
     update_plan->table = table;
-    // Update->Filter->Scan
+    // Update->Scan, the scan filters the tuples
     update_plan->next = plan;
 
     for(auto update : *stmt->updates){
@@ -112,7 +145,7 @@ Plan* Optimizer::create_update_plan_tree(const UpdateStatement *stmt){
         update_plan->values.push_back(update->value);
         for(auto col : table->columns){
             // char* string
-            if(update->column == col->name){
+            if(strcmp(update->column, col->name) == 0){
                 // which index to be updated
                 update_plan->indexes.push_back(idx);
                 break;
@@ -133,14 +166,17 @@ Plan* Optimizer::create_delete_plan_tree(const DeleteStatement *stmt){
     Plan* plan = scan;
     
     if(stmt->expr != NULL){
-        Plan* filter = create_filter_plan_tree(table->columns, stmt->expr);
-        filter->next = plan;
-        plan = filter;
+        scan->filter = create_scan_filter(table->columns, stmt->expr);
+        if(scan->filter == NULL){
+            delete scan;
+            return NULL;
+        }
+        choose_index_scan(table, scan);
     }
     
     DeletePlan* del_plan = new DeletePlan();
     del_plan->table = table;
-    // Delete->Filter->Scan
+    // Delete->Scan, the scan filters the tuples
     del_plan->next = plan;
     return del_plan;
 }
@@ -153,13 +189,15 @@ Plan* Optimizer::create_select_plan_tree(const SelectStatement *stmt){
     scan->table = table;
     Plan* plan = scan;
     if(stmt->whereClause != NULL){
-        Plan* filter = create_filter_plan_tree(columns, stmt->whereClause);
-        filter->next = plan;
-        plan = filter;
+        scan->filter = create_scan_filter(columns, stmt->whereClause);
+        if(scan->filter == NULL){
+            delete scan;
+            return NULL;
+        }
     }
     SelectPlan* select_plan = new SelectPlan();
     select_plan->table = table;
-    // Select->Filter->Scan
+    // Select->Scan, the scan filters the tuples
     select_plan->next = plan;
     
     for(auto expr:*stmt->selectList){
@@ -182,32 +220,185 @@ Plan* Optimizer::create_select_plan_tree(const SelectStatement *stmt){
             }
         }
     }
+    // the scan only needs to decode the output columns, the filter works on the stored bytes
+    scan->col_ids = select_plan->col_ids;
+    if(stmt->order != NULL){
+        // Select->Sort->Scan, the scan also decodes the sort columns
+        SortPlan* sort = new SortPlan();
+        sort->table = table;
+        sort->next = plan;
+        select_plan->next = sort;
+        for(auto order : *stmt->order){
+            size_t idx = 0;
+            while(idx < columns.size() && strcmp(order->expr->name, columns[idx]->name) != 0){
+                idx++;
+            }
+            if(idx == columns.size()){
+                std::cout << "Column not found." << std::endl;
+                delete select_plan;
+                return NULL;
+            }
+            sort->keys.push_back(idx);
+            sort->descending.push_back(order->type == kOrderDesc);
+            if(std::find(scan->col_ids.begin(), scan->col_ids.end(), idx) == scan->col_ids.end()){
+                scan->col_ids.push_back(idx);
+            }
+        }
+        sort->col_ids = scan->col_ids;
+    }
+    if(scan->filter != NULL){
+        // an index holding the output columns may answer the query alone
+        choose_index_scan(table, scan);
+    }
+    // update and delete change the table while they scan it, they stay on one thread
+    scan->parallel = scan->type == kSeqScan;
     return select_plan;
 }
 
-// used to 'where' like "where id = 1"
-// FilterPlan contains the filter information
-Plan* Optimizer::create_filter_plan_tree(std::vector<ColumnDefinition *> columns, Expr *where){
-    FilterPlan* filter = new FilterPlan();
-    Expr* col = NULL;
-    Expr* val = NULL;
-    if(where->expr->type == kExprColumnRef){
-        col = where->expr;
-        val = where->expr2;
+// WHERE clauses made of comparisons between a column and a literal, joined by AND,
+// are pushed down into the scan. return NULL for anything else
+ScanFilter* Optimizer::create_scan_filter(std::vector<ColumnDefinition *> columns, Expr *where){
+    ScanFilter* filter = new ScanFilter();
+    if(add_scan_predicates(columns, where, filter)){
+        std::cout << "Not support where clause." << std::endl;
+        delete filter;
+        return NULL;
+    }
+    return filter;
+}
+
+static bool literal_value(Expr* expr, ExprType* type, int64_t* ival, const char** sval){
+    if(expr->type == kExprOperator && expr->opType == kOpUnaryMinus && expr->expr != NULL && expr->expr->type == kExprLiteralInt){
+        *type = kExprLiteralInt;
+        *ival = -expr->expr->ival;
+        return true;
+    }
+    if(expr->type == kExprLiteralInt || expr->type == kExprLiteralString){
+        *type = expr->type;
+        *ival = expr->ival;
+        *sval = expr->name;
+        return true;
+    }
+    return false;
+}
+
+// return true if where is not supported
+bool Optimizer::add_scan_predicates(std::vector<ColumnDefinition *>& columns, Expr *where, ScanFilter* filter){
+    if(where->type != kExprOperator){
+        return true;
     }
-    else{
-        col = where->expr2;
-        val = where->expr;
+    if(where->opType == kOpAnd){
+        return add_scan_predicates(columns, where->expr, filter) || add_scan_predicates(columns, where->expr2, filter);
     }
-    // get the index of column which need to be filtered out
-    for(auto i=0;i<columns.size();i++){
-        ColumnDefinition* col_def = columns[i];
-        if(strcmp(col->name, col_def->name) == 0){
-            filter->idx = i;
+    if(where->opType == kOpBetween){
+        // col BETWEEN a AND b is col >= a AND col <= b
+        if(where->exprList == NULL || where->exprList->size() != 2){
+            return true;
+        }
+        return add_scan_predicate(columns, where->expr, kOpGreaterEq, (*where->exprList)[0], filter)
+            || add_scan_predicate(columns, where->expr, kOpLessEq, (*where->exprList)[1], filter);
+    }
+    return add_scan_predicate(columns, where->expr, where->opType, where->expr2, filter);
+}
+
+bool Optimizer::add_scan_predicate(std::vector<ColumnDefinition *>& columns, Expr* col, OperatorType op, Expr* val, ScanFilter* filter){
+    if(op != kOpEquals && op != kOpNotEquals && op != kOpLess && op != kOpLessEq && op != kOpGreater && op != kOpGreaterEq && op != kOpLike){
+        return true;
+    }
+    if(col == NULL || val == NULL){
+        return true;
+    }
+    if(col->type != kExprColumnRef){
+        if(op == kOpLike){
+            // the pattern has to be on the right
+            return true;
+        }
+        // value op column, turn it around
+        std::swap(col, val);
+        switch (op) {
+            case kOpLess: op = kOpGreater; break;
+            case kOpLessEq: op = kOpGreaterEq; break;
+            case kOpGreater: op = kOpLess; break;
+            case kOpGreaterEq: op = kOpLessEq; break;
+            default: break;
+        }
+    }
+    ExprType type;
+    int64_t ival = 0;
+    const char* sval = NULL;
+    if(col->type != kExprColumnRef || !literal_value(val, &type, &ival, &sval)){
+        return true;
+    }
+    for(size_t i=0;i<columns.size();i++){
+        if(strcmp(col->name, columns[i]->name) == 0){
+            ScanPredicate predicate(i, columns[i], op);
+            predicate.prepare(type, ival, sval);
+            filter->predicates.push_back(predicate);
+            return false;
+        }
+    }
+    std::cout << "Column not found." << std::endl;
+    return true;
+}
+
+// Use an index whose leftmost columns have = predicates, followed by at most one column with
+// an =, <, <=, >, >= or LIKE 'prefix%' predicate, all of them narrow one range of keys.
+// More key columns with an equality win, then a range on the next one, then an index covering
+// every column the scan reads, which is scanned without the table. A hash index is only used when
+// every key column has an equality, and beats an ordered index with the same columns otherwise.
+// The filter keeps every predicate and checks what the index returns. Indexes still being built are skipped.
+void Optimizer::choose_index_scan(Table* table, ScanPlan* scan){
+    if(scan->filter == NULL || !scan->filter->matchable()){
+        return;
+    }
+    int best = 0;
+    for(auto index : table->indexes){
+        if(index->store->building){
+            continue;
+        }
+        IndexRange range;
+        size_t used_columns = 0;
+        size_t equal_columns = 0;
+        for(auto col : index->columns){
+            size_t idx = std::find(table->columns.begin(), table->columns.end(), col) - table->columns.begin();
+            IndexRange column_range;
+            bool usable = false;
+            for(auto& predicate : scan->filter->predicates){
+                if(predicate.idx != idx || predicate.op == kOpNotEquals || column_range.restrict(predicate)){
+                    continue;
+                }
+                usable = true;
+            }
+            if(!usable){
+                break;
+            }
+            range.append(column_range);
+            used_columns++;
+            if(!column_range.isPoint()){
+                break;
+            }
+            equal_columns++;
+        }
+        if(used_columns == 0){
+            continue;
+        }
+        if(equal_columns < index->columns.size()){
+            // the bounds only cover the leading columns of a key
+            range.lower_partial = range.upper_partial = true;
+        }
+        if(!index->store->ordered() && !range.isPoint()){
+            continue;
+        }
+        bool index_only = index->store->returnsEntries() && index->store->covers(scan->col_ids, scan->filter);
+        int score = static_cast<int>(equal_columns * 8 + (used_columns - equal_columns) * 4) + (index_only ? 2 : 0) + (index->store->ordered() ? 0 : 1);
+        if(score > best){
+            scan->type = kIndexScan;
+            scan->index = index;
+            scan->range = range;
+            scan->index_only = index_only;
+            best = score;
         }
     }
-    filter->val = val;
-    return filter;
 }
 
 Plan* Optimizer::create_trx_plan_tree(const TransactionStatement *stmt){
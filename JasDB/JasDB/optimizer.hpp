@@ -24,7 +24,6 @@ enum planType{
     kSelect,
     kScan,
     kProjection,
-    kFilter,
     kSort,
     kLimit,
     kTrx,
@@ -39,7 +38,7 @@ public:
         plan_type = t;
         next = NULL;
     }
-    ~Plan(){
+    virtual ~Plan(){
         delete next;
         next = NULL;
     }
@@ -49,13 +48,28 @@ class CreatePlan : public Plan{
 public:
     CreateType type; // to specify what kind of create create index table or schema
     bool ifNotExist;
+    // build the index in the background
+    bool concurrently;
     char* schema;
     char* tableName;
     char* indexName;
     std::vector<ColumnDefinition*>* indexColumns;
+    // columns of INCLUDE, NULL without
+    std::vector<ColumnDefinition*>* indexInclude;
+    IndexMethod indexMethod;
     std::vector<ColumnDefinition*>* columns;
+    StorageType storage;
     CreatePlan(CreateType t) : Plan(kCreate){
         type = t;
+        storage = kRowStorage;
+        indexMethod = kIndexBTree;
+        indexColumns = NULL;
+        indexInclude = NULL;
+        concurrently = false;
+    }
+    ~CreatePlan(){
+        delete indexColumns;
+        delete indexInclude;
     }
 };
 
@@ -73,7 +87,8 @@ class InsertPlan : public Plan {
 public:
     InsertType type;
     Table* table;
-    std::vector<Expr*>* values;
+    // every row of the VALUES list
+    std::vector<std::vector<Expr*>*>* rows;
     InsertPlan() : Plan(kInsert){}
 };
 
@@ -108,20 +123,31 @@ class ScanPlan : public Plan {
 public:
     scanType type;
     Table* table;
-    ScanPlan() : Plan(kScan){}
-};
-
-class FilterPlan : public Plan {
-public:
-    size_t idx;
-    Expr* val;
-    FilterPlan() : Plan(kFilter), idx(0), val(NULL){}
+    // columns the scan puts into its batches, update and delete read none
+    std::vector<size_t> col_ids;
+    // evaluated by the table store, NULL means every tuple
+    ScanFilter* filter;
+    // an index scan reads the tuples of index inside range, the filter still checks each of them
+    Index* index;
+    IndexRange range;
+    // the index holds every column the scan reads, its entries are decoded instead of the tuples
+    bool index_only;
+    // a sequential scan of a select, its morsels may be read by several threads
+    bool parallel;
+    ScanPlan() : Plan(kScan), type(kSeqScan), filter(NULL), index(NULL), index_only(false), parallel(false){}
+    ~ScanPlan(){
+        delete filter;
+    }
 };
 
 class SortPlan : public Plan {
 public:
     Table* table;
-    std::vector<OrderDescription*> order;
+    // columns the scan below reads, the sort carries them along
+    std::vector<size_t> col_ids;
+    // columns of ORDER BY, most significant first
+    std::vector<size_t> keys;
+    std::vector<bool> descending;
     SortPlan() : Plan(kSort){}
 };
 
@@ -156,7 +182,10 @@ public:
     Plan* create_update_plan_tree(const UpdateStatement* stmt);
     Plan* create_delete_plan_tree(const DeleteStatement* stmt);
     Plan* create_select_plan_tree(const SelectStatement* stmt);
-    Plan* create_filter_plan_tree(std::vector<ColumnDefinition*> columns, Expr* where);
+    ScanFilter* create_scan_filter(std::vector<ColumnDefinition*> columns, Expr* where);
+    bool add_scan_predicates(std::vector<ColumnDefinition*>& columns, Expr* where, ScanFilter* filter);
+    bool add_scan_predicate(std::vector<ColumnDefinition*>& columns, Expr* col, OperatorType op, Expr* val, ScanFilter* filter);
+    void choose_index_scan(Table* table, ScanPlan* scan);
     Plan* create_trx_plan_tree(const TransactionStatement* stmt);
     Plan* create_show_plan_tree(const ShowStatement* stmt);
 };
@@ -8,6 +8,8 @@
 #include "parser.hpp"
 #include "util.h"
 #include <iostream>
+#include <strings.h>
+#include <cstring>
 using namespace hsql;
 
 namespace jasdb{
@@ -105,6 +107,10 @@ namespace jasdb{
         }
         if(stmt->order != NULL){
             for(auto o:*stmt->order){
+                if(o->expr->type != kExprColumnRef){
+                    std::cout<<"Not support 'order by' expressions."<<std::endl;
+                    return true;
+                }
                 if(check_expression(table, o->expr)){
                     return true;
                 }
@@ -124,6 +130,7 @@ namespace jasdb{
     bool Parser::check_insert_stmt(const InsertStatement *stmt){
         if(stmt->type == kInsertSelect){
             std::cout << "Do not support 'INSERT INTO ... SELECT ...' now."<< std::endl;
+            return true;
         }
         Table* table = global_meta_data.get_table(stmt->schema, stmt->tableName);
         if(table == NULL){
@@ -138,39 +145,50 @@ namespace jasdb{
                 }
             }
         }
-        std::vector<Expr*> inserted_values;
+        // position in a VALUES row of every column, -1 when the column isn't given
+        std::vector<int> positions;
         for(auto i=0;i<table->columns.size();i++){
             auto col_def = table->columns[i];
             if(stmt->columns != NULL){
-                auto j = 0;
+                int j = 0;
                 for(;j<stmt->columns->size();j++){
-                    if(col_def->name == (*stmt->columns)[j]){
+                    if(strcmp(col_def->name, (*stmt->columns)[j]) == 0){
                         break;
                     }
                 }
-                if(j<stmt->columns->size()){
-                    inserted_values.push_back((*stmt->values)[j]);
-                }
-                else{
-                    Expr* expr = new Expr(kExprLiteralNull);
-                    inserted_values.push_back(expr);
-                }
+                positions.push_back(j<stmt->columns->size() ? j : -1);
             }
             else{
-                if(i<stmt->values->size()){
-                    inserted_values.push_back((*stmt->values)[i]);
+                positions.push_back(i);
+            }
+        }
+        // every row of INSERT ... VALUES (...), (...) has one value per listed column, or per table column
+        // without a list, so all rows are checked against the same positions
+        size_t value_count = stmt->columns != NULL ? stmt->columns->size() : table->columns.size();
+        for(auto values : *stmt->valuesList){
+            if(values->size() != value_count){
+                std::cout << "Column count doesn't match value count." << std::endl;
+                return true;
+            }
+        }
+        for(auto values : *stmt->valuesList){
+            std::vector<Expr*> inserted_values;
+            for(auto pos : positions){
+                // table columns missing from the list are NULL
+                if(pos >= 0){
+                    inserted_values.push_back((*values)[pos]);
                 }
                 else{
                     Expr* expr = new Expr(kExprLiteralNull);
                     inserted_values.push_back(expr);
                 }
             }
-        }
-        stmt->values->assign(inserted_values.begin(), inserted_values.end());
-        
-        // check if each value match column value constraints
-        if(check_values(table->columns, stmt->values)){
-            return true;
+            values->assign(inserted_values.begin(), inserted_values.end());
+            
+            // check if each value match column value constraints
+            if(check_values(table->columns, values)){
+                return true;
+            }
         }
         return false;
     }
@@ -267,7 +285,7 @@ namespace jasdb{
         return false;
     }
 
-    bool Parser::check_values(std::vector<ColumnDefinition*> columns, std::vector<Expr*>* values){
+    bool Parser::check_values(std::vector<ColumnDefinition*>& columns, std::vector<Expr*>* values){
         for(auto i=0;i<columns.size();i++){
             auto col_def = columns[i];
             auto expr = (*values)[i];
@@ -355,21 +373,69 @@ namespace jasdb{
             }
         }
         
+        bool column_storage = false;
+        if(stmt->tableOptions != NULL){
+            for(auto option : *stmt->tableOptions){
+                if(strcasecmp(option->name, "storage") != 0){
+                    std::cout << "Table option is not supported." << std::endl;
+                    return true;
+                }
+                if(strcasecmp(option->value, "column") == 0){
+                    column_storage = true;
+                }
+                else if(strcasecmp(option->value, "row") != 0){
+                    std::cout << "Storage type is not supported." << std::endl;
+                    return true;
+                }
+            }
+        }
+        
+        // a row has to fit into one page, the column store has no such limit
+        if(!column_storage && TupleLayout::tupleSize(stmt->columns) > RowStore::maxTupleSize()){
+            std::cout << "Row size is too large." << std::endl;
+            return true;
+        }
+        
         return false;
     }
 
     bool Parser::check_create_index_stmt(const CreateStatement *stmt){
+        if(stmt->schema == NULL || stmt->tableName == NULL || stmt->indexName == NULL){
+            std::cout << "Need to specify schema, table name and index name" << std::endl;
+            return true;
+        }
         if(global_meta_data.get_index(stmt->schema, stmt->tableName, stmt->indexName) != NULL && !stmt->ifNotExists){
             std::cout << "This index already existed." << std::endl;
             return true;
         }
         // check if each column this index need exist or not
         Table* table = global_meta_data.get_table(stmt->schema, stmt->tableName);
+        if(table == NULL){
+            std::cout << "Table not found." << std::endl;
+            return true;
+        }
+        if(stmt->indexMethod != NULL && strcasecmp(stmt->indexMethod, "btree") != 0 && strcasecmp(stmt->indexMethod, "hash") != 0
+           && strcasecmp(stmt->indexMethod, "art") != 0){
+            std::cout << "Index method is not supported." << std::endl;
+            return true;
+        }
         for(auto col : *stmt->indexColumns){
             if(check_column(table, col)){
                 return true;
             }
         }
+        if(stmt->indexInclude != NULL){
+            // hash and ART indexes can't return their keys, only a B+tree scan reads included columns
+            if(stmt->indexMethod != NULL && strcasecmp(stmt->indexMethod, "btree") != 0){
+                std::cout << "INCLUDE is only supported by B+tree indexes." << std::endl;
+                return true;
+            }
+            for(auto col : *stmt->indexInclude){
+                if(check_column(table, col)){
+                    return true;
+                }
+            }
+        }
         return false;
     }
 
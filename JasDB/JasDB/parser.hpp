@@ -39,7 +39,7 @@ namespace jasdb{
         Table* get_table(TableRef* table_ref);
         bool check_column(Table* table, std::string column_name);
         bool check_expression(Table* table, Expr* expr);
-        bool check_values(std::vector<ColumnDefinition*> columns,std::vector<Expr*>* values);
+        bool check_values(std::vector<ColumnDefinition*>& columns,std::vector<Expr*>* values);
     };
 }
 
@@ -339,111 +339,120 @@ enum yysymbol_kind_t
   YYSYMBOL_export_statement = 204,         /* export_statement  */
   YYSYMBOL_show_statement = 205,           /* show_statement  */
   YYSYMBOL_create_statement = 206,         /* create_statement  */
-  YYSYMBOL_opt_not_exists = 207,           /* opt_not_exists  */
-  YYSYMBOL_table_elem_commalist = 208,     /* table_elem_commalist  */
-  YYSYMBOL_table_elem = 209,               /* table_elem  */
-  YYSYMBOL_column_def = 210,               /* column_def  */
-  YYSYMBOL_column_type = 211,              /* column_type  */
-  YYSYMBOL_opt_time_precision = 212,       /* opt_time_precision  */
-  YYSYMBOL_opt_decimal_specification = 213, /* opt_decimal_specification  */
-  YYSYMBOL_opt_column_constraints = 214,   /* opt_column_constraints  */
-  YYSYMBOL_column_constraint_set = 215,    /* column_constraint_set  */
-  YYSYMBOL_column_constraint = 216,        /* column_constraint  */
-  YYSYMBOL_table_constraint = 217,         /* table_constraint  */
-  YYSYMBOL_drop_statement = 218,           /* drop_statement  */
-  YYSYMBOL_opt_exists = 219,               /* opt_exists  */
-  YYSYMBOL_alter_statement = 220,          /* alter_statement  */
-  YYSYMBOL_alter_action = 221,             /* alter_action  */
-  YYSYMBOL_drop_action = 222,              /* drop_action  */
-  YYSYMBOL_delete_statement = 223,         /* delete_statement  */
-  YYSYMBOL_truncate_statement = 224,       /* truncate_statement  */
-  YYSYMBOL_insert_statement = 225,         /* insert_statement  */
-  YYSYMBOL_opt_column_list = 226,          /* opt_column_list  */
-  YYSYMBOL_update_statement = 227,         /* update_statement  */
-  YYSYMBOL_update_clause_commalist = 228,  /* update_clause_commalist  */
-  YYSYMBOL_update_clause = 229,            /* update_clause  */
-  YYSYMBOL_select_statement = 230,         /* select_statement  */
-  YYSYMBOL_select_within_set_operation = 231, /* select_within_set_operation  */
-  YYSYMBOL_select_within_set_operation_no_parentheses = 232, /* select_within_set_operation_no_parentheses  */
-  YYSYMBOL_select_with_paren = 233,        /* select_with_paren  */
-  YYSYMBOL_select_no_paren = 234,          /* select_no_paren  */
-  YYSYMBOL_set_operator = 235,             /* set_operator  */
-  YYSYMBOL_set_type = 236,                 /* set_type  */
-  YYSYMBOL_opt_all = 237,                  /* opt_all  */
-  YYSYMBOL_select_clause = 238,            /* select_clause  */
-  YYSYMBOL_opt_distinct = 239,             /* opt_distinct  */
-  YYSYMBOL_select_list = 240,              /* select_list  */
-  YYSYMBOL_opt_from_clause = 241,          /* opt_from_clause  */
-  YYSYMBOL_from_clause = 242,              /* from_clause  */
-  YYSYMBOL_opt_where = 243,                /* opt_where  */
-  YYSYMBOL_opt_group = 244,                /* opt_group  */
-  YYSYMBOL_opt_having = 245,               /* opt_having  */
-  YYSYMBOL_opt_order = 246,                /* opt_order  */
-  YYSYMBOL_order_list = 247,               /* order_list  */
-  YYSYMBOL_order_desc = 248,               /* order_desc  */
-  YYSYMBOL_opt_order_type = 249,           /* opt_order_type  */
-  YYSYMBOL_opt_top = 250,                  /* opt_top  */
-  YYSYMBOL_opt_limit = 251,                /* opt_limit  */
-  YYSYMBOL_expr_list = 252,                /* expr_list  */
-  YYSYMBOL_opt_literal_list = 253,         /* opt_literal_list  */
-  YYSYMBOL_literal_list = 254,             /* literal_list  */
-  YYSYMBOL_expr_alias = 255,               /* expr_alias  */
-  YYSYMBOL_expr = 256,                     /* expr  */
-  YYSYMBOL_operand = 257,                  /* operand  */
-  YYSYMBOL_scalar_expr = 258,              /* scalar_expr  */
-  YYSYMBOL_unary_expr = 259,               /* unary_expr  */
-  YYSYMBOL_binary_expr = 260,              /* binary_expr  */
-  YYSYMBOL_logic_expr = 261,               /* logic_expr  */
-  YYSYMBOL_in_expr = 262,                  /* in_expr  */
-  YYSYMBOL_case_expr = 263,                /* case_expr  */
-  YYSYMBOL_case_list = 264,                /* case_list  */
-  YYSYMBOL_exists_expr = 265,              /* exists_expr  */
-  YYSYMBOL_comp_expr = 266,                /* comp_expr  */
-  YYSYMBOL_function_expr = 267,            /* function_expr  */
-  YYSYMBOL_extract_expr = 268,             /* extract_expr  */
-  YYSYMBOL_cast_expr = 269,                /* cast_expr  */
-  YYSYMBOL_datetime_field = 270,           /* datetime_field  */
-  YYSYMBOL_datetime_field_plural = 271,    /* datetime_field_plural  */
-  YYSYMBOL_duration_field = 272,           /* duration_field  */
-  YYSYMBOL_array_expr = 273,               /* array_expr  */
-  YYSYMBOL_array_index = 274,              /* array_index  */
-  YYSYMBOL_between_expr = 275,             /* between_expr  */
-  YYSYMBOL_column_name = 276,              /* column_name  */
-  YYSYMBOL_literal = 277,                  /* literal  */
-  YYSYMBOL_string_literal = 278,           /* string_literal  */
-  YYSYMBOL_bool_literal = 279,             /* bool_literal  */
-  YYSYMBOL_num_literal = 280,              /* num_literal  */
-  YYSYMBOL_int_literal = 281,              /* int_literal  */
-  YYSYMBOL_null_literal = 282,             /* null_literal  */
-  YYSYMBOL_date_literal = 283,             /* date_literal  */
-  YYSYMBOL_interval_literal = 284,         /* interval_literal  */
-  YYSYMBOL_param_expr = 285,               /* param_expr  */
-  YYSYMBOL_table_ref = 286,                /* table_ref  */
-  YYSYMBOL_table_ref_atomic = 287,         /* table_ref_atomic  */
-  YYSYMBOL_nonjoin_table_ref_atomic = 288, /* nonjoin_table_ref_atomic  */
-  YYSYMBOL_table_ref_commalist = 289,      /* table_ref_commalist  */
-  YYSYMBOL_table_ref_name = 290,           /* table_ref_name  */
-  YYSYMBOL_table_ref_name_no_alias = 291,  /* table_ref_name_no_alias  */
-  YYSYMBOL_table_name = 292,               /* table_name  */
-  YYSYMBOL_opt_index_name = 293,           /* opt_index_name  */
-  YYSYMBOL_table_alias = 294,              /* table_alias  */
-  YYSYMBOL_opt_table_alias = 295,          /* opt_table_alias  */
-  YYSYMBOL_alias = 296,                    /* alias  */
-  YYSYMBOL_opt_alias = 297,                /* opt_alias  */
-  YYSYMBOL_opt_locking_clause = 298,       /* opt_locking_clause  */
-  YYSYMBOL_opt_locking_clause_list = 299,  /* opt_locking_clause_list  */
-  YYSYMBOL_locking_clause = 300,           /* locking_clause  */
-  YYSYMBOL_row_lock_mode = 301,            /* row_lock_mode  */
-  YYSYMBOL_opt_row_lock_policy = 302,      /* opt_row_lock_policy  */
-  YYSYMBOL_opt_with_clause = 303,          /* opt_with_clause  */
-  YYSYMBOL_with_clause = 304,              /* with_clause  */
-  YYSYMBOL_with_description_list = 305,    /* with_description_list  */
-  YYSYMBOL_with_description = 306,         /* with_description  */
-  YYSYMBOL_join_clause = 307,              /* join_clause  */
-  YYSYMBOL_opt_join_type = 308,            /* opt_join_type  */
-  YYSYMBOL_join_condition = 309,           /* join_condition  */
-  YYSYMBOL_opt_semicolon = 310,            /* opt_semicolon  */
-  YYSYMBOL_ident_commalist = 311           /* ident_commalist  */
+  YYSYMBOL_create_table_statement = 207,   /* create_table_statement  */
+  YYSYMBOL_create_table_columns = 208,     /* create_table_columns  */
+  YYSYMBOL_index_head = 209,               /* index_head  */
+  YYSYMBOL_opt_index_include = 210,        /* opt_index_include  */
+  YYSYMBOL_opt_not_exists = 211,           /* opt_not_exists  */
+  YYSYMBOL_table_elem_commalist = 212,     /* table_elem_commalist  */
+  YYSYMBOL_table_elem = 213,               /* table_elem  */
+  YYSYMBOL_table_option_commalist = 214,   /* table_option_commalist  */
+  YYSYMBOL_table_option = 215,             /* table_option  */
+  YYSYMBOL_table_option_value = 216,       /* table_option_value  */
+  YYSYMBOL_column_def = 217,               /* column_def  */
+  YYSYMBOL_column_type = 218,              /* column_type  */
+  YYSYMBOL_opt_time_precision = 219,       /* opt_time_precision  */
+  YYSYMBOL_opt_decimal_specification = 220, /* opt_decimal_specification  */
+  YYSYMBOL_opt_column_constraints = 221,   /* opt_column_constraints  */
+  YYSYMBOL_column_constraint_set = 222,    /* column_constraint_set  */
+  YYSYMBOL_column_constraint = 223,        /* column_constraint  */
+  YYSYMBOL_table_constraint = 224,         /* table_constraint  */
+  YYSYMBOL_drop_statement = 225,           /* drop_statement  */
+  YYSYMBOL_opt_exists = 226,               /* opt_exists  */
+  YYSYMBOL_alter_statement = 227,          /* alter_statement  */
+  YYSYMBOL_alter_action = 228,             /* alter_action  */
+  YYSYMBOL_drop_action = 229,              /* drop_action  */
+  YYSYMBOL_delete_statement = 230,         /* delete_statement  */
+  YYSYMBOL_truncate_statement = 231,       /* truncate_statement  */
+  YYSYMBOL_insert_statement = 232,         /* insert_statement  */
+  YYSYMBOL_values_list = 233,              /* values_list  */
+  YYSYMBOL_opt_column_list = 234,          /* opt_column_list  */
+  YYSYMBOL_update_statement = 235,         /* update_statement  */
+  YYSYMBOL_update_clause_commalist = 236,  /* update_clause_commalist  */
+  YYSYMBOL_update_clause = 237,            /* update_clause  */
+  YYSYMBOL_select_statement = 238,         /* select_statement  */
+  YYSYMBOL_select_within_set_operation = 239, /* select_within_set_operation  */
+  YYSYMBOL_select_within_set_operation_no_parentheses = 240, /* select_within_set_operation_no_parentheses  */
+  YYSYMBOL_select_with_paren = 241,        /* select_with_paren  */
+  YYSYMBOL_select_no_paren = 242,          /* select_no_paren  */
+  YYSYMBOL_set_operator = 243,             /* set_operator  */
+  YYSYMBOL_set_type = 244,                 /* set_type  */
+  YYSYMBOL_opt_all = 245,                  /* opt_all  */
+  YYSYMBOL_select_clause = 246,            /* select_clause  */
+  YYSYMBOL_opt_distinct = 247,             /* opt_distinct  */
+  YYSYMBOL_select_list = 248,              /* select_list  */
+  YYSYMBOL_opt_from_clause = 249,          /* opt_from_clause  */
+  YYSYMBOL_from_clause = 250,              /* from_clause  */
+  YYSYMBOL_opt_where = 251,                /* opt_where  */
+  YYSYMBOL_opt_group = 252,                /* opt_group  */
+  YYSYMBOL_opt_having = 253,               /* opt_having  */
+  YYSYMBOL_opt_order = 254,                /* opt_order  */
+  YYSYMBOL_order_list = 255,               /* order_list  */
+  YYSYMBOL_order_desc = 256,               /* order_desc  */
+  YYSYMBOL_opt_order_type = 257,           /* opt_order_type  */
+  YYSYMBOL_opt_top = 258,                  /* opt_top  */
+  YYSYMBOL_opt_limit = 259,                /* opt_limit  */
+  YYSYMBOL_expr_list = 260,                /* expr_list  */
+  YYSYMBOL_opt_literal_list = 261,         /* opt_literal_list  */
+  YYSYMBOL_literal_list = 262,             /* literal_list  */
+  YYSYMBOL_expr_alias = 263,               /* expr_alias  */
+  YYSYMBOL_expr = 264,                     /* expr  */
+  YYSYMBOL_operand = 265,                  /* operand  */
+  YYSYMBOL_scalar_expr = 266,              /* scalar_expr  */
+  YYSYMBOL_unary_expr = 267,               /* unary_expr  */
+  YYSYMBOL_binary_expr = 268,              /* binary_expr  */
+  YYSYMBOL_logic_expr = 269,               /* logic_expr  */
+  YYSYMBOL_in_expr = 270,                  /* in_expr  */
+  YYSYMBOL_case_expr = 271,                /* case_expr  */
+  YYSYMBOL_case_list = 272,                /* case_list  */
+  YYSYMBOL_exists_expr = 273,              /* exists_expr  */
+  YYSYMBOL_comp_expr = 274,                /* comp_expr  */
+  YYSYMBOL_function_expr = 275,            /* function_expr  */
+  YYSYMBOL_extract_expr = 276,             /* extract_expr  */
+  YYSYMBOL_cast_expr = 277,                /* cast_expr  */
+  YYSYMBOL_datetime_field = 278,           /* datetime_field  */
+  YYSYMBOL_datetime_field_plural = 279,    /* datetime_field_plural  */
+  YYSYMBOL_duration_field = 280,           /* duration_field  */
+  YYSYMBOL_array_expr = 281,               /* array_expr  */
+  YYSYMBOL_array_index = 282,              /* array_index  */
+  YYSYMBOL_between_expr = 283,             /* between_expr  */
+  YYSYMBOL_column_name = 284,              /* column_name  */
+  YYSYMBOL_literal = 285,                  /* literal  */
+  YYSYMBOL_string_literal = 286,           /* string_literal  */
+  YYSYMBOL_bool_literal = 287,             /* bool_literal  */
+  YYSYMBOL_num_literal = 288,              /* num_literal  */
+  YYSYMBOL_int_literal = 289,              /* int_literal  */
+  YYSYMBOL_null_literal = 290,             /* null_literal  */
+  YYSYMBOL_date_literal = 291,             /* date_literal  */
+  YYSYMBOL_interval_literal = 292,         /* interval_literal  */
+  YYSYMBOL_param_expr = 293,               /* param_expr  */
+  YYSYMBOL_table_ref = 294,                /* table_ref  */
+  YYSYMBOL_table_ref_atomic = 295,         /* table_ref_atomic  */
+  YYSYMBOL_nonjoin_table_ref_atomic = 296, /* nonjoin_table_ref_atomic  */
+  YYSYMBOL_table_ref_commalist = 297,      /* table_ref_commalist  */
+  YYSYMBOL_table_ref_name = 298,           /* table_ref_name  */
+  YYSYMBOL_table_ref_name_no_alias = 299,  /* table_ref_name_no_alias  */
+  YYSYMBOL_table_name = 300,               /* table_name  */
+  YYSYMBOL_opt_index_name = 301,           /* opt_index_name  */
+  YYSYMBOL_opt_index_method = 302,         /* opt_index_method  */
+  YYSYMBOL_table_alias = 303,              /* table_alias  */
+  YYSYMBOL_opt_table_alias = 304,          /* opt_table_alias  */
+  YYSYMBOL_alias = 305,                    /* alias  */
+  YYSYMBOL_opt_alias = 306,                /* opt_alias  */
+  YYSYMBOL_opt_locking_clause = 307,       /* opt_locking_clause  */
+  YYSYMBOL_opt_locking_clause_list = 308,  /* opt_locking_clause_list  */
+  YYSYMBOL_locking_clause = 309,           /* locking_clause  */
+  YYSYMBOL_row_lock_mode = 310,            /* row_lock_mode  */
+  YYSYMBOL_opt_row_lock_policy = 311,      /* opt_row_lock_policy  */
+  YYSYMBOL_opt_with_clause = 312,          /* opt_with_clause  */
+  YYSYMBOL_with_clause = 313,              /* with_clause  */
+  YYSYMBOL_with_description_list = 314,    /* with_description_list  */
+  YYSYMBOL_with_description = 315,         /* with_description  */
+  YYSYMBOL_join_clause = 316,              /* join_clause  */
+  YYSYMBOL_opt_join_type = 317,            /* opt_join_type  */
+  YYSYMBOL_join_condition = 318,           /* join_condition  */
+  YYSYMBOL_opt_semicolon = 319,            /* opt_semicolon  */
+  YYSYMBOL_ident_commalist = 320           /* ident_commalist  */
 };
 typedef enum yysymbol_kind_t yysymbol_kind_t;
 
@@ -772,18 +781,18 @@ union yyalloc
 #endif /* !YYCOPY_NEEDED */
 
 /* YYFINAL -- State number of the termination state.  */
-#define YYFINAL  67
+#define YYFINAL  69
 /* YYLAST -- Last index in YYTABLE.  */
-#define YYLAST   863
+#define YYLAST   908
 
 /* YYNTOKENS -- Number of terminals.  */
 #define YYNTOKENS  187
 /* YYNNTS -- Number of nonterminals.  */
-#define YYNNTS  125
+#define YYNNTS  134
 /* YYNRULES -- Number of rules.  */
-#define YYNRULES  319
+#define YYNRULES  339
 /* YYNSTATES -- Number of states.  */
-#define YYNSTATES  573
+#define YYNSTATES  617
 
 /* YYMAXUTOK -- Last valid token kind.  */
 #define YYMAXUTOK   424
@@ -849,38 +858,40 @@ static const yytype_uint8 yytranslate[] =
 /* YYRLINE[YYN] -- Source line where rule number YYN was defined.  */
 static const yytype_int16 yyrline[] =
 {
-       0,   312,   312,   331,   337,   344,   348,   352,   353,   354,
-     356,   357,   358,   359,   360,   361,   362,   363,   364,   365,
-     371,   372,   374,   378,   383,   387,   397,   398,   399,   401,
-     401,   407,   413,   415,   419,   430,   436,   443,   458,   463,
-     464,   470,   482,   483,   488,   499,   512,   524,   531,   538,
-     547,   548,   550,   554,   559,   560,   562,   569,   570,   571,
-     572,   573,   574,   575,   579,   580,   581,   582,   583,   584,
-     585,   586,   587,   588,   589,   591,   592,   594,   595,   596,
-     598,   599,   601,   605,   610,   611,   612,   613,   615,   616,
-     624,   630,   636,   642,   648,   649,   656,   662,   664,   674,
-     681,   692,   699,   707,   708,   715,   722,   726,   731,   741,
-     745,   749,   761,   761,   763,   764,   773,   774,   776,   790,
-     802,   807,   811,   815,   820,   821,   823,   833,   834,   836,
-     838,   839,   841,   843,   844,   846,   851,   853,   854,   856,
-     857,   859,   863,   868,   870,   871,   872,   876,   877,   879,
-     880,   881,   882,   883,   884,   889,   893,   898,   899,   901,
-     905,   910,   918,   918,   918,   918,   918,   920,   921,   921,
-     921,   921,   921,   921,   921,   921,   922,   922,   926,   926,
-     928,   929,   930,   931,   932,   934,   934,   935,   936,   937,
-     938,   939,   940,   941,   942,   943,   945,   946,   948,   949,
-     950,   951,   955,   956,   957,   958,   960,   961,   963,   964,
-     966,   967,   968,   969,   970,   971,   972,   974,   975,   977,
-     979,   981,   982,   983,   984,   985,   986,   988,   989,   990,
-     991,   992,   993,   995,   995,   997,   999,  1001,  1003,  1004,
-    1005,  1006,  1008,  1008,  1008,  1008,  1008,  1008,  1008,  1010,
-    1012,  1013,  1015,  1016,  1018,  1020,  1022,  1033,  1037,  1048,
-    1080,  1089,  1089,  1096,  1096,  1098,  1098,  1105,  1109,  1114,
-    1122,  1128,  1132,  1137,  1138,  1140,  1140,  1142,  1142,  1144,
-    1145,  1147,  1147,  1153,  1154,  1156,  1160,  1165,  1171,  1178,
-    1179,  1180,  1181,  1183,  1184,  1185,  1191,  1191,  1193,  1195,
-    1199,  1204,  1214,  1221,  1229,  1245,  1246,  1247,  1248,  1249,
-    1250,  1251,  1252,  1253,  1254,  1256,  1262,  1262,  1265,  1269
+       0,   330,   330,   349,   355,   362,   366,   370,   371,   372,
+     373,   375,   376,   377,   378,   379,   380,   381,   382,   383,
+     384,   390,   391,   393,   397,   402,   406,   416,   417,   418,
+     420,   420,   426,   432,   434,   438,   449,   455,   462,   477,
+     482,   483,   489,   501,   502,   507,   518,   531,   538,   555,
+     567,   568,   572,   578,   592,   602,   607,   619,   634,   647,
+     649,   650,   652,   656,   661,   662,   664,   668,   673,   675,
+     676,   678,   685,   686,   687,   688,   689,   690,   691,   695,
+     696,   697,   698,   699,   700,   701,   702,   703,   704,   705,
+     707,   708,   710,   711,   712,   714,   715,   717,   721,   726,
+     727,   728,   729,   731,   732,   740,   746,   752,   758,   764,
+     765,   772,   778,   780,   790,   797,   808,   816,   824,   828,
+     833,   834,   841,   848,   852,   857,   867,   871,   875,   887,
+     887,   889,   890,   899,   900,   902,   916,   928,   933,   937,
+     941,   946,   947,   949,   959,   960,   962,   964,   965,   967,
+     969,   970,   972,   977,   979,   980,   982,   983,   985,   989,
+     994,   996,   997,   998,  1002,  1003,  1005,  1006,  1007,  1008,
+    1009,  1010,  1015,  1019,  1024,  1025,  1027,  1031,  1036,  1044,
+    1044,  1044,  1044,  1044,  1046,  1047,  1047,  1047,  1047,  1047,
+    1047,  1047,  1047,  1048,  1048,  1052,  1052,  1054,  1055,  1056,
+    1057,  1058,  1060,  1060,  1061,  1062,  1063,  1064,  1065,  1066,
+    1067,  1068,  1069,  1071,  1072,  1074,  1075,  1076,  1077,  1081,
+    1082,  1083,  1084,  1086,  1087,  1089,  1090,  1092,  1093,  1094,
+    1095,  1096,  1097,  1098,  1100,  1101,  1103,  1105,  1107,  1108,
+    1109,  1110,  1111,  1112,  1114,  1115,  1116,  1117,  1118,  1119,
+    1121,  1121,  1123,  1125,  1127,  1129,  1130,  1131,  1132,  1134,
+    1134,  1134,  1134,  1134,  1134,  1134,  1136,  1138,  1139,  1141,
+    1142,  1144,  1146,  1148,  1159,  1163,  1174,  1206,  1215,  1215,
+    1222,  1222,  1224,  1224,  1231,  1235,  1240,  1248,  1254,  1258,
+    1263,  1264,  1266,  1267,  1268,  1270,  1270,  1272,  1272,  1274,
+    1275,  1277,  1277,  1283,  1284,  1286,  1290,  1295,  1301,  1308,
+    1309,  1310,  1311,  1313,  1314,  1315,  1321,  1321,  1323,  1325,
+    1329,  1334,  1344,  1351,  1359,  1375,  1376,  1377,  1378,  1379,
+    1380,  1381,  1382,  1383,  1384,  1386,  1392,  1392,  1395,  1399
 };
 #endif
 
@@ -926,13 +937,16 @@ static const char *const yytname[] =
   "transaction_statement", "opt_transaction_keyword", "prepare_statement",
   "prepare_target_query", "execute_statement", "import_statement",
   "file_type", "file_path", "opt_file_type", "export_statement",
-  "show_statement", "create_statement", "opt_not_exists",
-  "table_elem_commalist", "table_elem", "column_def", "column_type",
-  "opt_time_precision", "opt_decimal_specification",
-  "opt_column_constraints", "column_constraint_set", "column_constraint",
-  "table_constraint", "drop_statement", "opt_exists", "alter_statement",
-  "alter_action", "drop_action", "delete_statement", "truncate_statement",
-  "insert_statement", "opt_column_list", "update_statement",
+  "show_statement", "create_statement", "create_table_statement",
+  "create_table_columns", "index_head", "opt_index_include",
+  "opt_not_exists", "table_elem_commalist", "table_elem",
+  "table_option_commalist", "table_option", "table_option_value",
+  "column_def", "column_type", "opt_time_precision",
+  "opt_decimal_specification", "opt_column_constraints",
+  "column_constraint_set", "column_constraint", "table_constraint",
+  "drop_statement", "opt_exists", "alter_statement", "alter_action",
+  "drop_action", "delete_statement", "truncate_statement",
+  "insert_statement", "values_list", "opt_column_list", "update_statement",
   "update_clause_commalist", "update_clause", "select_statement",
   "select_within_set_operation",
   "select_within_set_operation_no_parentheses", "select_with_paren",
@@ -950,11 +964,12 @@ static const char *const yytname[] =
   "date_literal", "interval_literal", "param_expr", "table_ref",
   "table_ref_atomic", "nonjoin_table_ref_atomic", "table_ref_commalist",
   "table_ref_name", "table_ref_name_no_alias", "table_name",
-  "opt_index_name", "table_alias", "opt_table_alias", "alias", "opt_alias",
-  "opt_locking_clause", "opt_locking_clause_list", "locking_clause",
-  "row_lock_mode", "opt_row_lock_policy", "opt_with_clause", "with_clause",
-  "with_description_list", "with_description", "join_clause",
-  "opt_join_type", "join_condition", "opt_semicolon", "ident_commalist", YY_NULLPTR
+  "opt_index_name", "opt_index_method", "table_alias", "opt_table_alias",
+  "alias", "opt_alias", "opt_locking_clause", "opt_locking_clause_list",
+  "locking_clause", "row_lock_mode", "opt_row_lock_policy",
+  "opt_with_clause", "with_clause", "with_description_list",
+  "with_description", "join_clause", "opt_join_type", "join_condition",
+  "opt_semicolon", "ident_commalist", YY_NULLPTR
 };
 
 static const char *
@@ -964,12 +979,12 @@ yysymbol_name (yysymbol_kind_t yysymbol)
 }
 #endif
 
-#define YYPACT_NINF (-432)
+#define YYPACT_NINF (-465)
 
 #define yypact_value_is_default(Yyn) \
   ((Yyn) == YYPACT_NINF)
 
-#define YYTABLE_NINF (-317)
+#define YYTABLE_NINF (-337)
 
 #define yytable_value_is_error(Yyn) \
   ((Yyn) == YYTABLE_NINF)
@@ -978,64 +993,68 @@ yysymbol_name (yysymbol_kind_t yysymbol)
    STATE-NUM.  */
 static const yytype_int16 yypact[] =
 {
-     594,    32,    77,    96,   133,    77,   -29,    65,    73,    80,
-      77,    91,    77,   102,    29,   185,    57,    57,    57,   272,
-      93,  -432,   120,  -432,   120,  -432,  -432,  -432,  -432,  -432,
-    -432,  -432,  -432,  -432,  -432,  -432,  -432,   -34,  -432,   280,
-     105,  -432,   126,   219,  -432,   187,   187,   187,    77,   316,
-      77,   203,  -432,   205,   -28,   205,   205,   205,    77,  -432,
-     198,   145,  -432,  -432,  -432,  -432,  -432,  -432,   589,  -432,
-     234,  -432,  -432,   220,   -34,   129,  -432,    53,  -432,   340,
-      33,   341,   236,   361,    77,    77,   285,  -432,   294,   207,
-     390,   348,    77,   391,   391,   400,    77,    77,  -432,   235,
-     185,  -432,   239,   409,   410,   243,   244,  -432,  -432,  -432,
-     -34,   307,   301,   -34,     6,  -432,  -432,  -432,  -432,   424,
-    -432,   426,  -432,  -432,  -432,   251,   249,  -432,  -432,  -432,
-    -432,   714,  -432,  -432,  -432,  -432,  -432,  -432,   392,  -432,
-     306,   -54,   207,   250,  -432,   391,   436,   122,   281,   -52,
-    -432,  -432,   351,   332,  -432,   332,  -432,  -432,  -432,  -432,
-    -432,   442,  -432,  -432,   250,  -432,  -432,   370,  -432,  -432,
-     129,  -432,  -432,   250,   370,   250,    40,   331,  -432,   161,
-    -432,    33,  -432,  -432,  -432,  -432,  -432,  -432,  -432,  -432,
-    -432,  -432,  -432,  -432,  -432,  -432,  -432,  -432,    77,   447,
-     339,   154,   328,    48,   273,   274,   277,   160,   344,   282,
-     393,  -432,   232,   -65,   418,  -432,  -432,  -432,  -432,  -432,
-    -432,  -432,  -432,  -432,  -432,  -432,  -432,  -432,  -432,  -432,
-    -432,   362,  -432,   139,   278,  -432,   250,   390,  -432,   423,
-    -432,  -432,   417,  -432,  -432,   286,   155,  -432,   374,   284,
-    -432,    17,     6,   -34,   288,  -432,   -38,     6,   -65,   415,
-      20,    11,  -432,   331,  -432,  -432,  -432,   290,   381,  -432,
-     634,   355,   295,   157,  -432,  -432,  -432,   339,     7,    19,
-     419,   161,   250,   250,    47,   130,   302,   393,   654,   250,
-     110,   300,    38,   250,   250,   393,  -432,   393,   -46,   305,
-     -31,   393,   393,   393,   393,   393,   393,   393,   393,   393,
-     393,   393,   393,   393,   393,   393,   409,    77,  -432,   484,
-      33,   -65,  -432,   205,   316,    33,  -432,   442,    15,   285,
-    -432,   250,  -432,   486,  -432,  -432,  -432,  -432,   250,  -432,
-    -432,  -432,   331,   250,   250,  -432,   329,   371,  -432,    46,
-    -432,   436,   391,  -432,  -432,   311,  -432,   320,  -432,  -432,
-     321,  -432,  -432,   323,  -432,  -432,  -432,  -432,   324,  -432,
-    -432,    95,   325,   436,  -432,   154,  -432,  -432,   250,  -432,
-    -432,   326,   413,   144,   134,   141,   250,   250,  -432,   419,
-     411,  -126,  -432,  -432,  -432,   396,   595,   672,   393,   334,
-     232,  -432,   420,   343,   672,   672,   672,   672,   186,   186,
-     186,   186,   110,   110,    51,    51,    51,   -76,   347,  -432,
-    -432,   184,   520,  -432,   188,  -432,   339,  -432,   385,  -432,
-     349,  -432,    23,  -432,   459,  -432,  -432,  -432,  -432,   -65,
-     -65,  -432,   469,   436,  -432,   373,  -432,   190,  -432,   529,
-     530,  -432,   531,   532,   534,  -432,   422,  -432,  -432,   437,
-    -432,    95,  -432,   436,   192,  -432,   194,  -432,   250,   634,
-     250,   250,  -432,   176,   142,   366,  -432,   393,   672,   232,
-     367,   196,  -432,  -432,  -432,  -432,  -432,   368,   452,  -432,
-    -432,  -432,   474,   475,   478,   458,    15,   555,  -432,  -432,
-    -432,   433,  -432,  -432,    66,  -432,  -432,   378,   204,   379,
-     382,   383,  -432,  -432,  -432,   222,  -432,  -432,    45,   386,
-     -65,   177,  -432,   250,  -432,   654,   387,   227,  -432,  -432,
-      23,    15,  -432,  -432,  -432,    15,   421,   394,   250,  -432,
-    -432,  -432,   557,  -432,  -432,  -432,  -432,  -432,  -432,  -432,
-     -65,  -432,  -432,  -432,  -432,   431,   436,   -30,   389,   395,
-     250,   229,   250,  -432,  -432,    24,   -65,  -432,  -432,   -65,
-     402,   404,  -432
+     620,    83,    74,   139,   171,    74,    -7,   125,   141,   114,
+      74,   221,    74,   117,    31,   280,   148,   148,   148,   306,
+     127,  -465,   210,  -465,   210,  -465,  -465,  -465,  -465,  -465,
+    -465,   242,  -465,  -465,  -465,  -465,  -465,  -465,  -465,   -20,
+    -465,   330,   155,  -465,   178,   250,  -465,    30,   237,   237,
+      74,   362,    74,   252,  -465,   249,    13,   249,   249,   249,
+      74,  -465,   257,   202,  -465,  -465,  -465,  -465,  -465,  -465,
+     588,  -465,   291,  -465,  -465,   -37,   265,   -20,   123,  -465,
+     161,  -465,   387,    51,   409,    32,   302,   293,  -465,   304,
+      74,    74,   343,  -465,   334,   247,   426,   384,    74,   430,
+     430,   437,    74,    74,  -465,   260,   280,  -465,   262,   263,
+     444,   440,   439,   267,   270,  -465,  -465,  -465,   -20,   339,
+     331,   -20,   132,  -465,  -465,  -465,  -465,   452,  -465,   454,
+    -465,  -465,  -465,   277,   283,  -465,  -465,  -465,  -465,   341,
+    -465,  -465,  -465,  -465,  -465,  -465,  -465,   344,   420,    74,
+     423,   -46,   247,   357,  -465,   430,   467,     7,   309,   -44,
+    -465,  -465,   381,   361,  -465,   361,  -465,  -465,  -465,  -465,
+    -465,   472,   472,   314,  -116,  -465,  -465,  -465,   357,  -465,
+    -465,   414,  -465,  -465,   123,  -465,  -465,   357,   414,   357,
+     144,   376,  -465,   258,  -465,    51,  -465,  -465,  -465,  -465,
+    -465,  -465,  -465,  -465,  -465,  -465,  -465,  -465,  -465,  -465,
+    -465,   449,   493,   417,  -465,   495,   388,    40,   377,   129,
+     322,   324,   325,   205,   389,   332,   416,  -465,   281,   173,
+     443,  -465,  -465,  -465,  -465,  -465,  -465,  -465,  -465,  -465,
+    -465,  -465,  -465,  -465,  -465,  -465,  -465,   415,  -465,    77,
+     333,  -465,   357,   426,  -465,   473,  -465,  -465,   466,  -465,
+    -465,   335,   150,  -465,   152,    56,   210,   444,   424,   336,
+    -465,    41,   132,   -20,   337,  -465,    99,   132,   173,   462,
+      43,    11,  -465,   376,  -465,  -465,  -465,   493,  -465,  -465,
+      38,   338,   432,  -465,   660,   403,   345,   160,  -465,  -465,
+    -465,   388,    14,    20,   469,   258,   357,   357,   165,   -39,
+     347,   416,   680,   357,   -90,   350,    52,   357,   357,   416,
+    -465,   416,   -52,   348,   203,   416,   416,   416,   416,   416,
+     416,   416,   416,   416,   416,   416,   416,   416,   416,   416,
+     440,    74,  -465,   530,    51,   349,   173,  -465,   249,   362,
+      51,  -465,   472,  -465,  -465,  -465,  -465,  -465,  -465,    18,
+     343,  -465,   357,  -465,   532,  -465,  -465,  -465,  -465,   357,
+    -465,  -465,  -465,   376,   357,   357,  -465,   375,   422,  -465,
+     113,  -465,  -465,  -465,  -465,   467,   430,  -465,  -465,   364,
+    -465,   365,  -465,  -465,   366,  -465,  -465,   367,  -465,  -465,
+    -465,  -465,   368,  -465,  -465,    79,   369,   467,  -465,    40,
+    -465,  -465,   357,  -465,  -465,   370,   459,   189,   118,    68,
+     357,   357,  -465,   469,   453,    59,  -465,  -465,  -465,   441,
+     659,   711,   416,   374,   281,  -465,   455,   378,   711,   711,
+     711,   711,   729,   729,   729,   729,   -90,   -90,   -89,   -89,
+     -89,   -85,   380,  -465,  -465,   164,   392,   555,  -465,   166,
+    -465,   388,  -465,   146,  -465,   391,  -465,    37,  -465,   491,
+    -465,  -465,  -465,  -465,   173,   173,  -465,   502,   467,  -465,
+     418,  -465,   186,  -465,   563,   568,  -465,   571,   575,   576,
+    -465,   463,  -465,  -465,   480,  -465,    79,  -465,   467,   188,
+    -465,   192,  -465,   357,   660,   357,   357,  -465,   -35,   183,
+     404,  -465,   416,   711,   281,   405,   198,  -465,  -465,  -465,
+      51,  -465,  -465,   410,   486,  -465,  -465,  -465,   513,   515,
+     516,   497,    18,   595,  -465,  -465,  -465,   474,  -465,  -465,
+     115,  -465,   417,   419,   199,   429,   442,   448,  -465,  -465,
+    -465,   225,  -465,  -465,    54,   450,   173,    61,  -465,   357,
+    -465,   680,   451,   226,  -465,  -465,   227,    37,    18,  -465,
+    -465,  -465,    18,   182,   445,   357,  -465,   596,  -465,  -465,
+     598,  -465,  -465,  -465,  -465,  -465,  -465,  -465,   173,  -465,
+    -465,  -465,  -465,  -465,   241,   467,   -22,   456,  -465,   457,
+     464,   357,   232,   357,  -465,   467,  -465,    21,   173,  -465,
+    -465,   173,   233,   438,   461,  -465,  -465
 };
 
 /* YYDEFACT[STATE-NUM] -- Default reduction number in state STATE-NUM.
@@ -1043,100 +1062,106 @@ static const yytype_int16 yypact[] =
    means the default is an error.  */
 static const yytype_int16 yydefact[] =
 {
-     297,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-       0,     0,     0,     0,     0,     0,    30,    30,    30,     0,
-     317,     3,    21,    19,    21,    18,     8,     9,     7,    11,
-      16,    17,    13,    14,    12,    15,    10,     0,   296,     0,
-     271,   100,    33,     0,    44,    51,    51,    51,     0,     0,
-       0,     0,   270,    95,     0,    95,    95,    95,     0,    42,
-       0,   298,   299,    29,    26,    28,    27,     1,   297,     2,
-       0,     6,     5,   148,     0,   109,   110,   140,    92,     0,
-     158,     0,     0,   274,     0,     0,   134,    37,     0,   104,
-       0,     0,     0,     0,     0,     0,     0,     0,    43,     0,
-       0,     4,     0,     0,   128,     0,     0,   122,   123,   121,
-       0,   125,     0,     0,   154,   272,   249,   252,   254,     0,
-     255,     0,   250,   251,   260,     0,   157,   159,   242,   243,
-     244,   253,   245,   246,   247,   248,    32,    31,     0,   273,
-       0,     0,   104,     0,    99,     0,     0,     0,     0,   134,
-     106,    94,     0,    40,    38,    40,    93,    90,    91,   301,
-     300,     0,   147,   127,     0,   117,   116,   140,   113,   112,
-     114,   124,   120,     0,   140,     0,     0,   284,   256,   259,
-      34,     0,   221,   222,   223,   224,   225,   226,   227,   228,
-     229,   230,   231,   232,   233,   234,   257,    50,     0,     0,
-     297,     0,     0,   238,     0,     0,     0,     0,     0,     0,
-       0,   240,     0,   133,   162,   169,   170,   171,   164,   166,
-     172,   165,   185,   173,   174,   175,   176,   168,   163,   178,
-     179,     0,   318,     0,     0,   102,     0,     0,   105,     0,
-      96,    97,     0,    36,    41,    24,     0,    22,   131,   129,
-     155,   282,   154,     0,   139,   141,   146,   154,   150,   152,
-     149,     0,   118,   283,   285,   258,   160,     0,     0,    47,
-       0,     0,     0,     0,    52,    54,    55,   297,   128,     0,
-       0,     0,     0,     0,     0,     0,     0,     0,   181,     0,
-     180,     0,     0,     0,     0,     0,   182,     0,     0,     0,
+     317,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,    31,    31,    31,     0,
+     337,     3,    22,    20,    22,    19,     9,    10,     8,    12,
+       7,    50,    17,    18,    14,    15,    13,    16,    11,     0,
+     316,     0,   288,   115,    34,     0,    45,   291,    61,    61,
+       0,     0,     0,     0,   287,   110,     0,   110,   110,   110,
+       0,    43,     0,   318,   319,    30,    27,    29,    28,     1,
+     317,     2,     0,     6,     5,     0,   165,     0,   126,   127,
+     157,   107,     0,   175,     0,   290,     0,     0,    54,     0,
+       0,     0,   151,    38,     0,   121,     0,     0,     0,     0,
+       0,     0,     0,     0,    44,     0,     0,     4,     0,     0,
+       0,     0,   145,     0,     0,   139,   140,   138,     0,   142,
+       0,     0,   171,   289,   266,   269,   271,     0,   272,     0,
+     267,   268,   277,     0,   174,   176,   259,   260,   261,   270,
+     262,   263,   264,   265,    33,    32,    56,     0,     0,     0,
+       0,     0,   121,     0,   114,     0,     0,     0,     0,   151,
+     123,   109,     0,    41,    39,    41,   108,   105,   106,   321,
+     320,     0,     0,     0,     0,    66,   164,   144,     0,   134,
+     133,   157,   130,   129,   131,   141,   137,     0,   157,     0,
+       0,   304,   273,   276,    35,     0,   238,   239,   240,   241,
+     242,   243,   244,   245,   246,   247,   248,   249,   250,   251,
+     274,     0,   291,   294,    60,     0,   317,     0,     0,   255,
+       0,     0,     0,     0,     0,     0,     0,   257,     0,   150,
+     179,   186,   187,   188,   181,   183,   189,   182,   202,   190,
+     191,   192,   193,   185,   180,   195,   196,     0,   338,     0,
+       0,   117,     0,     0,   122,     0,   111,   112,     0,    37,
+      42,    25,     0,    23,     0,     0,    22,     0,   148,   146,
+     172,   302,   171,     0,   156,   158,   163,   171,   167,   169,
+     166,     0,   135,   303,   305,   275,   177,   291,   290,    55,
+       0,     0,     0,    47,     0,     0,     0,     0,    62,    64,
+      65,   317,   145,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,   198,     0,   197,     0,     0,     0,     0,     0,
+     199,     0,     0,     0,     0,     0,     0,     0,     0,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-       0,     0,     0,     0,     0,     0,     0,     0,   103,     0,
-       0,   108,   107,    95,     0,     0,    20,     0,     0,   134,
-     130,     0,   280,     0,   281,   161,   111,   115,     0,   145,
-     144,   143,   284,     0,     0,   289,     0,     0,   291,   295,
-     286,     0,     0,    73,    67,     0,    69,    79,    70,    57,
-       0,    64,    65,     0,    61,    62,    68,    71,    76,    66,
-      58,    81,     0,     0,    46,     0,    49,   217,     0,   239,
-     241,     0,     0,     0,     0,     0,     0,     0,   204,     0,
-       0,     0,   177,   167,   196,   197,     0,   192,     0,     0,
-       0,   183,     0,   195,   194,   210,   211,   212,   213,   214,
-     215,   216,   187,   186,   189,   188,   190,   191,     0,    35,
-     319,     0,     0,    39,     0,    23,   297,   132,   261,   263,
-       0,   265,   278,   264,   136,   156,   279,   142,   119,   153,
-     151,   292,     0,     0,   294,     0,   287,     0,    45,     0,
-       0,    63,     0,     0,     0,    72,     0,    85,    86,     0,
-      56,    80,    82,     0,     0,    53,     0,   208,     0,     0,
-       0,     0,   202,     0,     0,     0,   235,     0,   193,     0,
-       0,     0,   184,   236,   101,    98,    25,     0,     0,   313,
-     305,   311,   309,   312,   307,     0,     0,     0,   277,   269,
-     275,     0,   126,   290,   295,   293,    48,     0,     0,     0,
-       0,     0,    84,    87,    83,     0,    89,   218,     0,     0,
-     206,     0,   205,     0,   209,   237,     0,     0,   200,   198,
-     278,     0,   308,   310,   306,     0,   262,   279,     0,   288,
-      60,    78,     0,    74,    59,    75,    88,   219,   220,   203,
-     207,   201,   199,   266,   302,   314,     0,   138,     0,     0,
-       0,     0,     0,   135,    77,     0,   315,   303,   276,   137,
-     238,     0,   304
+       0,     0,   120,     0,     0,   116,   125,   124,   110,     0,
+       0,    21,     0,    51,    69,    70,    68,    52,    67,     0,
+     151,   147,     0,   300,     0,   301,   178,   128,   132,     0,
+     162,   161,   160,   304,     0,     0,   309,     0,     0,   311,
+     315,   306,    57,   292,   293,     0,     0,    88,    82,     0,
+      84,    94,    85,    72,     0,    79,    80,     0,    76,    77,
+      83,    86,    91,    81,    73,    96,     0,     0,    53,     0,
+      49,   234,     0,   256,   258,     0,     0,     0,     0,     0,
+       0,     0,   221,     0,     0,     0,   194,   184,   213,   214,
+       0,   209,     0,     0,     0,   200,     0,   212,   211,   227,
+     228,   229,   230,   231,   232,   233,   204,   203,   206,   205,
+     207,   208,     0,    36,   339,     0,     0,     0,    40,     0,
+      24,   317,   149,   278,   280,     0,   282,   298,   281,   153,
+     173,   299,   159,   136,   170,   168,   312,     0,     0,   314,
+       0,   307,     0,    46,     0,     0,    78,     0,     0,     0,
+      87,     0,   100,   101,     0,    71,    95,    97,     0,     0,
+      63,     0,   225,     0,     0,     0,     0,   219,     0,     0,
+       0,   252,     0,   210,     0,     0,     0,   201,   253,   118,
+       0,   113,    26,     0,     0,   333,   325,   331,   329,   332,
+     327,     0,     0,     0,   297,   286,   295,     0,   143,   310,
+     315,   313,   294,     0,     0,     0,     0,     0,    99,   102,
+      98,     0,   104,   235,     0,     0,   223,     0,   222,     0,
+     226,   254,     0,     0,   217,   215,     0,   298,     0,   328,
+     330,   326,     0,   279,   299,     0,   308,    59,    75,    93,
+       0,    89,    74,    90,   103,   236,   237,   220,   224,   218,
+     216,   119,   283,   322,   334,     0,   155,     0,    48,     0,
+       0,     0,     0,     0,   152,     0,    92,     0,   335,   323,
+     296,   154,     0,   255,     0,    58,   324
 };
 
 /* YYPGOTO[NTERM-NUM].  */
 static const yytype_int16 yypgoto[] =
 {
-    -432,  -432,  -432,   504,  -432,   549,  -432,   271,  -432,   200,
-    -432,  -432,  -432,  -432,   253,   -92,   444,  -432,  -432,  -432,
-     259,  -432,   225,  -432,   109,  -432,  -432,  -432,  -432,   146,
-    -432,  -432,   -50,  -432,  -432,  -432,  -432,  -432,  -432,   460,
-    -432,  -432,   375,  -192,   -84,  -432,    -2,   -71,   -41,  -432,
-    -432,   -85,   327,  -432,  -432,  -432,  -135,  -432,  -432,  -104,
-    -432,   265,  -432,  -432,    10,  -277,  -432,   -55,   279,  -143,
-    -195,  -432,  -432,  -432,  -432,  -432,  -432,   330,  -432,  -432,
-    -432,  -432,  -432,  -138,  -432,  -432,  -432,  -432,  -432,    43,
-     -57,   -77,  -432,  -432,   -93,  -432,  -432,  -432,  -432,  -432,
-    -431,    82,  -432,  -432,  -432,    -1,  -432,  -432,    87,   372,
-    -432,   276,  -432,   356,  -432,   117,  -432,  -432,  -432,   522,
-    -432,  -432,  -432,  -432,  -317
+    -465,  -465,  -465,   553,  -465,   -11,   475,   279,  -465,   163,
+    -465,  -465,  -465,  -465,   285,   -97,   471,  -465,  -465,  -465,
+    -465,  -465,  -465,  -465,   589,  -465,   235,  -465,   382,  -465,
+    -465,   149,  -465,  -465,  -465,  -465,   154,  -465,  -465,   -49,
+    -465,  -465,  -465,  -465,  -465,  -465,  -465,   496,  -465,  -465,
+     399,  -205,   -96,  -465,     6,   -76,   -48,  -465,  -465,   -91,
+     353,  -465,  -465,  -465,  -140,  -465,  -465,    76,  -465,   287,
+    -465,  -465,    -2,  -297,  -465,  -322,   296,  -153,  -209,  -465,
+    -465,  -465,  -465,  -465,  -465,   351,  -465,  -465,  -465,  -465,
+    -465,  -162,  -465,  -465,  -465,  -465,  -465,    55,   -81,   -94,
+    -465,  -465,   -93,  -465,  -465,  -465,  -465,  -465,  -464,    95,
+    -465,  -465,  -465,     2,  -149,   122,  -465,    98,   395,  -465,
+     294,  -465,   385,  -465,   130,  -465,  -465,  -465,   570,  -465,
+    -465,  -465,  -465,  -365
 };
 
 /* YYDEFGOTO[NTERM-NUM].  */
 static const yytype_int16 yydefgoto[] =
 {
-       0,    19,    20,    21,    22,    71,   246,   247,    23,    64,
-      24,   137,    25,    26,    88,   153,   243,    27,    28,    29,
-      83,   273,   274,   275,   371,   455,   451,   460,   461,   462,
-     276,    30,    92,    31,   240,   241,    32,    33,    34,   147,
-      35,   149,   150,    36,   167,   168,   169,    76,   110,   111,
-     172,    77,   164,   248,   329,   330,   144,   502,   563,   114,
-     254,   255,   341,   104,   177,   249,   125,   126,   250,   251,
-     214,   215,   216,   217,   218,   219,   220,   285,   221,   222,
-     223,   224,   225,   194,   195,   196,   226,   227,   228,   229,
-     230,   128,   129,   130,   131,   132,   133,   134,   135,   427,
-     428,   429,   430,   431,    51,   432,   140,   498,   499,   500,
-     335,   262,   263,   264,   349,   446,    37,    38,    61,    62,
-     433,   495,   567,    69,   233
+       0,    19,    20,    21,    22,    73,   262,   263,    23,    66,
+      24,   145,    25,    26,    94,   163,   259,    27,    28,    29,
+      30,    31,    87,   598,    90,   297,   298,   174,   175,   356,
+     299,   405,   490,   486,   495,   496,   497,   300,    32,    98,
+      33,   256,   257,    34,    35,    36,   345,   157,    37,   159,
+     160,    38,   181,   182,   183,    79,   118,   119,   186,    80,
+     178,   268,   360,   361,   154,   538,   604,   122,   274,   275,
+     372,   112,   191,   269,   133,   134,   270,   271,   230,   231,
+     232,   233,   234,   235,   236,   309,   237,   238,   239,   240,
+     241,   208,   209,   210,   242,   243,   244,   245,   246,   136,
+     137,   138,   139,   140,   141,   142,   143,   462,   463,   464,
+     465,   466,    53,   467,    88,   291,   534,   535,   536,   366,
+     282,   283,   284,   380,   481,    39,    40,    63,    64,   468,
+     531,   609,    71,   249
 };
 
 /* YYTABLE[YYPACT[STATE-NUM]] -- What to do in state STATE-NUM.  If
@@ -1144,184 +1169,192 @@ static const yytype_int16 yydefgoto[] =
    number is the opposite.  If YYTABLE_NINF, syntax error.  */
 static const yytype_int16 yytable[] =
 {
-     213,    41,   155,   106,    44,    95,    96,    97,   269,    52,
-     162,    54,   391,   288,   238,   290,   154,   154,    40,   163,
-     332,   562,   379,   127,    73,   170,   332,   570,   170,   174,
-     256,   143,   258,   260,   447,    75,   113,   116,   117,   118,
-     199,   265,    45,   203,   116,   117,   118,    86,    58,    89,
-     293,    46,   339,   231,   476,   398,   464,    98,    39,   331,
-     301,   175,   107,   252,   284,   536,    93,   294,   154,   292,
-     257,   200,   105,   401,   345,   344,   235,   293,   340,   176,
-      40,    47,   399,   141,   142,   376,   204,   205,   206,    59,
-     402,   152,   288,   321,   294,   157,   158,   159,   108,    42,
-     396,   466,   397,   316,   555,    94,   403,   404,   405,   406,
-     407,   408,   409,   410,   411,   412,   413,   414,   415,   416,
-     417,   119,   456,   481,   266,   207,   504,   201,   119,   253,
-     112,   346,   293,   237,   109,   293,    43,   120,   107,   383,
-     384,   291,   333,   382,   120,   347,   515,    74,   497,   294,
-     394,   395,   294,   293,   259,   331,   457,   270,   283,    48,
-     293,   208,   293,   203,   116,   117,   118,    49,   170,   337,
-     294,    53,   348,    55,   108,   209,   443,   294,    50,   294,
-      73,   271,    56,   121,   122,   123,   234,   301,    60,   377,
-     121,   122,   123,   380,   434,   256,   426,   267,   211,   458,
-     439,   440,   527,   478,   444,   445,   204,   205,   206,   381,
-     109,    63,    57,   210,   211,   272,   459,    65,    66,   124,
-     393,   212,   386,   418,   444,   445,   124,   547,   315,   278,
-     316,   279,    70,   471,   487,   203,   116,   117,   118,   561,
-     296,   387,   470,   473,   474,   207,   301,   388,   119,   293,
-     523,   319,   387,   203,   116,   117,   118,   293,   472,   293,
-     448,   557,   336,   127,   120,   421,   294,   342,   127,   469,
-     424,   283,    67,   422,   294,   154,   294,    68,   204,   205,
-     206,   208,   525,    78,   312,   313,   314,   315,    79,   316,
-      73,   293,   293,   522,   549,   209,   204,   205,   206,   182,
-     183,   184,   185,   186,   187,    84,    85,    80,   294,   294,
-     121,   122,   123,    81,    82,   300,   419,   207,   475,    87,
-     119,   318,   301,    99,   319,   518,    90,   520,   521,   480,
-     100,   102,    91,   210,   211,   207,   120,   326,   119,   374,
-     327,   212,   375,   115,   103,   136,   124,   203,   116,   117,
-     118,  -317,  -317,   208,   120,  -317,  -317,   138,   310,   311,
-     312,   313,   314,   315,   139,   316,   484,   209,   143,   181,
-     486,   208,   506,   181,   516,   319,   517,   319,   529,   331,
-     550,   331,   121,   122,   123,   209,   541,   145,   146,   542,
-     286,   205,   206,   148,   151,   116,   203,   116,   117,   118,
-     121,   122,   123,   156,   546,   210,   211,   319,   526,   552,
-     488,   568,   331,   212,   319,   118,    74,   566,   124,   569,
-     161,   171,   163,   210,   211,   165,   166,   173,   178,   207,
-     179,   212,   119,   180,   181,   295,   124,   198,   197,   232,
-     205,   206,   239,   236,   242,   245,   488,   112,   120,   261,
-     268,    15,   489,   277,   280,   281,   488,   490,   282,   320,
-     317,   289,   323,   491,   492,   287,   324,   325,   328,   331,
-     343,   351,   296,   338,   352,   372,   373,    73,   207,   209,
-     493,   119,   392,   389,  -314,   494,   400,   420,   489,   436,
-     441,   442,   449,   490,   121,   122,   123,   120,   489,   491,
-     492,   450,   452,   490,   453,   454,   463,   468,   467,   491,
-     492,   293,   398,   559,   287,   479,   493,   210,   211,   297,
-    -314,   494,   316,   485,   482,   212,   493,   483,   209,   501,
-     124,   494,   503,   505,   496,   507,   508,   509,   510,   298,
-     511,   513,   512,   121,   122,   123,   299,   300,   524,   528,
-     530,   531,   532,   533,   301,   302,   534,   535,   537,   538,
-     540,   543,   560,   558,   544,   545,   210,   211,   548,   551,
-    -267,   564,   101,    72,   212,   556,   565,   423,   519,   124,
-     303,   304,   305,   306,   307,   279,   572,   308,   309,  -316,
-     310,   311,   312,   313,   314,   315,     1,   316,   425,   244,
-     465,     1,   202,   437,     2,   378,  -268,   514,   571,     2,
-     435,     3,   322,   554,   385,     4,     3,   553,   438,   350,
-       4,   539,   160,   334,     0,     0,     5,     0,     0,     6,
-       7,     5,     0,     0,     6,     7,     0,     0,     0,     0,
-       0,     8,     9,     0,     0,   353,     8,     9,     0,   296,
-       0,     0,    10,     0,     0,    11,     0,    10,   354,     0,
-      11,     0,     0,   355,   356,   357,   358,   359,     0,   360,
-       0,     0,     0,     0,     0,     0,    12,   361,     0,     0,
-      13,    12,     0,     0,     0,    13,     0,     0,     0,     0,
-       0,     0,     0,     0,     0,    14,   297,     0,     0,     0,
-      14,    15,     0,   362,     0,     0,    15,     0,   296,     0,
-     477,     0,     0,     0,     0,     0,   390,     0,     0,     0,
-     363,     0,   364,   365,   300,     0,   296,     0,     0,     0,
-       0,   301,   302,     0,     0,     0,     0,   366,     0,     0,
-       0,   367,     0,   368,    16,    17,    18,     0,     0,    16,
-      17,    18,     0,   369,     0,   297,     0,   303,   304,   305,
-     306,   307,     0,     0,   308,   309,     0,   310,   311,   312,
-     313,   314,   315,  -317,   316,   390,     0,     0,     0,     0,
-       0,     0,     0,   300,     0,     0,     0,   370,     0,     0,
-     301,   302,     0,     0,     0,     0,     0,     0,     0,     0,
-       0,   300,     0,     0,     0,     0,     0,     0,   301,  -317,
-       0,     0,     0,     0,     0,     0,   303,   304,   305,   306,
-     307,     0,     0,   308,   309,     0,   310,   311,   312,   313,
-     314,   315,     0,   316,  -317,  -317,  -317,   306,   307,     0,
-       0,   308,   309,     0,   310,   311,   312,   313,   314,   315,
-       0,   316,   182,   183,   184,   185,   186,   187,   188,   189,
-     190,   191,   192,   193
+     229,   114,   135,   165,    43,   164,   164,    46,   101,   102,
+     103,   293,    54,    74,    56,   312,   425,   314,   176,   254,
+     482,    42,   455,   413,   613,   188,   177,   184,   459,   603,
+     184,   285,   121,    85,   276,   146,   278,   280,    76,   153,
+     363,   383,   499,   294,   363,    78,   325,   325,   215,   432,
+      60,   325,    92,   420,    95,   124,   125,   126,   247,   354,
+     109,   164,   104,   289,    47,    76,   266,   295,   573,   267,
+     308,   250,   421,    48,   376,   316,   433,    42,   422,   216,
+     317,   251,   558,   113,   336,   337,   338,   339,   339,   340,
+     340,    61,   151,   152,   340,   355,   410,   318,   375,   346,
+     162,   296,   312,    49,   167,   168,   491,    99,   594,    41,
+     430,   169,   431,   540,   286,   501,   437,   438,   439,   440,
+     441,   442,   443,   444,   445,   446,   447,   448,   449,   450,
+     451,   377,   115,   551,   384,   217,   273,   516,   382,   127,
+     492,   253,    44,   416,   110,   378,   100,   219,   124,   125,
+     126,   213,   315,   417,   418,   128,   317,    86,   317,   147,
+     506,    77,   533,   362,   428,   429,   364,   317,   116,   317,
+     115,   524,   379,   318,    45,   318,   317,   368,   587,   421,
+      67,    68,   184,   493,   318,   507,   318,   189,    57,   370,
+     220,   221,   222,   318,   414,   227,   411,    58,   566,   461,
+     494,   129,   130,   131,   117,   190,   116,   524,   219,   124,
+     125,   126,    52,   525,   317,   371,   276,   563,   526,    50,
+     469,   474,   475,   513,   527,   528,   505,    59,   415,   223,
+     602,   318,   127,   317,   427,    51,   585,   132,   120,   511,
+     612,   529,   117,   478,   362,  -334,   530,   452,   128,   525,
+     318,   220,   221,   222,   526,   357,   523,   272,   279,   342,
+     527,   528,   343,   135,   277,   224,   524,   508,   509,   135,
+     367,   479,   480,   479,   480,   373,   307,   529,   596,   225,
+     317,  -334,   530,    62,   219,   124,   125,   126,   317,   483,
+     223,   559,   164,   127,   129,   130,   131,   318,   317,   457,
+     343,    55,    65,   561,   317,   318,    69,   435,   525,   128,
+     302,    70,   303,   526,   504,   318,   307,   226,   227,   527,
+     528,   318,    72,   600,   436,   228,   224,   220,   221,   222,
+     132,  -284,   351,    81,   353,   352,   529,   352,    82,    76,
+     225,   530,   408,   453,    84,   409,   519,   510,   522,   195,
+     554,   195,   556,   557,    75,   129,   130,   131,   515,    83,
+     219,   124,   125,   126,    89,    93,   223,  -285,   542,   127,
+     552,   343,   601,   343,   553,    96,    97,   362,   226,   227,
+     565,   579,   105,   362,   580,   128,   228,   106,   108,   111,
+     123,   132,   219,   124,   125,   126,   196,   197,   198,   199,
+     200,   201,   224,   220,   221,   222,   588,   584,   590,   591,
+     343,   362,   195,   144,   610,   615,   225,   343,   343,   219,
+     124,   125,   126,   148,   149,   150,   153,   155,   156,   158,
+     161,   129,   130,   131,   124,   310,   221,   222,   562,   135,
+     166,    77,   223,   171,   172,   127,   126,   173,   608,   179,
+     611,   177,   180,   185,   226,   227,   192,   187,   193,   194,
+     319,   128,   228,   221,   222,   211,   212,   132,   195,   214,
+     248,   252,   255,   258,   223,   261,   265,   127,   224,   196,
+     197,   198,   199,   200,   201,   202,   203,   204,   205,   206,
+     207,   120,   225,   128,   281,   287,   288,   320,   292,   290,
+      15,   223,   301,   304,   127,   305,   306,   129,   130,   131,
+     311,   313,   348,   341,   344,   349,   350,   374,   359,   385,
+     128,   362,   369,   406,   225,   386,   407,    76,   423,   434,
+     226,   227,   426,   454,   456,   471,   476,   311,   228,   129,
+     130,   131,   477,   132,   321,   484,   485,   487,   488,   489,
+     498,   225,   502,   503,   432,   514,   317,   340,   521,   517,
+     518,   537,   226,   227,   322,   539,   129,   130,   131,   543,
+     228,   323,   324,   520,   544,   132,   532,   545,   541,   325,
+     326,   546,   547,   548,   549,   568,   560,   564,  -336,   226,
+     227,   569,   567,   570,   571,     1,   572,   228,   574,   597,
+     575,   578,   132,     2,   599,   327,   328,   329,   330,   331,
+       3,   581,   332,   333,     4,   334,   335,   336,   337,   338,
+     339,   303,   340,   107,   582,     5,   595,     1,     6,     7,
+     583,   460,   586,   589,   458,     2,   260,   605,    91,   606,
+       8,     9,     3,   616,   500,   607,     4,   264,   218,   358,
+     550,    10,   347,   555,    11,   412,   472,     5,   470,   419,
+       6,     7,   614,   593,   577,   592,   365,   473,   381,     0,
+     576,   387,     8,     9,     0,    12,   170,     0,     0,    13,
+       0,     0,     0,    10,   388,     0,    11,     0,     0,   389,
+     390,   391,   392,   393,    14,   394,     0,     0,     0,     0,
+      15,     0,     0,   395,     0,     0,     0,    12,     0,     0,
+       0,    13,     0,   320,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,    14,     0,     0,   396,
+       0,     0,    15,     0,   320,     0,     0,     0,     0,     0,
+       0,     0,     0,    16,    17,    18,   397,     0,   398,   399,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+     321,     0,     0,   400,     0,   320,     0,   401,     0,   402,
+       0,     0,     0,     0,   512,    16,    17,    18,     0,   403,
+     424,   321,     0,   320,     0,     0,     0,     0,   324,     0,
+       0,     0,     0,     0,     0,   325,   326,     0,     0,     0,
+       0,   424,     0,     0,     0,     0,     0,     0,     0,   324,
+       0,     0,  -337,   404,     0,     0,   325,   326,     0,     0,
+       0,   327,   328,   329,   330,   331,     0,     0,   332,   333,
+       0,   334,   335,   336,   337,   338,   339,     0,   340,     0,
+     324,     0,   327,   328,   329,   330,   331,   325,  -337,   332,
+     333,     0,   334,   335,   336,   337,   338,   339,   324,   340,
+       0,     0,     0,     0,     0,   325,     0,     0,     0,     0,
+       0,     0,     0,  -337,  -337,  -337,   330,   331,     0,     0,
+     332,   333,     0,   334,   335,   336,   337,   338,   339,     0,
+     340,     0,     0,     0,  -337,  -337,     0,     0,  -337,  -337,
+       0,   334,   335,   336,   337,   338,   339,     0,   340
 };
 
 static const yytype_int16 yycheck[] =
 {
-     143,     2,    94,    74,     5,    55,    56,    57,   200,    10,
-     103,    12,   289,   208,   149,   210,    93,    94,     3,    12,
-       3,    51,     3,    80,    58,   110,     3,     3,   113,   113,
-     173,    83,   175,   176,   351,    37,    77,     4,     5,     6,
-      94,   179,    71,     3,     4,     5,     6,    48,    19,    50,
-     115,    80,    90,   145,   180,   101,   373,    58,    26,   185,
-     136,    55,     9,   167,   207,   496,    94,   132,   145,   212,
-     174,   125,    74,   104,    63,    55,   147,   115,   116,    73,
-       3,   110,   128,    84,    85,   277,    46,    47,    48,    60,
-     121,    92,   287,   236,   132,    96,    97,    99,    45,     3,
-     295,   378,   297,   179,   535,   133,   301,   302,   303,   304,
-     305,   306,   307,   308,   309,   310,   311,   312,   313,   314,
-     315,    88,    27,   400,   181,    85,   443,   181,    88,   170,
-      77,   120,   115,   185,    81,   115,     3,   104,     9,   282,
-     283,   212,   125,   281,   104,   134,   463,   181,   125,   132,
-     293,   294,   132,   115,   114,   185,    61,     3,   111,    94,
-     115,   121,   115,     3,     4,     5,     6,    94,   253,   253,
-     132,    80,   161,    71,    45,   135,   130,   132,    98,   132,
-      58,    27,    80,   150,   151,   152,    64,   136,     3,   182,
-     150,   151,   152,   174,   329,   338,   181,   198,   174,   104,
-     343,   344,   479,   398,   158,   159,    46,    47,    48,   280,
-      81,   154,   110,   173,   174,    61,   121,    17,    18,   186,
-     182,   181,    92,   316,   158,   159,   186,   182,   177,   181,
-     179,   183,   112,    92,   426,     3,     4,     5,     6,   556,
-      54,   111,   108,   386,   387,    85,   136,   117,    88,   115,
-     108,   185,   111,     3,     4,     5,     6,   115,   117,   115,
-     352,   538,   252,   320,   104,   320,   132,   257,   325,   125,
-     325,   111,     0,   323,   132,   352,   132,   184,    46,    47,
-      48,   121,   477,     3,   174,   175,   176,   177,   183,   179,
-      58,   115,   115,   117,   117,   135,    46,    47,    48,   138,
-     139,   140,   141,   142,   143,    46,    47,   181,   132,   132,
-     150,   151,   152,    94,   127,   129,   317,    85,   389,     3,
-      88,   182,   136,   125,   185,   468,   123,   470,   471,   400,
-     185,    97,   127,   173,   174,    85,   104,   182,    88,   182,
-     185,   181,   185,     3,   124,     4,   186,     3,     4,     5,
-       6,   165,   166,   121,   104,   169,   170,   121,   172,   173,
-     174,   175,   176,   177,     3,   179,   182,   135,    83,   185,
-     182,   121,   182,   185,   182,   185,   182,   185,   182,   185,
-     523,   185,   150,   151,   152,   135,   182,    93,   181,   185,
-      46,    47,    48,     3,    46,     4,     3,     4,     5,     6,
-     150,   151,   152,     3,   182,   173,   174,   185,   479,   182,
-      25,   182,   185,   181,   185,     6,   181,   560,   186,   562,
-     181,   114,    12,   173,   174,   182,   182,   126,     4,    85,
-       4,   181,    88,   182,   185,    17,   186,   131,    46,     3,
-      47,    48,    91,   162,   112,     3,    25,    77,   104,   118,
-       3,   112,    67,   125,   181,   181,    25,    72,   181,   181,
-      98,   179,    39,    78,    79,   121,    49,   181,    94,   185,
-      55,   181,    54,   185,    93,   120,   181,    58,    85,   135,
-      95,    88,   182,   181,    99,   100,   181,     3,    67,     3,
-     161,   120,   181,    72,   150,   151,   152,   104,    67,    78,
-      79,   181,   181,    72,   181,   181,   181,    94,   182,    78,
-      79,   115,   101,    82,   121,   181,    95,   173,   174,   101,
-      99,   100,   179,     3,   104,   181,    95,   180,   135,    70,
-     186,   100,    63,   160,   185,     6,     6,     6,     6,   121,
-       6,   104,   120,   150,   151,   152,   128,   129,   182,   182,
-     182,    99,    78,    78,   136,   137,    78,    99,     3,   126,
-     182,   182,   131,     6,   182,   182,   173,   174,   182,   182,
-     185,   182,    68,    24,   181,   181,   181,   324,   469,   186,
-     162,   163,   164,   165,   166,   183,   182,   169,   170,     0,
-     172,   173,   174,   175,   176,   177,     7,   179,   327,   155,
-     375,     7,   142,   338,    15,   278,   185,   461,   565,    15,
-     331,    22,   237,   531,   284,    26,    22,   530,   342,   263,
-      26,   504,   100,   251,    -1,    -1,    37,    -1,    -1,    40,
-      41,    37,    -1,    -1,    40,    41,    -1,    -1,    -1,    -1,
-      -1,    52,    53,    -1,    -1,    11,    52,    53,    -1,    54,
-      -1,    -1,    63,    -1,    -1,    66,    -1,    63,    24,    -1,
-      66,    -1,    -1,    29,    30,    31,    32,    33,    -1,    35,
-      -1,    -1,    -1,    -1,    -1,    -1,    87,    43,    -1,    -1,
-      91,    87,    -1,    -1,    -1,    91,    -1,    -1,    -1,    -1,
-      -1,    -1,    -1,    -1,    -1,   106,   101,    -1,    -1,    -1,
-     106,   112,    -1,    69,    -1,    -1,   112,    -1,    54,    -1,
-     115,    -1,    -1,    -1,    -1,    -1,   121,    -1,    -1,    -1,
-      86,    -1,    88,    89,   129,    -1,    54,    -1,    -1,    -1,
-      -1,   136,   137,    -1,    -1,    -1,    -1,   103,    -1,    -1,
-      -1,   107,    -1,   109,   155,   156,   157,    -1,    -1,   155,
-     156,   157,    -1,   119,    -1,   101,    -1,   162,   163,   164,
-     165,   166,    -1,    -1,   169,   170,    -1,   172,   173,   174,
-     175,   176,   177,   101,   179,   121,    -1,    -1,    -1,    -1,
-      -1,    -1,    -1,   129,    -1,    -1,    -1,   153,    -1,    -1,
-     136,   137,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
-      -1,   129,    -1,    -1,    -1,    -1,    -1,    -1,   136,   137,
-      -1,    -1,    -1,    -1,    -1,    -1,   162,   163,   164,   165,
-     166,    -1,    -1,   169,   170,    -1,   172,   173,   174,   175,
-     176,   177,    -1,   179,   162,   163,   164,   165,   166,    -1,
-      -1,   169,   170,    -1,   172,   173,   174,   175,   176,   177,
-      -1,   179,   138,   139,   140,   141,   142,   143,   144,   145,
-     146,   147,   148,   149
+     153,    77,    83,   100,     2,    99,   100,     5,    57,    58,
+      59,   216,    10,    24,    12,   224,   313,   226,   111,   159,
+     385,     3,   344,     3,     3,   121,    12,   118,   350,    51,
+     121,   193,    80,     3,   187,     3,   189,   190,    58,    83,
+       3,     3,   407,     3,     3,    39,   136,   136,    94,   101,
+      19,   136,    50,    92,    52,     4,     5,     6,   155,     3,
+      97,   155,    60,   212,    71,    58,   182,    27,   532,   185,
+     223,    64,   111,    80,    63,   228,   128,     3,   117,   125,
+     115,   157,   117,    77,   174,   175,   176,   177,   177,   179,
+     179,    60,    90,    91,   179,    39,   301,   132,    55,   252,
+      98,    61,   311,   110,   102,   103,    27,    94,   572,    26,
+     319,   105,   321,   478,   195,   412,   325,   326,   327,   328,
+     329,   330,   331,   332,   333,   334,   335,   336,   337,   338,
+     339,   120,     9,   498,    96,   181,   184,   434,   287,    88,
+      61,   185,     3,   305,   181,   134,   133,     3,     4,     5,
+       6,   149,   228,   306,   307,   104,   115,   127,   115,   127,
+      92,   181,   125,   185,   317,   318,   125,   115,    45,   115,
+       9,    25,   161,   132,     3,   132,   115,   273,   117,   111,
+      17,    18,   273,   104,   132,   117,   132,    55,    71,    90,
+      46,    47,    48,   132,   174,   174,   182,    80,   520,   181,
+     121,   150,   151,   152,    81,    73,    45,    25,     3,     4,
+       5,     6,    98,    67,   115,   116,   369,   514,    72,    94,
+     360,   374,   375,   432,    78,    79,   108,   110,   304,    85,
+     595,   132,    88,   115,   182,    94,   182,   186,    77,   180,
+     605,    95,    81,   130,   185,    99,   100,   340,   104,    67,
+     132,    46,    47,    48,    72,   266,   461,   181,   114,   182,
+      78,    79,   185,   344,   188,   121,    25,   420,   421,   350,
+     272,   158,   159,   158,   159,   277,   111,    95,   575,   135,
+     115,    99,   100,     3,     3,     4,     5,     6,   115,   386,
+      85,   108,   386,    88,   150,   151,   152,   132,   115,   348,
+     185,    80,   154,   512,   115,   132,     0,   104,    67,   104,
+     181,   184,   183,    72,   125,   132,   111,   173,   174,    78,
+      79,   132,   112,    82,   121,   181,   121,    46,    47,    48,
+     186,   185,   182,     3,   182,   185,    95,   185,   183,    58,
+     135,   100,   182,   341,    94,   185,   182,   423,   182,   185,
+     503,   185,   505,   506,   112,   150,   151,   152,   434,   181,
+       3,     4,     5,     6,   127,     3,    85,   185,   182,    88,
+     182,   185,   131,   185,   182,   123,   127,   185,   173,   174,
+     182,   182,   125,   185,   185,   104,   181,   185,    97,   124,
+       3,   186,     3,     4,     5,     6,   138,   139,   140,   141,
+     142,   143,   121,    46,    47,    48,   559,   182,   182,   182,
+     185,   185,   185,     4,   182,   182,   135,   185,   185,     3,
+       4,     5,     6,   121,   131,   121,    83,    93,   181,     3,
+      46,   150,   151,   152,     4,    46,    47,    48,   514,   520,
+       3,   181,    85,   181,   181,    88,     6,     3,   601,   182,
+     603,    12,   182,   114,   173,   174,     4,   126,     4,   182,
+      17,   104,   181,    47,    48,   121,    46,   186,   185,    46,
+       3,   162,    91,   112,    85,     3,   162,    88,   121,   138,
+     139,   140,   141,   142,   143,   144,   145,   146,   147,   148,
+     149,    77,   135,   104,   118,    46,     3,    54,     3,    82,
+     112,    85,   125,   181,    88,   181,   181,   150,   151,   152,
+     121,   179,    39,    98,   181,    49,   181,    55,    94,   181,
+     104,   185,   185,   120,   135,    93,   181,    58,   181,   181,
+     173,   174,   182,     3,   185,     3,   161,   121,   181,   150,
+     151,   152,   120,   186,   101,   181,   181,   181,   181,   181,
+     181,   135,   182,    94,   101,   181,   115,   179,     3,   104,
+     180,    70,   173,   174,   121,    63,   150,   151,   152,     6,
+     181,   128,   129,   181,     6,   186,   185,     6,   160,   136,
+     137,     6,     6,   120,   104,    99,   182,   182,     0,   173,
+     174,    78,   182,    78,    78,     7,    99,   181,     3,     3,
+     126,   182,   186,    15,     6,   162,   163,   164,   165,   166,
+      22,   182,   169,   170,    26,   172,   173,   174,   175,   176,
+     177,   183,   179,    70,   182,    37,   181,     7,    40,    41,
+     182,   352,   182,   182,   349,    15,   165,   181,    49,   182,
+      52,    53,    22,   182,   409,   181,    26,   172,   152,   267,
+     496,    63,   253,   504,    66,   302,   369,    37,   362,   308,
+      40,    41,   607,   568,   542,   567,   271,   373,   283,    -1,
+     540,    11,    52,    53,    -1,    87,   106,    -1,    -1,    91,
+      -1,    -1,    -1,    63,    24,    -1,    66,    -1,    -1,    29,
+      30,    31,    32,    33,   106,    35,    -1,    -1,    -1,    -1,
+     112,    -1,    -1,    43,    -1,    -1,    -1,    87,    -1,    -1,
+      -1,    91,    -1,    54,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,   106,    -1,    -1,    69,
+      -1,    -1,   112,    -1,    54,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,   155,   156,   157,    86,    -1,    88,    89,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+     101,    -1,    -1,   103,    -1,    54,    -1,   107,    -1,   109,
+      -1,    -1,    -1,    -1,   115,   155,   156,   157,    -1,   119,
+     121,   101,    -1,    54,    -1,    -1,    -1,    -1,   129,    -1,
+      -1,    -1,    -1,    -1,    -1,   136,   137,    -1,    -1,    -1,
+      -1,   121,    -1,    -1,    -1,    -1,    -1,    -1,    -1,   129,
+      -1,    -1,   101,   153,    -1,    -1,   136,   137,    -1,    -1,
+      -1,   162,   163,   164,   165,   166,    -1,    -1,   169,   170,
+      -1,   172,   173,   174,   175,   176,   177,    -1,   179,    -1,
+     129,    -1,   162,   163,   164,   165,   166,   136,   137,   169,
+     170,    -1,   172,   173,   174,   175,   176,   177,   129,   179,
+      -1,    -1,    -1,    -1,    -1,   136,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,   162,   163,   164,   165,   166,    -1,    -1,
+     169,   170,    -1,   172,   173,   174,   175,   176,   177,    -1,
+     179,    -1,    -1,    -1,   165,   166,    -1,    -1,   169,   170,
+      -1,   172,   173,   174,   175,   176,   177,    -1,   179
 };
 
 /* YYSTOS[STATE-NUM] -- The symbol kind of the accessing symbol of
@@ -1331,98 +1364,104 @@ static const yytype_int16 yystos[] =
        0,     7,    15,    22,    26,    37,    40,    41,    52,    53,
       63,    66,    87,    91,   106,   112,   155,   156,   157,   188,
      189,   190,   191,   195,   197,   199,   200,   204,   205,   206,
-     218,   220,   223,   224,   225,   227,   230,   303,   304,    26,
-       3,   292,     3,     3,   292,    71,    80,   110,    94,    94,
-      98,   291,   292,    80,   292,    71,    80,   110,    19,    60,
-       3,   305,   306,   154,   196,   196,   196,     0,   184,   310,
-     112,   192,   192,    58,   181,   233,   234,   238,     3,   183,
-     181,    94,   127,   207,   207,   207,   292,     3,   201,   292,
-     123,   127,   219,    94,   133,   219,   219,   219,   292,   125,
-     185,   190,    97,   124,   250,   233,   234,     9,    45,    81,
-     235,   236,    77,   235,   246,     3,     4,     5,     6,    88,
-     104,   150,   151,   152,   186,   253,   254,   277,   278,   279,
-     280,   281,   282,   283,   284,   285,     4,   198,   121,     3,
-     293,   292,   292,    83,   243,    93,   181,   226,     3,   228,
-     229,    46,   292,   202,   278,   202,     3,   292,   292,   233,
-     306,   181,   281,    12,   239,   182,   182,   231,   232,   233,
-     238,   114,   237,   126,   231,    55,    73,   251,     4,     4,
-     182,   185,   138,   139,   140,   141,   142,   143,   144,   145,
-     146,   147,   148,   149,   270,   271,   272,    46,   131,    94,
-     125,   181,   226,     3,    46,    47,    48,    85,   121,   135,
-     173,   174,   181,   256,   257,   258,   259,   260,   261,   262,
-     263,   265,   266,   267,   268,   269,   273,   274,   275,   276,
-     277,   202,     3,   311,    64,   234,   162,   185,   243,    91,
-     221,   222,   112,   203,   203,     3,   193,   194,   240,   252,
-     255,   256,   246,   235,   247,   248,   256,   246,   256,   114,
-     256,   118,   298,   299,   300,   270,   277,   292,     3,   230,
-       3,    27,    61,   208,   209,   210,   217,   125,   181,   183,
-     181,   181,   181,   111,   256,   264,    46,   121,   257,   179,
-     257,   234,   256,   115,   132,    17,    54,   101,   121,   128,
-     129,   136,   137,   162,   163,   164,   165,   166,   169,   170,
-     172,   173,   174,   175,   176,   177,   179,    98,   182,   185,
-     181,   256,   229,    39,    49,   181,   182,   185,    94,   241,
-     242,   185,     3,   125,   296,   297,   251,   231,   185,    90,
-     116,   249,   251,    55,    55,    63,   120,   134,   161,   301,
-     300,   181,    93,    11,    24,    29,    30,    31,    32,    33,
-      35,    43,    69,    86,    88,    89,   103,   107,   109,   119,
-     153,   211,   120,   181,   182,   185,   230,   182,   239,     3,
-     174,   234,   270,   256,   256,   264,    92,   111,   117,   181,
-     121,   252,   182,   182,   256,   256,   257,   257,   101,   128,
-     181,   104,   121,   257,   257,   257,   257,   257,   257,   257,
-     257,   257,   257,   257,   257,   257,   257,   257,   281,   292,
-       3,   254,   219,   201,   254,   194,   181,   286,   287,   288,
-     289,   290,   292,   307,   243,   255,     3,   248,   298,   256,
-     256,   161,   120,   130,   158,   159,   302,   311,   202,   181,
-     181,   213,   181,   181,   181,   212,    27,    61,   104,   121,
-     214,   215,   216,   181,   311,   209,   252,   182,    94,   125,
-     108,    92,   117,   256,   256,   234,   180,   115,   257,   181,
-     234,   252,   104,   180,   182,     3,   182,   230,    25,    67,
-      72,    78,    79,    95,   100,   308,   185,   125,   294,   295,
-     296,    70,   244,    63,   311,   160,   182,     6,     6,     6,
-       6,     6,   120,   104,   216,   311,   182,   182,   256,   211,
-     256,   256,   117,   108,   182,   257,   234,   252,   182,   182,
-     182,    99,    78,    78,    78,    99,   287,     3,   126,   302,
-     182,   182,   185,   182,   182,   182,   182,   182,   182,   117,
-     256,   182,   182,   295,   288,   287,   181,   252,     6,    82,
-     131,   311,    51,   245,   182,   181,   256,   309,   182,   256,
-       3,   276,   182
+     207,   208,   225,   227,   230,   231,   232,   235,   238,   312,
+     313,    26,     3,   300,     3,     3,   300,    71,    80,   110,
+      94,    94,    98,   299,   300,    80,   300,    71,    80,   110,
+      19,    60,     3,   314,   315,   154,   196,   196,   196,     0,
+     184,   319,   112,   192,   192,   112,    58,   181,   241,   242,
+     246,     3,   183,   181,    94,     3,   127,   209,   301,   127,
+     211,   211,   300,     3,   201,   300,   123,   127,   226,    94,
+     133,   226,   226,   226,   300,   125,   185,   190,    97,    97,
+     181,   124,   258,   241,   242,     9,    45,    81,   243,   244,
+      77,   243,   254,     3,     4,     5,     6,    88,   104,   150,
+     151,   152,   186,   261,   262,   285,   286,   287,   288,   289,
+     290,   291,   292,   293,     4,   198,     3,   127,   121,   131,
+     121,   300,   300,    83,   251,    93,   181,   234,     3,   236,
+     237,    46,   300,   202,   286,   202,     3,   300,   300,   241,
+     315,   181,   181,     3,   214,   215,   289,    12,   247,   182,
+     182,   239,   240,   241,   246,   114,   245,   126,   239,    55,
+      73,   259,     4,     4,   182,   185,   138,   139,   140,   141,
+     142,   143,   144,   145,   146,   147,   148,   149,   278,   279,
+     280,   121,    46,   300,    46,    94,   125,   181,   234,     3,
+      46,    47,    48,    85,   121,   135,   173,   174,   181,   264,
+     265,   266,   267,   268,   269,   270,   271,   273,   274,   275,
+     276,   277,   281,   282,   283,   284,   285,   202,     3,   320,
+      64,   242,   162,   185,   251,    91,   228,   229,   112,   203,
+     203,     3,   193,   194,   193,   162,   182,   185,   248,   260,
+     263,   264,   254,   243,   255,   256,   264,   254,   264,   114,
+     264,   118,   307,   308,   309,   278,   285,    46,     3,   301,
+      82,   302,     3,   238,     3,    27,    61,   212,   213,   217,
+     224,   125,   181,   183,   181,   181,   181,   111,   264,   272,
+      46,   121,   265,   179,   265,   242,   264,   115,   132,    17,
+      54,   101,   121,   128,   129,   136,   137,   162,   163,   164,
+     165,   166,   169,   170,   172,   173,   174,   175,   176,   177,
+     179,    98,   182,   185,   181,   233,   264,   237,    39,    49,
+     181,   182,   185,   182,     3,    39,   216,   192,   215,    94,
+     249,   250,   185,     3,   125,   305,   306,   259,   239,   185,
+      90,   116,   257,   259,    55,    55,    63,   120,   134,   161,
+     310,   309,   301,     3,    96,   181,    93,    11,    24,    29,
+      30,    31,    32,    33,    35,    43,    69,    86,    88,    89,
+     103,   107,   109,   119,   153,   218,   120,   181,   182,   185,
+     238,   182,   247,     3,   174,   242,   278,   264,   264,   272,
+      92,   111,   117,   181,   121,   260,   182,   182,   264,   264,
+     265,   265,   101,   128,   181,   104,   121,   265,   265,   265,
+     265,   265,   265,   265,   265,   265,   265,   265,   265,   265,
+     265,   265,   289,   300,     3,   262,   185,   226,   201,   262,
+     194,   181,   294,   295,   296,   297,   298,   300,   316,   251,
+     263,     3,   256,   307,   264,   264,   161,   120,   130,   158,
+     159,   311,   320,   202,   181,   181,   220,   181,   181,   181,
+     219,    27,    61,   104,   121,   221,   222,   223,   181,   320,
+     213,   260,   182,    94,   125,   108,    92,   117,   264,   264,
+     242,   180,   115,   265,   181,   242,   260,   104,   180,   182,
+     181,     3,   182,   238,    25,    67,    72,    78,    79,    95,
+     100,   317,   185,   125,   303,   304,   305,    70,   252,    63,
+     320,   160,   182,     6,     6,     6,     6,     6,   120,   104,
+     223,   320,   182,   182,   264,   218,   264,   264,   117,   108,
+     182,   265,   242,   260,   182,   182,   262,   182,    99,    78,
+      78,    78,    99,   295,     3,   126,   311,   302,   182,   182,
+     185,   182,   182,   182,   182,   182,   182,   117,   264,   182,
+     182,   182,   304,   296,   295,   181,   260,     3,   210,     6,
+      82,   131,   320,    51,   253,   181,   182,   181,   264,   318,
+     182,   264,   320,     3,   284,   182,   182
 };
 
 /* YYR1[RULE-NUM] -- Symbol kind of the left-hand side of rule RULE-NUM.  */
 static const yytype_int16 yyr1[] =
 {
        0,   187,   188,   189,   189,   190,   190,   190,   190,   190,
-     191,   191,   191,   191,   191,   191,   191,   191,   191,   191,
-     192,   192,   193,   193,   194,   194,   195,   195,   195,   196,
-     196,   197,   198,   199,   199,   200,   200,   201,   202,   203,
-     203,   204,   205,   205,   205,   206,   206,   206,   206,   206,
-     207,   207,   208,   208,   209,   209,   210,   211,   211,   211,
-     211,   211,   211,   211,   211,   211,   211,   211,   211,   211,
-     211,   211,   211,   211,   211,   212,   212,   213,   213,   213,
-     214,   214,   215,   215,   216,   216,   216,   216,   217,   217,
-     218,   218,   218,   218,   219,   219,   220,   221,   222,   223,
-     224,   225,   225,   226,   226,   227,   228,   228,   229,   230,
-     230,   230,   231,   231,   232,   232,   233,   233,   234,   234,
-     235,   236,   236,   236,   237,   237,   238,   239,   239,   240,
-     241,   241,   242,   243,   243,   244,   244,   245,   245,   246,
-     246,   247,   247,   248,   249,   249,   249,   250,   250,   251,
-     251,   251,   251,   251,   251,   252,   252,   253,   253,   254,
-     254,   255,   256,   256,   256,   256,   256,   257,   257,   257,
-     257,   257,   257,   257,   257,   257,   257,   257,   258,   258,
-     259,   259,   259,   259,   259,   260,   260,   260,   260,   260,
-     260,   260,   260,   260,   260,   260,   261,   261,   262,   262,
-     262,   262,   263,   263,   263,   263,   264,   264,   265,   265,
-     266,   266,   266,   266,   266,   266,   266,   267,   267,   268,
-     269,   270,   270,   270,   270,   270,   270,   271,   271,   271,
-     271,   271,   271,   272,   272,   273,   274,   275,   276,   276,
-     276,   276,   277,   277,   277,   277,   277,   277,   277,   278,
-     279,   279,   280,   280,   281,   282,   283,   284,   284,   284,
-     285,   286,   286,   287,   287,   288,   288,   289,   289,   290,
-     291,   292,   292,   293,   293,   294,   294,   295,   295,   296,
-     296,   297,   297,   298,   298,   299,   299,   300,   300,   301,
-     301,   301,   301,   302,   302,   302,   303,   303,   304,   305,
-     305,   306,   307,   307,   307,   308,   308,   308,   308,   308,
-     308,   308,   308,   308,   308,   309,   310,   310,   311,   311
+     190,   191,   191,   191,   191,   191,   191,   191,   191,   191,
+     191,   192,   192,   193,   193,   194,   194,   195,   195,   195,
+     196,   196,   197,   198,   199,   199,   200,   200,   201,   202,
+     203,   203,   204,   205,   205,   205,   206,   206,   206,   206,
+     207,   207,   207,   208,   209,   209,   209,   209,   210,   210,
+     211,   211,   212,   212,   213,   213,   214,   214,   215,   216,
+     216,   217,   218,   218,   218,   218,   218,   218,   218,   218,
+     218,   218,   218,   218,   218,   218,   218,   218,   218,   218,
+     219,   219,   220,   220,   220,   221,   221,   222,   222,   223,
+     223,   223,   223,   224,   224,   225,   225,   225,   225,   226,
+     226,   227,   228,   229,   230,   231,   232,   232,   233,   233,
+     234,   234,   235,   236,   236,   237,   238,   238,   238,   239,
+     239,   240,   240,   241,   241,   242,   242,   243,   244,   244,
+     244,   245,   245,   246,   247,   247,   248,   249,   249,   250,
+     251,   251,   252,   252,   253,   253,   254,   254,   255,   255,
+     256,   257,   257,   257,   258,   258,   259,   259,   259,   259,
+     259,   259,   260,   260,   261,   261,   262,   262,   263,   264,
+     264,   264,   264,   264,   265,   265,   265,   265,   265,   265,
+     265,   265,   265,   265,   265,   266,   266,   267,   267,   267,
+     267,   267,   268,   268,   268,   268,   268,   268,   268,   268,
+     268,   268,   268,   269,   269,   270,   270,   270,   270,   271,
+     271,   271,   271,   272,   272,   273,   273,   274,   274,   274,
+     274,   274,   274,   274,   275,   275,   276,   277,   278,   278,
+     278,   278,   278,   278,   279,   279,   279,   279,   279,   279,
+     280,   280,   281,   282,   283,   284,   284,   284,   284,   285,
+     285,   285,   285,   285,   285,   285,   286,   287,   287,   288,
+     288,   289,   290,   291,   292,   292,   292,   293,   294,   294,
+     295,   295,   296,   296,   297,   297,   298,   299,   300,   300,
+     301,   301,   302,   302,   302,   303,   303,   304,   304,   305,
+     305,   306,   306,   307,   307,   308,   308,   309,   309,   310,
+     310,   310,   310,   311,   311,   311,   312,   312,   313,   314,
+     314,   315,   316,   316,   316,   317,   317,   317,   317,   317,
+     317,   317,   317,   317,   317,   318,   319,   319,   320,   320
 };
 
 /* YYR2[RULE-NUM] -- Number of symbols on the right-hand side of rule RULE-NUM.  */
@@ -1430,32 +1469,34 @@ static const yytype_int8 yyr2[] =
 {
        0,     2,     2,     1,     3,     2,     2,     1,     1,     1,
        1,     1,     1,     1,     1,     1,     1,     1,     1,     1,
-       5,     0,     1,     3,     1,     4,     2,     2,     2,     1,
-       0,     4,     1,     2,     5,     7,     5,     1,     1,     3,
-       0,     5,     2,     3,     2,     8,     7,     6,     9,     7,
-       3,     0,     1,     3,     1,     1,     3,     1,     1,     4,
-       4,     1,     1,     2,     1,     1,     1,     1,     1,     1,
-       1,     1,     2,     1,     4,     3,     0,     5,     3,     0,
-       1,     0,     1,     2,     2,     1,     1,     2,     5,     4,
-       4,     4,     3,     4,     2,     0,     5,     1,     4,     4,
-       2,     8,     5,     3,     0,     5,     1,     3,     3,     2,
-       2,     6,     1,     1,     1,     3,     3,     3,     4,     6,
-       2,     1,     1,     1,     1,     0,     7,     1,     0,     1,
-       1,     0,     2,     2,     0,     4,     0,     2,     0,     3,
-       0,     1,     3,     2,     1,     1,     0,     2,     0,     2,
-       2,     4,     2,     4,     0,     1,     3,     1,     0,     1,
-       3,     2,     1,     1,     1,     1,     1,     3,     1,     1,
-       1,     1,     1,     1,     1,     1,     1,     3,     1,     1,
-       2,     2,     2,     3,     4,     1,     3,     3,     3,     3,
-       3,     3,     3,     4,     3,     3,     3,     3,     5,     6,
-       5,     6,     4,     6,     3,     5,     4,     5,     4,     5,
-       3,     3,     3,     3,     3,     3,     3,     3,     5,     6,
-       6,     1,     1,     1,     1,     1,     1,     1,     1,     1,
-       1,     1,     1,     1,     1,     4,     4,     5,     1,     3,
-       1,     3,     1,     1,     1,     1,     1,     1,     1,     1,
-       1,     1,     1,     1,     1,     1,     2,     2,     3,     2,
-       1,     1,     3,     1,     1,     1,     4,     1,     3,     2,
-       1,     1,     3,     1,     0,     1,     5,     1,     0,     2,
+       1,     5,     0,     1,     3,     1,     4,     2,     2,     2,
+       1,     0,     4,     1,     2,     5,     7,     5,     1,     1,
+       3,     0,     5,     2,     3,     2,     8,     6,    11,     7,
+       1,     6,     6,     7,     1,     4,     2,     5,     4,     0,
+       3,     0,     1,     3,     1,     1,     1,     3,     3,     1,
+       1,     3,     1,     1,     4,     4,     1,     1,     2,     1,
+       1,     1,     1,     1,     1,     1,     1,     2,     1,     4,
+       3,     0,     5,     3,     0,     1,     0,     1,     2,     2,
+       1,     1,     2,     5,     4,     4,     4,     3,     4,     2,
+       0,     5,     1,     4,     4,     2,     6,     5,     3,     5,
+       3,     0,     5,     1,     3,     3,     2,     2,     6,     1,
+       1,     1,     3,     3,     3,     4,     6,     2,     1,     1,
+       1,     1,     0,     7,     1,     0,     1,     1,     0,     2,
+       2,     0,     4,     0,     2,     0,     3,     0,     1,     3,
+       2,     1,     1,     0,     2,     0,     2,     2,     4,     2,
+       4,     0,     1,     3,     1,     0,     1,     3,     2,     1,
+       1,     1,     1,     1,     3,     1,     1,     1,     1,     1,
+       1,     1,     1,     1,     3,     1,     1,     2,     2,     2,
+       3,     4,     1,     3,     3,     3,     3,     3,     3,     3,
+       4,     3,     3,     3,     3,     5,     6,     5,     6,     4,
+       6,     3,     5,     4,     5,     4,     5,     3,     3,     3,
+       3,     3,     3,     3,     3,     5,     6,     6,     1,     1,
+       1,     1,     1,     1,     1,     1,     1,     1,     1,     1,
+       1,     1,     4,     4,     5,     1,     3,     1,     3,     1,
+       1,     1,     1,     1,     1,     1,     1,     1,     1,     1,
+       1,     1,     1,     2,     2,     3,     2,     1,     1,     3,
+       1,     1,     1,     4,     1,     3,     2,     1,     1,     3,
+       1,     0,     2,     2,     0,     1,     5,     1,     0,     2,
        1,     1,     0,     1,     0,     1,     2,     3,     5,     1,
        3,     1,     2,     2,     1,     0,     1,     0,     2,     1,
        3,     3,     4,     6,     8,     1,     2,     1,     2,     1,
@@ -2023,31 +2064,31 @@ yydestruct (const char *yymsg,
   switch (yykind)
     {
     case YYSYMBOL_IDENTIFIER: /* IDENTIFIER  */
-#line 176 "bison_parser.y"
+#line 179 "bison_parser.y"
                 { free( (((*yyvaluep).sval)) ); }
-#line 2029 "bison_parser.cpp"
+#line 2070 "bison_parser.cpp"
         break;
 
     case YYSYMBOL_STRING: /* STRING  */
-#line 176 "bison_parser.y"
+#line 179 "bison_parser.y"
                 { free( (((*yyvaluep).sval)) ); }
-#line 2035 "bison_parser.cpp"
+#line 2076 "bison_parser.cpp"
         break;
 
     case YYSYMBOL_FLOATVAL: /* FLOATVAL  */
-#line 166 "bison_parser.y"
+#line 169 "bison_parser.y"
                 { }
-#line 2041 "bison_parser.cpp"
+#line 2082 "bison_parser.cpp"
         break;
 
     case YYSYMBOL_INTVAL: /* INTVAL  */
-#line 166 "bison_parser.y"
+#line 169 "bison_parser.y"
                 { }
-#line 2047 "bison_parser.cpp"
+#line 2088 "bison_parser.cpp"
         break;
 
     case YYSYMBOL_statement_list: /* statement_list  */
-#line 177 "bison_parser.y"
+#line 180 "bison_parser.y"
                 {
       if ((((*yyvaluep).stmt_vec)) != nullptr) {
         for (auto ptr : *(((*yyvaluep).stmt_vec))) {
@@ -2056,23 +2097,23 @@ yydestruct (const char *yymsg,
       }
       delete (((*yyvaluep).stmt_vec));
     }
-#line 2060 "bison_parser.cpp"
+#line 2101 "bison_parser.cpp"
         break;
 
     case YYSYMBOL_statement: /* statement  */
-#line 185 "bison_parser.y"
+#line 199 "bison_parser.y"
                 { delete (((*yyvaluep).statement)); }
-#line 2066 "bison_parser.cpp"
+#line 2107 "bison_parser.cpp"
         break;
 
     case YYSYMBOL_preparable_statement: /* preparable_statement  */
-#line 185 "bison_parser.y"
+#line 199 "bison_parser.y"
                 { delete (((*yyvaluep).statement)); }
-#line 2072 "bison_parser.cpp"
+#line 2113 "bison_parser.cpp"
         break;
 
     case YYSYMBOL_opt_hints: /* opt_hints  */
-#line 177 "bison_parser.y"
+#line 180 "bison_parser.y"
                 {
       if ((((*yyvaluep).expr_vec)) != nullptr) {
         for (auto ptr : *(((*yyvaluep).expr_vec))) {
@@ -2081,11 +2122,11 @@ yydestruct (const char *yymsg,
       }
       delete (((*yyvaluep).expr_vec));
     }
-#line 2085 "bison_parser.cpp"
+#line 2126 "bison_parser.cpp"
         break;
 
     case YYSYMBOL_hint_list: /* hint_list  */
-#line 177 "bison_parser.y"
+#line 180 "bison_parser.y"
                 {
       if ((((*yyvaluep).expr_vec)) != nullptr) {
         for (auto ptr : *(((*yyvaluep).expr_vec))) {
@@ -2094,89 +2135,120 @@ yydestruct (const char *yymsg,
       }
       delete (((*yyvaluep).expr_vec));
     }
-#line 2098 "bison_parser.cpp"
+#line 2139 "bison_parser.cpp"
         break;
 
     case YYSYMBOL_hint: /* hint  */
-#line 185 "bison_parser.y"
+#line 199 "bison_parser.y"
                 { delete (((*yyvaluep).expr)); }
-#line 2104 "bison_parser.cpp"
+#line 2145 "bison_parser.cpp"
         break;
 
     case YYSYMBOL_transaction_statement: /* transaction_statement  */
-#line 185 "bison_parser.y"
+#line 199 "bison_parser.y"
                 { delete (((*yyvaluep).transaction_stmt)); }
-#line 2110 "bison_parser.cpp"
+#line 2151 "bison_parser.cpp"
         break;
 
     case YYSYMBOL_prepare_statement: /* prepare_statement  */
-#line 185 "bison_parser.y"
+#line 199 "bison_parser.y"
                 { delete (((*yyvaluep).prep_stmt)); }
-#line 2116 "bison_parser.cpp"
+#line 2157 "bison_parser.cpp"
         break;
 
     case YYSYMBOL_prepare_target_query: /* prepare_target_query  */
-#line 176 "bison_parser.y"
+#line 179 "bison_parser.y"
                 { free( (((*yyvaluep).sval)) ); }
-#line 2122 "bison_parser.cpp"
+#line 2163 "bison_parser.cpp"
         break;
 
     case YYSYMBOL_execute_statement: /* execute_statement  */
-#line 185 "bison_parser.y"
+#line 199 "bison_parser.y"
                 { delete (((*yyvaluep).exec_stmt)); }
-#line 2128 "bison_parser.cpp"
+#line 2169 "bison_parser.cpp"
         break;
 
     case YYSYMBOL_import_statement: /* import_statement  */
-#line 185 "bison_parser.y"
+#line 199 "bison_parser.y"
                 { delete (((*yyvaluep).import_stmt)); }
-#line 2134 "bison_parser.cpp"
+#line 2175 "bison_parser.cpp"
         break;
 
     case YYSYMBOL_file_type: /* file_type  */
-#line 166 "bison_parser.y"
+#line 169 "bison_parser.y"
                 { }
-#line 2140 "bison_parser.cpp"
+#line 2181 "bison_parser.cpp"
         break;
 
     case YYSYMBOL_file_path: /* file_path  */
-#line 176 "bison_parser.y"
+#line 179 "bison_parser.y"
                 { free( (((*yyvaluep).sval)) ); }
-#line 2146 "bison_parser.cpp"
+#line 2187 "bison_parser.cpp"
         break;
 
     case YYSYMBOL_opt_file_type: /* opt_file_type  */
-#line 166 "bison_parser.y"
+#line 169 "bison_parser.y"
                 { }
-#line 2152 "bison_parser.cpp"
+#line 2193 "bison_parser.cpp"
         break;
 
     case YYSYMBOL_export_statement: /* export_statement  */
-#line 185 "bison_parser.y"
+#line 199 "bison_parser.y"
                 { delete (((*yyvaluep).export_stmt)); }
-#line 2158 "bison_parser.cpp"
+#line 2199 "bison_parser.cpp"
         break;
 
     case YYSYMBOL_show_statement: /* show_statement  */
-#line 185 "bison_parser.y"
+#line 199 "bison_parser.y"
                 { delete (((*yyvaluep).show_stmt)); }
-#line 2164 "bison_parser.cpp"
+#line 2205 "bison_parser.cpp"
         break;
 
     case YYSYMBOL_create_statement: /* create_statement  */
-#line 185 "bison_parser.y"
+#line 199 "bison_parser.y"
+                { delete (((*yyvaluep).create_stmt)); }
+#line 2211 "bison_parser.cpp"
+        break;
+
+    case YYSYMBOL_create_table_statement: /* create_table_statement  */
+#line 199 "bison_parser.y"
+                { delete (((*yyvaluep).statement)); }
+#line 2217 "bison_parser.cpp"
+        break;
+
+    case YYSYMBOL_create_table_columns: /* create_table_columns  */
+#line 199 "bison_parser.y"
+                { delete (((*yyvaluep).create_stmt)); }
+#line 2223 "bison_parser.cpp"
+        break;
+
+    case YYSYMBOL_index_head: /* index_head  */
+#line 199 "bison_parser.y"
                 { delete (((*yyvaluep).create_stmt)); }
-#line 2170 "bison_parser.cpp"
+#line 2229 "bison_parser.cpp"
+        break;
+
+    case YYSYMBOL_opt_index_include: /* opt_index_include  */
+#line 171 "bison_parser.y"
+                {
+      if ((((*yyvaluep).str_vec)) != nullptr) {
+        for (auto ptr : *(((*yyvaluep).str_vec))) {
+          free(ptr);
+        }
+      }
+      delete (((*yyvaluep).str_vec));
+    }
+#line 2242 "bison_parser.cpp"
         break;
 
     case YYSYMBOL_opt_not_exists: /* opt_not_exists  */
-#line 166 "bison_parser.y"
+#line 169 "bison_parser.y"
                 { }
-#line 2176 "bison_parser.cpp"
+#line 2248 "bison_parser.cpp"
         break;
 
     case YYSYMBOL_table_elem_commalist: /* table_elem_commalist  */
-#line 177 "bison_parser.y"
+#line 180 "bison_parser.y"
                 {
       if ((((*yyvaluep).table_element_vec)) != nullptr) {
         for (auto ptr : *(((*yyvaluep).table_element_vec))) {
@@ -2185,113 +2257,154 @@ yydestruct (const char *yymsg,
       }
       delete (((*yyvaluep).table_element_vec));
     }
-#line 2189 "bison_parser.cpp"
+#line 2261 "bison_parser.cpp"
         break;
 
     case YYSYMBOL_table_elem: /* table_elem  */
-#line 185 "bison_parser.y"
+#line 199 "bison_parser.y"
                 { delete (((*yyvaluep).table_element_t)); }
-#line 2195 "bison_parser.cpp"
+#line 2267 "bison_parser.cpp"
+        break;
+
+    case YYSYMBOL_table_option_commalist: /* table_option_commalist  */
+#line 180 "bison_parser.y"
+                {
+      if ((((*yyvaluep).table_option_vec)) != nullptr) {
+        for (auto ptr : *(((*yyvaluep).table_option_vec))) {
+          delete ptr;
+        }
+      }
+      delete (((*yyvaluep).table_option_vec));
+    }
+#line 2280 "bison_parser.cpp"
+        break;
+
+    case YYSYMBOL_table_option: /* table_option  */
+#line 199 "bison_parser.y"
+                { delete (((*yyvaluep).table_option_t)); }
+#line 2286 "bison_parser.cpp"
+        break;
+
+    case YYSYMBOL_table_option_value: /* table_option_value  */
+#line 179 "bison_parser.y"
+                { free( (((*yyvaluep).sval)) ); }
+#line 2292 "bison_parser.cpp"
         break;
 
     case YYSYMBOL_column_def: /* column_def  */
-#line 185 "bison_parser.y"
+#line 199 "bison_parser.y"
                 { delete (((*yyvaluep).column_t)); }
-#line 2201 "bison_parser.cpp"
+#line 2298 "bison_parser.cpp"
         break;
 
     case YYSYMBOL_column_type: /* column_type  */
-#line 166 "bison_parser.y"
+#line 169 "bison_parser.y"
                 { }
-#line 2207 "bison_parser.cpp"
+#line 2304 "bison_parser.cpp"
         break;
 
     case YYSYMBOL_opt_time_precision: /* opt_time_precision  */
-#line 166 "bison_parser.y"
+#line 169 "bison_parser.y"
                 { }
-#line 2213 "bison_parser.cpp"
+#line 2310 "bison_parser.cpp"
         break;
 
     case YYSYMBOL_opt_decimal_specification: /* opt_decimal_specification  */
-#line 185 "bison_parser.y"
+#line 199 "bison_parser.y"
                 { delete (((*yyvaluep).ival_pair)); }
-#line 2219 "bison_parser.cpp"
+#line 2316 "bison_parser.cpp"
         break;
 
     case YYSYMBOL_opt_column_constraints: /* opt_column_constraints  */
-#line 166 "bison_parser.y"
+#line 169 "bison_parser.y"
                 { }
-#line 2225 "bison_parser.cpp"
+#line 2322 "bison_parser.cpp"
         break;
 
     case YYSYMBOL_column_constraint_set: /* column_constraint_set  */
-#line 166 "bison_parser.y"
+#line 169 "bison_parser.y"
                 { }
-#line 2231 "bison_parser.cpp"
+#line 2328 "bison_parser.cpp"
         break;
 
     case YYSYMBOL_column_constraint: /* column_constraint  */
-#line 166 "bison_parser.y"
+#line 169 "bison_parser.y"
                 { }
-#line 2237 "bison_parser.cpp"
+#line 2334 "bison_parser.cpp"
         break;
 
     case YYSYMBOL_table_constraint: /* table_constraint  */
-#line 185 "bison_parser.y"
+#line 199 "bison_parser.y"
                 { delete (((*yyvaluep).table_constraint_t)); }
-#line 2243 "bison_parser.cpp"
+#line 2340 "bison_parser.cpp"
         break;
 
     case YYSYMBOL_drop_statement: /* drop_statement  */
-#line 185 "bison_parser.y"
+#line 199 "bison_parser.y"
                 { delete (((*yyvaluep).drop_stmt)); }
-#line 2249 "bison_parser.cpp"
+#line 2346 "bison_parser.cpp"
         break;
 
     case YYSYMBOL_opt_exists: /* opt_exists  */
-#line 166 "bison_parser.y"
+#line 169 "bison_parser.y"
                 { }
-#line 2255 "bison_parser.cpp"
+#line 2352 "bison_parser.cpp"
         break;
 
     case YYSYMBOL_alter_statement: /* alter_statement  */
-#line 185 "bison_parser.y"
+#line 199 "bison_parser.y"
                 { delete (((*yyvaluep).alter_stmt)); }
-#line 2261 "bison_parser.cpp"
+#line 2358 "bison_parser.cpp"
         break;
 
     case YYSYMBOL_alter_action: /* alter_action  */
-#line 185 "bison_parser.y"
+#line 199 "bison_parser.y"
                 { delete (((*yyvaluep).alter_action_t)); }
-#line 2267 "bison_parser.cpp"
+#line 2364 "bison_parser.cpp"
         break;
 
     case YYSYMBOL_drop_action: /* drop_action  */
-#line 185 "bison_parser.y"
+#line 199 "bison_parser.y"
                 { delete (((*yyvaluep).drop_action_t)); }
-#line 2273 "bison_parser.cpp"
+#line 2370 "bison_parser.cpp"
         break;
 
     case YYSYMBOL_delete_statement: /* delete_statement  */
-#line 185 "bison_parser.y"
+#line 199 "bison_parser.y"
                 { delete (((*yyvaluep).delete_stmt)); }
-#line 2279 "bison_parser.cpp"
+#line 2376 "bison_parser.cpp"
         break;
 
     case YYSYMBOL_truncate_statement: /* truncate_statement  */
-#line 185 "bison_parser.y"
+#line 199 "bison_parser.y"
                 { delete (((*yyvaluep).delete_stmt)); }
-#line 2285 "bison_parser.cpp"
+#line 2382 "bison_parser.cpp"
         break;
 
     case YYSYMBOL_insert_statement: /* insert_statement  */
-#line 185 "bison_parser.y"
+#line 199 "bison_parser.y"
                 { delete (((*yyvaluep).insert_stmt)); }
-#line 2291 "bison_parser.cpp"
+#line 2388 "bison_parser.cpp"
+        break;
+
+    case YYSYMBOL_values_list: /* values_list  */
+#line 188 "bison_parser.y"
+                {
+      if ((((*yyvaluep).expr_vec_list)) != nullptr) {
+        for (auto row : *(((*yyvaluep).expr_vec_list))) {
+          for (auto ptr : *row) {
+            delete ptr;
+          }
+          delete row;
+        }
+      }
+      delete (((*yyvaluep).expr_vec_list));
+    }
+#line 2404 "bison_parser.cpp"
         break;
 
     case YYSYMBOL_opt_column_list: /* opt_column_list  */
-#line 168 "bison_parser.y"
+#line 171 "bison_parser.y"
                 {
       if ((((*yyvaluep).str_vec)) != nullptr) {
         for (auto ptr : *(((*yyvaluep).str_vec))) {
@@ -2300,17 +2413,17 @@ yydestruct (const char *yymsg,
       }
       delete (((*yyvaluep).str_vec));
     }
-#line 2304 "bison_parser.cpp"
+#line 2417 "bison_parser.cpp"
         break;
 
     case YYSYMBOL_update_statement: /* update_statement  */
-#line 185 "bison_parser.y"
+#line 199 "bison_parser.y"
                 { delete (((*yyvaluep).update_stmt)); }
-#line 2310 "bison_parser.cpp"
+#line 2423 "bison_parser.cpp"
         break;
 
     case YYSYMBOL_update_clause_commalist: /* update_clause_commalist  */
-#line 177 "bison_parser.y"
+#line 180 "bison_parser.y"
                 {
       if ((((*yyvaluep).update_vec)) != nullptr) {
         for (auto ptr : *(((*yyvaluep).update_vec))) {
@@ -2319,77 +2432,77 @@ yydestruct (const char *yymsg,
       }
       delete (((*yyvaluep).update_vec));
     }
-#line 2323 "bison_parser.cpp"
+#line 2436 "bison_parser.cpp"
         break;
 
     case YYSYMBOL_update_clause: /* update_clause  */
-#line 185 "bison_parser.y"
+#line 199 "bison_parser.y"
                 { delete (((*yyvaluep).update_t)); }
-#line 2329 "bison_parser.cpp"
+#line 2442 "bison_parser.cpp"
         break;
 
     case YYSYMBOL_select_statement: /* select_statement  */
-#line 185 "bison_parser.y"
+#line 199 "bison_parser.y"
                 { delete (((*yyvaluep).select_stmt)); }
-#line 2335 "bison_parser.cpp"
+#line 2448 "bison_parser.cpp"
         break;
 
     case YYSYMBOL_select_within_set_operation: /* select_within_set_operation  */
-#line 185 "bison_parser.y"
+#line 199 "bison_parser.y"
                 { delete (((*yyvaluep).select_stmt)); }
-#line 2341 "bison_parser.cpp"
+#line 2454 "bison_parser.cpp"
         break;
 
     case YYSYMBOL_select_within_set_operation_no_parentheses: /* select_within_set_operation_no_parentheses  */
-#line 185 "bison_parser.y"
+#line 199 "bison_parser.y"
                 { delete (((*yyvaluep).select_stmt)); }
-#line 2347 "bison_parser.cpp"
+#line 2460 "bison_parser.cpp"
         break;
 
     case YYSYMBOL_select_with_paren: /* select_with_paren  */
-#line 185 "bison_parser.y"
+#line 199 "bison_parser.y"
                 { delete (((*yyvaluep).select_stmt)); }
-#line 2353 "bison_parser.cpp"
+#line 2466 "bison_parser.cpp"
         break;
 
     case YYSYMBOL_select_no_paren: /* select_no_paren  */
-#line 185 "bison_parser.y"
+#line 199 "bison_parser.y"
                 { delete (((*yyvaluep).select_stmt)); }
-#line 2359 "bison_parser.cpp"
+#line 2472 "bison_parser.cpp"
         break;
 
     case YYSYMBOL_set_operator: /* set_operator  */
-#line 185 "bison_parser.y"
+#line 199 "bison_parser.y"
                 { delete (((*yyvaluep).set_operator_t)); }
-#line 2365 "bison_parser.cpp"
+#line 2478 "bison_parser.cpp"
         break;
 
     case YYSYMBOL_set_type: /* set_type  */
-#line 185 "bison_parser.y"
+#line 199 "bison_parser.y"
                 { delete (((*yyvaluep).set_operator_t)); }
-#line 2371 "bison_parser.cpp"
+#line 2484 "bison_parser.cpp"
         break;
 
     case YYSYMBOL_opt_all: /* opt_all  */
-#line 166 "bison_parser.y"
+#line 169 "bison_parser.y"
                 { }
-#line 2377 "bison_parser.cpp"
+#line 2490 "bison_parser.cpp"
         break;
 
     case YYSYMBOL_select_clause: /* select_clause  */
-#line 185 "bison_parser.y"
+#line 199 "bison_parser.y"
                 { delete (((*yyvaluep).select_stmt)); }
-#line 2383 "bison_parser.cpp"
+#line 2496 "bison_parser.cpp"
         break;
 
     case YYSYMBOL_opt_distinct: /* opt_distinct  */
-#line 166 "bison_parser.y"
+#line 169 "bison_parser.y"
                 { }
-#line 2389 "bison_parser.cpp"
+#line 2502 "bison_parser.cpp"
         break;
 
     case YYSYMBOL_select_list: /* select_list  */
-#line 177 "bison_parser.y"
+#line 180 "bison_parser.y"
                 {
       if ((((*yyvaluep).expr_vec)) != nullptr) {
         for (auto ptr : *(((*yyvaluep).expr_vec))) {
@@ -2398,41 +2511,41 @@ yydestruct (const char *yymsg,
       }
       delete (((*yyvaluep).expr_vec));
     }
-#line 2402 "bison_parser.cpp"
+#line 2515 "bison_parser.cpp"
         break;
 
     case YYSYMBOL_opt_from_clause: /* opt_from_clause  */
-#line 185 "bison_parser.y"
+#line 199 "bison_parser.y"
                 { delete (((*yyvaluep).table)); }
-#line 2408 "bison_parser.cpp"
+#line 2521 "bison_parser.cpp"
         break;
 
     case YYSYMBOL_from_clause: /* from_clause  */
-#line 185 "bison_parser.y"
+#line 199 "bison_parser.y"
                 { delete (((*yyvaluep).table)); }
-#line 2414 "bison_parser.cpp"
+#line 2527 "bison_parser.cpp"
         break;
 
     case YYSYMBOL_opt_where: /* opt_where  */
-#line 185 "bison_parser.y"
+#line 199 "bison_parser.y"
                 { delete (((*yyvaluep).expr)); }
-#line 2420 "bison_parser.cpp"
+#line 2533 "bison_parser.cpp"
         break;
 
     case YYSYMBOL_opt_group: /* opt_group  */
-#line 185 "bison_parser.y"
+#line 199 "bison_parser.y"
                 { delete (((*yyvaluep).group_t)); }
-#line 2426 "bison_parser.cpp"
+#line 2539 "bison_parser.cpp"
         break;
 
     case YYSYMBOL_opt_having: /* opt_having  */
-#line 185 "bison_parser.y"
+#line 199 "bison_parser.y"
                 { delete (((*yyvaluep).expr)); }
-#line 2432 "bison_parser.cpp"
+#line 2545 "bison_parser.cpp"
         break;
 
     case YYSYMBOL_opt_order: /* opt_order  */
-#line 177 "bison_parser.y"
+#line 180 "bison_parser.y"
                 {
       if ((((*yyvaluep).order_vec)) != nullptr) {
         for (auto ptr : *(((*yyvaluep).order_vec))) {
@@ -2441,11 +2554,11 @@ yydestruct (const char *yymsg,
       }
       delete (((*yyvaluep).order_vec));
     }
-#line 2445 "bison_parser.cpp"
+#line 2558 "bison_parser.cpp"
         break;
 
     case YYSYMBOL_order_list: /* order_list  */
-#line 177 "bison_parser.y"
+#line 180 "bison_parser.y"
                 {
       if ((((*yyvaluep).order_vec)) != nullptr) {
         for (auto ptr : *(((*yyvaluep).order_vec))) {
@@ -2454,35 +2567,35 @@ yydestruct (const char *yymsg,
       }
       delete (((*yyvaluep).order_vec));
     }
-#line 2458 "bison_parser.cpp"
+#line 2571 "bison_parser.cpp"
         break;
 
     case YYSYMBOL_order_desc: /* order_desc  */
-#line 185 "bison_parser.y"
+#line 199 "bison_parser.y"
                 { delete (((*yyvaluep).order)); }
-#line 2464 "bison_parser.cpp"
+#line 2577 "bison_parser.cpp"
         break;
 
     case YYSYMBOL_opt_order_type: /* opt_order_type  */
-#line 166 "bison_parser.y"
+#line 169 "bison_parser.y"
                 { }
-#line 2470 "bison_parser.cpp"
+#line 2583 "bison_parser.cpp"
         break;
 
     case YYSYMBOL_opt_top: /* opt_top  */
-#line 185 "bison_parser.y"
+#line 199 "bison_parser.y"
                 { delete (((*yyvaluep).limit)); }
-#line 2476 "bison_parser.cpp"
+#line 2589 "bison_parser.cpp"
         break;
 
     case YYSYMBOL_opt_limit: /* opt_limit  */
-#line 185 "bison_parser.y"
+#line 199 "bison_parser.y"
                 { delete (((*yyvaluep).limit)); }
-#line 2482 "bison_parser.cpp"
+#line 2595 "bison_parser.cpp"
         break;
 
     case YYSYMBOL_expr_list: /* expr_list  */
-#line 177 "bison_parser.y"
+#line 180 "bison_parser.y"
                 {
       if ((((*yyvaluep).expr_vec)) != nullptr) {
         for (auto ptr : *(((*yyvaluep).expr_vec))) {
@@ -2491,11 +2604,11 @@ yydestruct (const char *yymsg,
       }
       delete (((*yyvaluep).expr_vec));
     }
-#line 2495 "bison_parser.cpp"
+#line 2608 "bison_parser.cpp"
         break;
 
     case YYSYMBOL_opt_literal_list: /* opt_literal_list  */
-#line 177 "bison_parser.y"
+#line 180 "bison_parser.y"
                 {
       if ((((*yyvaluep).expr_vec)) != nullptr) {
         for (auto ptr : *(((*yyvaluep).expr_vec))) {
@@ -2504,11 +2617,11 @@ yydestruct (const char *yymsg,
       }
       delete (((*yyvaluep).expr_vec));
     }
-#line 2508 "bison_parser.cpp"
+#line 2621 "bison_parser.cpp"
         break;
 
     case YYSYMBOL_literal_list: /* literal_list  */
-#line 177 "bison_parser.y"
+#line 180 "bison_parser.y"
                 {
       if ((((*yyvaluep).expr_vec)) != nullptr) {
         for (auto ptr : *(((*yyvaluep).expr_vec))) {
@@ -2517,215 +2630,215 @@ yydestruct (const char *yymsg,
       }
       delete (((*yyvaluep).expr_vec));
     }
-#line 2521 "bison_parser.cpp"
+#line 2634 "bison_parser.cpp"
         break;
 
     case YYSYMBOL_expr_alias: /* expr_alias  */
-#line 185 "bison_parser.y"
+#line 199 "bison_parser.y"
                 { delete (((*yyvaluep).expr)); }
-#line 2527 "bison_parser.cpp"
+#line 2640 "bison_parser.cpp"
         break;
 
     case YYSYMBOL_expr: /* expr  */
-#line 185 "bison_parser.y"
+#line 199 "bison_parser.y"
                 { delete (((*yyvaluep).expr)); }
-#line 2533 "bison_parser.cpp"
+#line 2646 "bison_parser.cpp"
         break;
 
     case YYSYMBOL_operand: /* operand  */
-#line 185 "bison_parser.y"
+#line 199 "bison_parser.y"
                 { delete (((*yyvaluep).expr)); }
-#line 2539 "bison_parser.cpp"
+#line 2652 "bison_parser.cpp"
         break;
 
     case YYSYMBOL_scalar_expr: /* scalar_expr  */
-#line 185 "bison_parser.y"
+#line 199 "bison_parser.y"
                 { delete (((*yyvaluep).expr)); }
-#line 2545 "bison_parser.cpp"
+#line 2658 "bison_parser.cpp"
         break;
 
     case YYSYMBOL_unary_expr: /* unary_expr  */
-#line 185 "bison_parser.y"
+#line 199 "bison_parser.y"
                 { delete (((*yyvaluep).expr)); }
-#line 2551 "bison_parser.cpp"
+#line 2664 "bison_parser.cpp"
         break;
 
     case YYSYMBOL_binary_expr: /* binary_expr  */
-#line 185 "bison_parser.y"
+#line 199 "bison_parser.y"
                 { delete (((*yyvaluep).expr)); }
-#line 2557 "bison_parser.cpp"
+#line 2670 "bison_parser.cpp"
         break;
 
     case YYSYMBOL_logic_expr: /* logic_expr  */
-#line 185 "bison_parser.y"
+#line 199 "bison_parser.y"
                 { delete (((*yyvaluep).expr)); }
-#line 2563 "bison_parser.cpp"
+#line 2676 "bison_parser.cpp"
         break;
 
     case YYSYMBOL_in_expr: /* in_expr  */
-#line 185 "bison_parser.y"
+#line 199 "bison_parser.y"
                 { delete (((*yyvaluep).expr)); }
-#line 2569 "bison_parser.cpp"
+#line 2682 "bison_parser.cpp"
         break;
 
     case YYSYMBOL_case_expr: /* case_expr  */
-#line 185 "bison_parser.y"
+#line 199 "bison_parser.y"
                 { delete (((*yyvaluep).expr)); }
-#line 2575 "bison_parser.cpp"
+#line 2688 "bison_parser.cpp"
         break;
 
     case YYSYMBOL_case_list: /* case_list  */
-#line 185 "bison_parser.y"
+#line 199 "bison_parser.y"
                 { delete (((*yyvaluep).expr)); }
-#line 2581 "bison_parser.cpp"
+#line 2694 "bison_parser.cpp"
         break;
 
     case YYSYMBOL_exists_expr: /* exists_expr  */
-#line 185 "bison_parser.y"
+#line 199 "bison_parser.y"
                 { delete (((*yyvaluep).expr)); }
-#line 2587 "bison_parser.cpp"
+#line 2700 "bison_parser.cpp"
         break;
 
     case YYSYMBOL_comp_expr: /* comp_expr  */
-#line 185 "bison_parser.y"
+#line 199 "bison_parser.y"
                 { delete (((*yyvaluep).expr)); }
-#line 2593 "bison_parser.cpp"
+#line 2706 "bison_parser.cpp"
         break;
 
     case YYSYMBOL_function_expr: /* function_expr  */
-#line 185 "bison_parser.y"
+#line 199 "bison_parser.y"
                 { delete (((*yyvaluep).expr)); }
-#line 2599 "bison_parser.cpp"
+#line 2712 "bison_parser.cpp"
         break;
 
     case YYSYMBOL_extract_expr: /* extract_expr  */
-#line 185 "bison_parser.y"
+#line 199 "bison_parser.y"
                 { delete (((*yyvaluep).expr)); }
-#line 2605 "bison_parser.cpp"
+#line 2718 "bison_parser.cpp"
         break;
 
     case YYSYMBOL_cast_expr: /* cast_expr  */
-#line 185 "bison_parser.y"
+#line 199 "bison_parser.y"
                 { delete (((*yyvaluep).expr)); }
-#line 2611 "bison_parser.cpp"
+#line 2724 "bison_parser.cpp"
         break;
 
     case YYSYMBOL_datetime_field: /* datetime_field  */
-#line 166 "bison_parser.y"
+#line 169 "bison_parser.y"
                 { }
-#line 2617 "bison_parser.cpp"
+#line 2730 "bison_parser.cpp"
         break;
 
     case YYSYMBOL_datetime_field_plural: /* datetime_field_plural  */
-#line 166 "bison_parser.y"
+#line 169 "bison_parser.y"
                 { }
-#line 2623 "bison_parser.cpp"
+#line 2736 "bison_parser.cpp"
         break;
 
     case YYSYMBOL_duration_field: /* duration_field  */
-#line 166 "bison_parser.y"
+#line 169 "bison_parser.y"
                 { }
-#line 2629 "bison_parser.cpp"
+#line 2742 "bison_parser.cpp"
         break;
 
     case YYSYMBOL_array_expr: /* array_expr  */
-#line 185 "bison_parser.y"
+#line 199 "bison_parser.y"
                 { delete (((*yyvaluep).expr)); }
-#line 2635 "bison_parser.cpp"
+#line 2748 "bison_parser.cpp"
         break;
 
     case YYSYMBOL_array_index: /* array_index  */
-#line 185 "bison_parser.y"
+#line 199 "bison_parser.y"
                 { delete (((*yyvaluep).expr)); }
-#line 2641 "bison_parser.cpp"
+#line 2754 "bison_parser.cpp"
         break;
 
     case YYSYMBOL_between_expr: /* between_expr  */
-#line 185 "bison_parser.y"
+#line 199 "bison_parser.y"
                 { delete (((*yyvaluep).expr)); }
-#line 2647 "bison_parser.cpp"
+#line 2760 "bison_parser.cpp"
         break;
 
     case YYSYMBOL_column_name: /* column_name  */
-#line 185 "bison_parser.y"
+#line 199 "bison_parser.y"
                 { delete (((*yyvaluep).expr)); }
-#line 2653 "bison_parser.cpp"
+#line 2766 "bison_parser.cpp"
         break;
 
     case YYSYMBOL_literal: /* literal  */
-#line 185 "bison_parser.y"
+#line 199 "bison_parser.y"
                 { delete (((*yyvaluep).expr)); }
-#line 2659 "bison_parser.cpp"
+#line 2772 "bison_parser.cpp"
         break;
 
     case YYSYMBOL_string_literal: /* string_literal  */
-#line 185 "bison_parser.y"
+#line 199 "bison_parser.y"
                 { delete (((*yyvaluep).expr)); }
-#line 2665 "bison_parser.cpp"
+#line 2778 "bison_parser.cpp"
         break;
 
     case YYSYMBOL_bool_literal: /* bool_literal  */
-#line 185 "bison_parser.y"
+#line 199 "bison_parser.y"
                 { delete (((*yyvaluep).expr)); }
-#line 2671 "bison_parser.cpp"
+#line 2784 "bison_parser.cpp"
         break;
 
     case YYSYMBOL_num_literal: /* num_literal  */
-#line 185 "bison_parser.y"
+#line 199 "bison_parser.y"
                 { delete (((*yyvaluep).expr)); }
-#line 2677 "bison_parser.cpp"
+#line 2790 "bison_parser.cpp"
         break;
 
     case YYSYMBOL_int_literal: /* int_literal  */
-#line 185 "bison_parser.y"
+#line 199 "bison_parser.y"
                 { delete (((*yyvaluep).expr)); }
-#line 2683 "bison_parser.cpp"
+#line 2796 "bison_parser.cpp"
         break;
 
     case YYSYMBOL_null_literal: /* null_literal  */
-#line 185 "bison_parser.y"
+#line 199 "bison_parser.y"
                 { delete (((*yyvaluep).expr)); }
-#line 2689 "bison_parser.cpp"
+#line 2802 "bison_parser.cpp"
         break;
 
     case YYSYMBOL_date_literal: /* date_literal  */
-#line 185 "bison_parser.y"
+#line 199 "bison_parser.y"
                 { delete (((*yyvaluep).expr)); }
-#line 2695 "bison_parser.cpp"
+#line 2808 "bison_parser.cpp"
         break;
 
     case YYSYMBOL_interval_literal: /* interval_literal  */
-#line 185 "bison_parser.y"
+#line 199 "bison_parser.y"
                 { delete (((*yyvaluep).expr)); }
-#line 2701 "bison_parser.cpp"
+#line 2814 "bison_parser.cpp"
         break;
 
     case YYSYMBOL_param_expr: /* param_expr  */
-#line 185 "bison_parser.y"
+#line 199 "bison_parser.y"
                 { delete (((*yyvaluep).expr)); }
-#line 2707 "bison_parser.cpp"
+#line 2820 "bison_parser.cpp"
         break;
 
     case YYSYMBOL_table_ref: /* table_ref  */
-#line 185 "bison_parser.y"
+#line 199 "bison_parser.y"
                 { delete (((*yyvaluep).table)); }
-#line 2713 "bison_parser.cpp"
+#line 2826 "bison_parser.cpp"
         break;
 
     case YYSYMBOL_table_ref_atomic: /* table_ref_atomic  */
-#line 185 "bison_parser.y"
+#line 199 "bison_parser.y"
                 { delete (((*yyvaluep).table)); }
-#line 2719 "bison_parser.cpp"
+#line 2832 "bison_parser.cpp"
         break;
 
     case YYSYMBOL_nonjoin_table_ref_atomic: /* nonjoin_table_ref_atomic  */
-#line 185 "bison_parser.y"
+#line 199 "bison_parser.y"
                 { delete (((*yyvaluep).table)); }
-#line 2725 "bison_parser.cpp"
+#line 2838 "bison_parser.cpp"
         break;
 
     case YYSYMBOL_table_ref_commalist: /* table_ref_commalist  */
-#line 177 "bison_parser.y"
+#line 180 "bison_parser.y"
                 {
       if ((((*yyvaluep).table_vec)) != nullptr) {
         for (auto ptr : *(((*yyvaluep).table_vec))) {
@@ -2734,131 +2847,137 @@ yydestruct (const char *yymsg,
       }
       delete (((*yyvaluep).table_vec));
     }
-#line 2738 "bison_parser.cpp"
+#line 2851 "bison_parser.cpp"
         break;
 
     case YYSYMBOL_table_ref_name: /* table_ref_name  */
-#line 185 "bison_parser.y"
+#line 199 "bison_parser.y"
                 { delete (((*yyvaluep).table)); }
-#line 2744 "bison_parser.cpp"
+#line 2857 "bison_parser.cpp"
         break;
 
     case YYSYMBOL_table_ref_name_no_alias: /* table_ref_name_no_alias  */
-#line 185 "bison_parser.y"
+#line 199 "bison_parser.y"
                 { delete (((*yyvaluep).table)); }
-#line 2750 "bison_parser.cpp"
+#line 2863 "bison_parser.cpp"
         break;
 
     case YYSYMBOL_table_name: /* table_name  */
-#line 167 "bison_parser.y"
+#line 170 "bison_parser.y"
                 { free( (((*yyvaluep).table_name).name) ); free( (((*yyvaluep).table_name).schema) ); }
-#line 2756 "bison_parser.cpp"
+#line 2869 "bison_parser.cpp"
         break;
 
     case YYSYMBOL_opt_index_name: /* opt_index_name  */
-#line 176 "bison_parser.y"
+#line 179 "bison_parser.y"
+                { free( (((*yyvaluep).sval)) ); }
+#line 2875 "bison_parser.cpp"
+        break;
+
+    case YYSYMBOL_opt_index_method: /* opt_index_method  */
+#line 179 "bison_parser.y"
                 { free( (((*yyvaluep).sval)) ); }
-#line 2762 "bison_parser.cpp"
+#line 2881 "bison_parser.cpp"
         break;
 
     case YYSYMBOL_table_alias: /* table_alias  */
-#line 185 "bison_parser.y"
+#line 199 "bison_parser.y"
                 { delete (((*yyvaluep).alias_t)); }
-#line 2768 "bison_parser.cpp"
+#line 2887 "bison_parser.cpp"
         break;
 
     case YYSYMBOL_opt_table_alias: /* opt_table_alias  */
-#line 185 "bison_parser.y"
+#line 199 "bison_parser.y"
                 { delete (((*yyvaluep).alias_t)); }
-#line 2774 "bison_parser.cpp"
+#line 2893 "bison_parser.cpp"
         break;
 
     case YYSYMBOL_alias: /* alias  */
-#line 185 "bison_parser.y"
+#line 199 "bison_parser.y"
                 { delete (((*yyvaluep).alias_t)); }
-#line 2780 "bison_parser.cpp"
+#line 2899 "bison_parser.cpp"
         break;
 
     case YYSYMBOL_opt_alias: /* opt_alias  */
-#line 185 "bison_parser.y"
+#line 199 "bison_parser.y"
                 { delete (((*yyvaluep).alias_t)); }
-#line 2786 "bison_parser.cpp"
+#line 2905 "bison_parser.cpp"
         break;
 
     case YYSYMBOL_opt_locking_clause: /* opt_locking_clause  */
-#line 185 "bison_parser.y"
+#line 199 "bison_parser.y"
                 { delete (((*yyvaluep).locking_clause_vec)); }
-#line 2792 "bison_parser.cpp"
+#line 2911 "bison_parser.cpp"
         break;
 
     case YYSYMBOL_opt_locking_clause_list: /* opt_locking_clause_list  */
-#line 185 "bison_parser.y"
+#line 199 "bison_parser.y"
                 { delete (((*yyvaluep).locking_clause_vec)); }
-#line 2798 "bison_parser.cpp"
+#line 2917 "bison_parser.cpp"
         break;
 
     case YYSYMBOL_locking_clause: /* locking_clause  */
-#line 185 "bison_parser.y"
+#line 199 "bison_parser.y"
                 { delete (((*yyvaluep).locking_t)); }
-#line 2804 "bison_parser.cpp"
+#line 2923 "bison_parser.cpp"
         break;
 
     case YYSYMBOL_row_lock_mode: /* row_lock_mode  */
-#line 166 "bison_parser.y"
+#line 169 "bison_parser.y"
                 { }
-#line 2810 "bison_parser.cpp"
+#line 2929 "bison_parser.cpp"
         break;
 
     case YYSYMBOL_opt_row_lock_policy: /* opt_row_lock_policy  */
-#line 166 "bison_parser.y"
+#line 169 "bison_parser.y"
                 { }
-#line 2816 "bison_parser.cpp"
+#line 2935 "bison_parser.cpp"
         break;
 
     case YYSYMBOL_opt_with_clause: /* opt_with_clause  */
-#line 185 "bison_parser.y"
+#line 199 "bison_parser.y"
                 { delete (((*yyvaluep).with_description_vec)); }
-#line 2822 "bison_parser.cpp"
+#line 2941 "bison_parser.cpp"
         break;
 
     case YYSYMBOL_with_clause: /* with_clause  */
-#line 185 "bison_parser.y"
+#line 199 "bison_parser.y"
                 { delete (((*yyvaluep).with_description_vec)); }
-#line 2828 "bison_parser.cpp"
+#line 2947 "bison_parser.cpp"
         break;
 
     case YYSYMBOL_with_description_list: /* with_description_list  */
-#line 185 "bison_parser.y"
+#line 199 "bison_parser.y"
                 { delete (((*yyvaluep).with_description_vec)); }
-#line 2834 "bison_parser.cpp"
+#line 2953 "bison_parser.cpp"
         break;
 
     case YYSYMBOL_with_description: /* with_description  */
-#line 185 "bison_parser.y"
+#line 199 "bison_parser.y"
                 { delete (((*yyvaluep).with_description_t)); }
-#line 2840 "bison_parser.cpp"
+#line 2959 "bison_parser.cpp"
         break;
 
     case YYSYMBOL_join_clause: /* join_clause  */
-#line 185 "bison_parser.y"
+#line 199 "bison_parser.y"
                 { delete (((*yyvaluep).table)); }
-#line 2846 "bison_parser.cpp"
+#line 2965 "bison_parser.cpp"
         break;
 
     case YYSYMBOL_opt_join_type: /* opt_join_type  */
-#line 166 "bison_parser.y"
+#line 169 "bison_parser.y"
                 { }
-#line 2852 "bison_parser.cpp"
+#line 2971 "bison_parser.cpp"
         break;
 
     case YYSYMBOL_join_condition: /* join_condition  */
-#line 185 "bison_parser.y"
+#line 199 "bison_parser.y"
                 { delete (((*yyvaluep).expr)); }
-#line 2858 "bison_parser.cpp"
+#line 2977 "bison_parser.cpp"
         break;
 
     case YYSYMBOL_ident_commalist: /* ident_commalist  */
-#line 168 "bison_parser.y"
+#line 171 "bison_parser.y"
                 {
       if ((((*yyvaluep).str_vec)) != nullptr) {
         for (auto ptr : *(((*yyvaluep).str_vec))) {
@@ -2867,7 +2986,7 @@ yydestruct (const char *yymsg,
       }
       delete (((*yyvaluep).str_vec));
     }
-#line 2871 "bison_parser.cpp"
+#line 2990 "bison_parser.cpp"
         break;
 
       default:
@@ -2975,7 +3094,7 @@ YYLTYPE yylloc = yyloc_default;
   yylloc.string_length = 0;
 }
 
-#line 2979 "bison_parser.cpp"
+#line 3098 "bison_parser.cpp"
 
   yylsp[0] = yylloc;
   goto yysetstate;
@@ -3186,7 +3305,7 @@ yyreduce:
   switch (yyn)
     {
   case 2: /* input: statement_list opt_semicolon  */
-#line 312 "bison_parser.y"
+#line 330 "bison_parser.y"
                                      {
   for (SQLStatement* stmt : *(yyvsp[-1].stmt_vec)) {
     // Transfers ownership of the statement.
@@ -3204,247 +3323,253 @@ yyreduce:
   }
     delete (yyvsp[-1].stmt_vec);
   }
-#line 3208 "bison_parser.cpp"
+#line 3327 "bison_parser.cpp"
     break;
 
   case 3: /* statement_list: statement  */
-#line 331 "bison_parser.y"
+#line 349 "bison_parser.y"
                            {
   (yyvsp[0].statement)->stringLength = yylloc.string_length;
   yylloc.string_length = 0;
   (yyval.stmt_vec) = new std::vector<SQLStatement*>();
   (yyval.stmt_vec)->push_back((yyvsp[0].statement));
 }
-#line 3219 "bison_parser.cpp"
+#line 3338 "bison_parser.cpp"
     break;
 
   case 4: /* statement_list: statement_list ';' statement  */
-#line 337 "bison_parser.y"
+#line 355 "bison_parser.y"
                                {
   (yyvsp[0].statement)->stringLength = yylloc.string_length;
   yylloc.string_length = 0;
   (yyvsp[-2].stmt_vec)->push_back((yyvsp[0].statement));
   (yyval.stmt_vec) = (yyvsp[-2].stmt_vec);
 }
-#line 3230 "bison_parser.cpp"
+#line 3349 "bison_parser.cpp"
     break;
 
   case 5: /* statement: prepare_statement opt_hints  */
-#line 344 "bison_parser.y"
+#line 362 "bison_parser.y"
                                         {
   (yyval.statement) = (yyvsp[-1].prep_stmt);
   (yyval.statement)->hints = (yyvsp[0].expr_vec);
 }
-#line 3239 "bison_parser.cpp"
+#line 3358 "bison_parser.cpp"
     break;
 
   case 6: /* statement: preparable_statement opt_hints  */
-#line 348 "bison_parser.y"
+#line 366 "bison_parser.y"
                                  {
   (yyval.statement) = (yyvsp[-1].statement);
   (yyval.statement)->hints = (yyvsp[0].expr_vec);
 }
-#line 3248 "bison_parser.cpp"
+#line 3367 "bison_parser.cpp"
     break;
 
-  case 7: /* statement: show_statement  */
-#line 352 "bison_parser.y"
+  case 7: /* statement: create_table_statement  */
+#line 370 "bison_parser.y"
+                         { (yyval.statement) = (yyvsp[0].statement); }
+#line 3373 "bison_parser.cpp"
+    break;
+
+  case 8: /* statement: show_statement  */
+#line 371 "bison_parser.y"
                  { (yyval.statement) = (yyvsp[0].show_stmt); }
-#line 3254 "bison_parser.cpp"
+#line 3379 "bison_parser.cpp"
     break;
 
-  case 8: /* statement: import_statement  */
-#line 353 "bison_parser.y"
+  case 9: /* statement: import_statement  */
+#line 372 "bison_parser.y"
                    { (yyval.statement) = (yyvsp[0].import_stmt); }
-#line 3260 "bison_parser.cpp"
+#line 3385 "bison_parser.cpp"
     break;
 
-  case 9: /* statement: export_statement  */
-#line 354 "bison_parser.y"
+  case 10: /* statement: export_statement  */
+#line 373 "bison_parser.y"
                    { (yyval.statement) = (yyvsp[0].export_stmt); }
-#line 3266 "bison_parser.cpp"
+#line 3391 "bison_parser.cpp"
     break;
 
-  case 10: /* preparable_statement: select_statement  */
-#line 356 "bison_parser.y"
+  case 11: /* preparable_statement: select_statement  */
+#line 375 "bison_parser.y"
                                         { (yyval.statement) = (yyvsp[0].select_stmt); }
-#line 3272 "bison_parser.cpp"
+#line 3397 "bison_parser.cpp"
     break;
 
-  case 11: /* preparable_statement: create_statement  */
-#line 357 "bison_parser.y"
+  case 12: /* preparable_statement: create_statement  */
+#line 376 "bison_parser.y"
                    { (yyval.statement) = (yyvsp[0].create_stmt); }
-#line 3278 "bison_parser.cpp"
+#line 3403 "bison_parser.cpp"
     break;
 
-  case 12: /* preparable_statement: insert_statement  */
-#line 358 "bison_parser.y"
+  case 13: /* preparable_statement: insert_statement  */
+#line 377 "bison_parser.y"
                    { (yyval.statement) = (yyvsp[0].insert_stmt); }
-#line 3284 "bison_parser.cpp"
+#line 3409 "bison_parser.cpp"
     break;
 
-  case 13: /* preparable_statement: delete_statement  */
-#line 359 "bison_parser.y"
+  case 14: /* preparable_statement: delete_statement  */
+#line 378 "bison_parser.y"
                    { (yyval.statement) = (yyvsp[0].delete_stmt); }
-#line 3290 "bison_parser.cpp"
+#line 3415 "bison_parser.cpp"
     break;
 
-  case 14: /* preparable_statement: truncate_statement  */
-#line 360 "bison_parser.y"
+  case 15: /* preparable_statement: truncate_statement  */
+#line 379 "bison_parser.y"
                      { (yyval.statement) = (yyvsp[0].delete_stmt); }
-#line 3296 "bison_parser.cpp"
+#line 3421 "bison_parser.cpp"
     break;
 
-  case 15: /* preparable_statement: update_statement  */
-#line 361 "bison_parser.y"
+  case 16: /* preparable_statement: update_statement  */
+#line 380 "bison_parser.y"
                    { (yyval.statement) = (yyvsp[0].update_stmt); }
-#line 3302 "bison_parser.cpp"
+#line 3427 "bison_parser.cpp"
     break;
 
-  case 16: /* preparable_statement: drop_statement  */
-#line 362 "bison_parser.y"
+  case 17: /* preparable_statement: drop_statement  */
+#line 381 "bison_parser.y"
                  { (yyval.statement) = (yyvsp[0].drop_stmt); }
-#line 3308 "bison_parser.cpp"
+#line 3433 "bison_parser.cpp"
     break;
 
-  case 17: /* preparable_statement: alter_statement  */
-#line 363 "bison_parser.y"
+  case 18: /* preparable_statement: alter_statement  */
+#line 382 "bison_parser.y"
                   { (yyval.statement) = (yyvsp[0].alter_stmt); }
-#line 3314 "bison_parser.cpp"
+#line 3439 "bison_parser.cpp"
     break;
 
-  case 18: /* preparable_statement: execute_statement  */
-#line 364 "bison_parser.y"
+  case 19: /* preparable_statement: execute_statement  */
+#line 383 "bison_parser.y"
                     { (yyval.statement) = (yyvsp[0].exec_stmt); }
-#line 3320 "bison_parser.cpp"
+#line 3445 "bison_parser.cpp"
     break;
 
-  case 19: /* preparable_statement: transaction_statement  */
-#line 365 "bison_parser.y"
+  case 20: /* preparable_statement: transaction_statement  */
+#line 384 "bison_parser.y"
                         { (yyval.statement) = (yyvsp[0].transaction_stmt); }
-#line 3326 "bison_parser.cpp"
+#line 3451 "bison_parser.cpp"
     break;
 
-  case 20: /* opt_hints: WITH HINT '(' hint_list ')'  */
-#line 371 "bison_parser.y"
+  case 21: /* opt_hints: WITH HINT '(' hint_list ')'  */
+#line 390 "bison_parser.y"
                                         { (yyval.expr_vec) = (yyvsp[-1].expr_vec); }
-#line 3332 "bison_parser.cpp"
+#line 3457 "bison_parser.cpp"
     break;
 
-  case 21: /* opt_hints: %empty  */
-#line 372 "bison_parser.y"
+  case 22: /* opt_hints: %empty  */
+#line 391 "bison_parser.y"
               { (yyval.expr_vec) = nullptr; }
-#line 3338 "bison_parser.cpp"
+#line 3463 "bison_parser.cpp"
     break;
 
-  case 22: /* hint_list: hint  */
-#line 374 "bison_parser.y"
+  case 23: /* hint_list: hint  */
+#line 393 "bison_parser.y"
                  {
   (yyval.expr_vec) = new std::vector<Expr*>();
   (yyval.expr_vec)->push_back((yyvsp[0].expr));
 }
-#line 3347 "bison_parser.cpp"
+#line 3472 "bison_parser.cpp"
     break;
 
-  case 23: /* hint_list: hint_list ',' hint  */
-#line 378 "bison_parser.y"
+  case 24: /* hint_list: hint_list ',' hint  */
+#line 397 "bison_parser.y"
                      {
   (yyvsp[-2].expr_vec)->push_back((yyvsp[0].expr));
   (yyval.expr_vec) = (yyvsp[-2].expr_vec);
 }
-#line 3356 "bison_parser.cpp"
+#line 3481 "bison_parser.cpp"
     break;
 
-  case 24: /* hint: IDENTIFIER  */
-#line 383 "bison_parser.y"
+  case 25: /* hint: IDENTIFIER  */
+#line 402 "bison_parser.y"
                   {
   (yyval.expr) = Expr::make(kExprHint);
   (yyval.expr)->name = (yyvsp[0].sval);
 }
-#line 3365 "bison_parser.cpp"
+#line 3490 "bison_parser.cpp"
     break;
 
-  case 25: /* hint: IDENTIFIER '(' literal_list ')'  */
-#line 387 "bison_parser.y"
+  case 26: /* hint: IDENTIFIER '(' literal_list ')'  */
+#line 406 "bison_parser.y"
                                   {
   (yyval.expr) = Expr::make(kExprHint);
   (yyval.expr)->name = (yyvsp[-3].sval);
   (yyval.expr)->exprList = (yyvsp[-1].expr_vec);
 }
-#line 3375 "bison_parser.cpp"
+#line 3500 "bison_parser.cpp"
     break;
 
-  case 26: /* transaction_statement: BEGIN opt_transaction_keyword  */
-#line 397 "bison_parser.y"
+  case 27: /* transaction_statement: BEGIN opt_transaction_keyword  */
+#line 416 "bison_parser.y"
                                                       { (yyval.transaction_stmt) = new TransactionStatement(kBeginTransaction); }
-#line 3381 "bison_parser.cpp"
+#line 3506 "bison_parser.cpp"
     break;
 
-  case 27: /* transaction_statement: ROLLBACK opt_transaction_keyword  */
-#line 398 "bison_parser.y"
+  case 28: /* transaction_statement: ROLLBACK opt_transaction_keyword  */
+#line 417 "bison_parser.y"
                                    { (yyval.transaction_stmt) = new TransactionStatement(kRollbackTransaction); }
-#line 3387 "bison_parser.cpp"
+#line 3512 "bison_parser.cpp"
     break;
 
-  case 28: /* transaction_statement: COMMIT opt_transaction_keyword  */
-#line 399 "bison_parser.y"
+  case 29: /* transaction_statement: COMMIT opt_transaction_keyword  */
+#line 418 "bison_parser.y"
                                  { (yyval.transaction_stmt) = new TransactionStatement(kCommitTransaction); }
-#line 3393 "bison_parser.cpp"
+#line 3518 "bison_parser.cpp"
     break;
 
-  case 31: /* prepare_statement: PREPARE IDENTIFIER FROM prepare_target_query  */
-#line 407 "bison_parser.y"
+  case 32: /* prepare_statement: PREPARE IDENTIFIER FROM prepare_target_query  */
+#line 426 "bison_parser.y"
                                                                  {
   (yyval.prep_stmt) = new PrepareStatement();
   (yyval.prep_stmt)->name = (yyvsp[-2].sval);
   (yyval.prep_stmt)->query = (yyvsp[0].sval);
 }
-#line 3403 "bison_parser.cpp"
+#line 3528 "bison_parser.cpp"
     break;
 
-  case 33: /* execute_statement: EXECUTE IDENTIFIER  */
-#line 415 "bison_parser.y"
+  case 34: /* execute_statement: EXECUTE IDENTIFIER  */
+#line 434 "bison_parser.y"
                                                                   {
   (yyval.exec_stmt) = new ExecuteStatement();
   (yyval.exec_stmt)->name = (yyvsp[0].sval);
 }
-#line 3412 "bison_parser.cpp"
+#line 3537 "bison_parser.cpp"
     break;
 
-  case 34: /* execute_statement: EXECUTE IDENTIFIER '(' opt_literal_list ')'  */
-#line 419 "bison_parser.y"
+  case 35: /* execute_statement: EXECUTE IDENTIFIER '(' opt_literal_list ')'  */
+#line 438 "bison_parser.y"
                                               {
   (yyval.exec_stmt) = new ExecuteStatement();
   (yyval.exec_stmt)->name = (yyvsp[-3].sval);
   (yyval.exec_stmt)->parameters = (yyvsp[-1].expr_vec);
 }
-#line 3422 "bison_parser.cpp"
+#line 3547 "bison_parser.cpp"
     break;
 
-  case 35: /* import_statement: IMPORT FROM file_type FILE file_path INTO table_name  */
-#line 430 "bison_parser.y"
+  case 36: /* import_statement: IMPORT FROM file_type FILE file_path INTO table_name  */
+#line 449 "bison_parser.y"
                                                                         {
   (yyval.import_stmt) = new ImportStatement((yyvsp[-4].import_type_t));
   (yyval.import_stmt)->filePath = (yyvsp[-2].sval);
   (yyval.import_stmt)->schema = (yyvsp[0].table_name).schema;
   (yyval.import_stmt)->tableName = (yyvsp[0].table_name).name;
 }
-#line 3433 "bison_parser.cpp"
+#line 3558 "bison_parser.cpp"
     break;
 
-  case 36: /* import_statement: COPY table_name FROM file_path opt_file_type  */
-#line 436 "bison_parser.y"
+  case 37: /* import_statement: COPY table_name FROM file_path opt_file_type  */
+#line 455 "bison_parser.y"
                                                {
   (yyval.import_stmt) = new ImportStatement((yyvsp[0].import_type_t));
   (yyval.import_stmt)->filePath = (yyvsp[-1].sval);
   (yyval.import_stmt)->schema = (yyvsp[-3].table_name).schema;
   (yyval.import_stmt)->tableName = (yyvsp[-3].table_name).name;
 }
-#line 3444 "bison_parser.cpp"
+#line 3569 "bison_parser.cpp"
     break;
 
-  case 37: /* file_type: IDENTIFIER  */
-#line 443 "bison_parser.y"
+  case 38: /* file_type: IDENTIFIER  */
+#line 462 "bison_parser.y"
                        {
   if (strcasecmp((yyvsp[0].sval), "csv") == 0) {
     (yyval.import_type_t) = kImportCSV;
@@ -3459,69 +3584,69 @@ yyreduce:
   }
   free((yyvsp[0].sval));
 }
-#line 3463 "bison_parser.cpp"
+#line 3588 "bison_parser.cpp"
     break;
 
-  case 38: /* file_path: string_literal  */
-#line 458 "bison_parser.y"
+  case 39: /* file_path: string_literal  */
+#line 477 "bison_parser.y"
                            {
   (yyval.sval) = strdup((yyvsp[0].expr)->name);
   delete (yyvsp[0].expr);
 }
-#line 3472 "bison_parser.cpp"
+#line 3597 "bison_parser.cpp"
     break;
 
-  case 39: /* opt_file_type: WITH FORMAT file_type  */
-#line 463 "bison_parser.y"
+  case 40: /* opt_file_type: WITH FORMAT file_type  */
+#line 482 "bison_parser.y"
                                       { (yyval.import_type_t) = (yyvsp[0].import_type_t); }
-#line 3478 "bison_parser.cpp"
+#line 3603 "bison_parser.cpp"
     break;
 
-  case 40: /* opt_file_type: %empty  */
-#line 464 "bison_parser.y"
+  case 41: /* opt_file_type: %empty  */
+#line 483 "bison_parser.y"
               { (yyval.import_type_t) = kImportAuto; }
-#line 3484 "bison_parser.cpp"
+#line 3609 "bison_parser.cpp"
     break;
 
-  case 41: /* export_statement: COPY table_name TO file_path opt_file_type  */
-#line 470 "bison_parser.y"
+  case 42: /* export_statement: COPY table_name TO file_path opt_file_type  */
+#line 489 "bison_parser.y"
                                                               {
   (yyval.export_stmt) = new ExportStatement((yyvsp[0].import_type_t));
   (yyval.export_stmt)->filePath = (yyvsp[-1].sval);
   (yyval.export_stmt)->schema = (yyvsp[-3].table_name).schema;
   (yyval.export_stmt)->tableName = (yyvsp[-3].table_name).name;
 }
-#line 3495 "bison_parser.cpp"
+#line 3620 "bison_parser.cpp"
     break;
 
-  case 42: /* show_statement: SHOW TABLES  */
-#line 482 "bison_parser.y"
+  case 43: /* show_statement: SHOW TABLES  */
+#line 501 "bison_parser.y"
                              { (yyval.show_stmt) = new ShowStatement(kShowTables); }
-#line 3501 "bison_parser.cpp"
+#line 3626 "bison_parser.cpp"
     break;
 
-  case 43: /* show_statement: SHOW COLUMNS table_name  */
-#line 483 "bison_parser.y"
+  case 44: /* show_statement: SHOW COLUMNS table_name  */
+#line 502 "bison_parser.y"
                           {
   (yyval.show_stmt) = new ShowStatement(kShowColumns);
   (yyval.show_stmt)->schema = (yyvsp[0].table_name).schema;
   (yyval.show_stmt)->name = (yyvsp[0].table_name).name;
 }
-#line 3511 "bison_parser.cpp"
+#line 3636 "bison_parser.cpp"
     break;
 
-  case 44: /* show_statement: DESCRIBE table_name  */
-#line 488 "bison_parser.y"
+  case 45: /* show_statement: DESCRIBE table_name  */
+#line 507 "bison_parser.y"
                       {
   (yyval.show_stmt) = new ShowStatement(kShowColumns);
   (yyval.show_stmt)->schema = (yyvsp[0].table_name).schema;
   (yyval.show_stmt)->name = (yyvsp[0].table_name).name;
 }
-#line 3521 "bison_parser.cpp"
+#line 3646 "bison_parser.cpp"
     break;
 
-  case 45: /* create_statement: CREATE TABLE opt_not_exists table_name FROM IDENTIFIER FILE file_path  */
-#line 499 "bison_parser.y"
+  case 46: /* create_statement: CREATE TABLE opt_not_exists table_name FROM IDENTIFIER FILE file_path  */
+#line 518 "bison_parser.y"
                                                                                          {
   (yyval.create_stmt) = new CreateStatement(kCreateTableFromTbl);
   (yyval.create_stmt)->ifNotExists = (yyvsp[-5].bval);
@@ -3535,28 +3660,11 @@ yyreduce:
   free((yyvsp[-2].sval));
   (yyval.create_stmt)->filePath = (yyvsp[0].sval);
 }
-#line 3539 "bison_parser.cpp"
-    break;
-
-  case 46: /* create_statement: CREATE TABLE opt_not_exists table_name '(' table_elem_commalist ')'  */
-#line 512 "bison_parser.y"
-                                                                      {
-  (yyval.create_stmt) = new CreateStatement(kCreateTable);
-  (yyval.create_stmt)->ifNotExists = (yyvsp[-4].bval);
-  (yyval.create_stmt)->schema = (yyvsp[-3].table_name).schema;
-  (yyval.create_stmt)->tableName = (yyvsp[-3].table_name).name;
-  (yyval.create_stmt)->setColumnDefsAndConstraints((yyvsp[-1].table_element_vec));
-  delete (yyvsp[-1].table_element_vec);
-  if (result->errorMsg()) {
-    delete (yyval.create_stmt);
-    YYERROR;
-  }
-}
-#line 3556 "bison_parser.cpp"
+#line 3664 "bison_parser.cpp"
     break;
 
   case 47: /* create_statement: CREATE TABLE opt_not_exists table_name AS select_statement  */
-#line 524 "bison_parser.y"
+#line 531 "bison_parser.y"
                                                              {
   (yyval.create_stmt) = new CreateStatement(kCreateTable);
   (yyval.create_stmt)->ifNotExists = (yyvsp[-3].bval);
@@ -3564,23 +3672,33 @@ yyreduce:
   (yyval.create_stmt)->tableName = (yyvsp[-2].table_name).name;
   (yyval.create_stmt)->select = (yyvsp[0].select_stmt);
 }
-#line 3568 "bison_parser.cpp"
+#line 3676 "bison_parser.cpp"
     break;
 
-  case 48: /* create_statement: CREATE INDEX opt_not_exists opt_index_name ON table_name '(' ident_commalist ')'  */
-#line 531 "bison_parser.y"
-                                                                                   {
-  (yyval.create_stmt) = new CreateStatement(kCreateIndex);
-  (yyval.create_stmt)->indexName = (yyvsp[-5].sval);
-  (yyval.create_stmt)->ifNotExists = (yyvsp[-6].bval);
-  (yyval.create_stmt)->tableName = (yyvsp[-3].table_name).name;
-  (yyval.create_stmt)->indexColumns = (yyvsp[-1].str_vec);
+  case 48: /* create_statement: CREATE INDEX index_head ON table_name opt_index_method '(' ident_commalist ')' opt_index_method opt_index_include  */
+#line 538 "bison_parser.y"
+                                                                                                                    {
+  (yyval.create_stmt) = (yyvsp[-8].create_stmt);
+  (yyval.create_stmt)->schema = (yyvsp[-6].table_name).schema;
+  (yyval.create_stmt)->tableName = (yyvsp[-6].table_name).name;
+  (yyval.create_stmt)->indexMethod = (yyvsp[-5].sval);
+  (yyval.create_stmt)->indexColumns = (yyvsp[-3].str_vec);
+  (yyval.create_stmt)->indexInclude = (yyvsp[0].str_vec);
+  if ((yyvsp[-1].sval) != nullptr) {
+    if ((yyvsp[-5].sval) != nullptr) {
+      free((yyvsp[-1].sval));
+      delete (yyval.create_stmt);
+      yyerror(&yyloc, result, scanner, "Index method is specified twice.");
+      YYERROR;
+    }
+    (yyval.create_stmt)->indexMethod = (yyvsp[-1].sval);
+  }
 }
-#line 3580 "bison_parser.cpp"
+#line 3698 "bison_parser.cpp"
     break;
 
   case 49: /* create_statement: CREATE VIEW opt_not_exists table_name opt_column_list AS select_statement  */
-#line 538 "bison_parser.y"
+#line 555 "bison_parser.y"
                                                                             {
   (yyval.create_stmt) = new CreateStatement(kCreateView);
   (yyval.create_stmt)->ifNotExists = (yyvsp[-4].bval);
@@ -3589,383 +3707,546 @@ yyreduce:
   (yyval.create_stmt)->viewColumns = (yyvsp[-2].str_vec);
   (yyval.create_stmt)->select = (yyvsp[0].select_stmt);
 }
-#line 3593 "bison_parser.cpp"
+#line 3711 "bison_parser.cpp"
     break;
 
-  case 50: /* opt_not_exists: IF NOT EXISTS  */
-#line 547 "bison_parser.y"
+  case 50: /* create_table_statement: create_table_columns  */
+#line 567 "bison_parser.y"
+                                              { (yyval.statement) = (yyvsp[0].create_stmt); }
+#line 3717 "bison_parser.cpp"
+    break;
+
+  case 51: /* create_table_statement: create_table_columns WITH HINT '(' hint_list ')'  */
+#line 568 "bison_parser.y"
+                                                   {
+  (yyval.statement) = (yyvsp[-5].create_stmt);
+  (yyval.statement)->hints = (yyvsp[-1].expr_vec);
+}
+#line 3726 "bison_parser.cpp"
+    break;
+
+  case 52: /* create_table_statement: create_table_columns WITH '(' table_option_commalist ')' opt_hints  */
+#line 572 "bison_parser.y"
+                                                                     {
+  (yyvsp[-5].create_stmt)->tableOptions = (yyvsp[-2].table_option_vec);
+  (yyval.statement) = (yyvsp[-5].create_stmt);
+  (yyval.statement)->hints = (yyvsp[0].expr_vec);
+}
+#line 3736 "bison_parser.cpp"
+    break;
+
+  case 53: /* create_table_columns: CREATE TABLE opt_not_exists table_name '(' table_elem_commalist ')'  */
+#line 578 "bison_parser.y"
+                                                                                           {
+  (yyval.create_stmt) = new CreateStatement(kCreateTable);
+  (yyval.create_stmt)->ifNotExists = (yyvsp[-4].bval);
+  (yyval.create_stmt)->schema = (yyvsp[-3].table_name).schema;
+  (yyval.create_stmt)->tableName = (yyvsp[-3].table_name).name;
+  (yyval.create_stmt)->setColumnDefsAndConstraints((yyvsp[-1].table_element_vec));
+  delete (yyvsp[-1].table_element_vec);
+  if (result->errorMsg()) {
+    delete (yyval.create_stmt);
+    YYERROR;
+  }
+}
+#line 3753 "bison_parser.cpp"
+    break;
+
+  case 54: /* index_head: opt_index_name  */
+#line 592 "bison_parser.y"
+                            {
+  (yyval.create_stmt) = new CreateStatement(kCreateIndex);
+  // CREATE INDEX CONCURRENTLY ON ... has no name, CONCURRENTLY is read as one
+  if ((yyvsp[0].sval) != nullptr && strcasecmp((yyvsp[0].sval), "concurrently") == 0) {
+    free((yyvsp[0].sval));
+    (yyval.create_stmt)->concurrently = true;
+  } else {
+    (yyval.create_stmt)->indexName = (yyvsp[0].sval);
+  }
+}
+#line 3768 "bison_parser.cpp"
+    break;
+
+  case 55: /* index_head: IF NOT EXISTS opt_index_name  */
+#line 602 "bison_parser.y"
+                               {
+  (yyval.create_stmt) = new CreateStatement(kCreateIndex);
+  (yyval.create_stmt)->ifNotExists = true;
+  (yyval.create_stmt)->indexName = (yyvsp[0].sval);
+}
+#line 3778 "bison_parser.cpp"
+    break;
+
+  case 56: /* index_head: IDENTIFIER IDENTIFIER  */
+#line 607 "bison_parser.y"
+                        {
+  if (strcasecmp((yyvsp[-1].sval), "concurrently") != 0) {
+    free((yyvsp[-1].sval));
+    free((yyvsp[0].sval));
+    yyerror(&yyloc, result, scanner, "Expected CONCURRENTLY or ON.");
+    YYERROR;
+  }
+  free((yyvsp[-1].sval));
+  (yyval.create_stmt) = new CreateStatement(kCreateIndex);
+  (yyval.create_stmt)->concurrently = true;
+  (yyval.create_stmt)->indexName = (yyvsp[0].sval);
+}
+#line 3795 "bison_parser.cpp"
+    break;
+
+  case 57: /* index_head: IDENTIFIER IF NOT EXISTS opt_index_name  */
+#line 619 "bison_parser.y"
+                                          {
+  if (strcasecmp((yyvsp[-4].sval), "concurrently") != 0) {
+    free((yyvsp[-4].sval));
+    free((yyvsp[0].sval));
+    yyerror(&yyloc, result, scanner, "Expected CONCURRENTLY or ON.");
+    YYERROR;
+  }
+  free((yyvsp[-4].sval));
+  (yyval.create_stmt) = new CreateStatement(kCreateIndex);
+  (yyval.create_stmt)->concurrently = true;
+  (yyval.create_stmt)->ifNotExists = true;
+  (yyval.create_stmt)->indexName = (yyvsp[0].sval);
+}
+#line 3813 "bison_parser.cpp"
+    break;
+
+  case 58: /* opt_index_include: IDENTIFIER '(' ident_commalist ')'  */
+#line 634 "bison_parser.y"
+                                                       {
+  if (strcasecmp((yyvsp[-3].sval), "include") != 0) {
+    free((yyvsp[-3].sval));
+    for (char* column : *(yyvsp[-1].str_vec)) {
+      free(column);
+    }
+    delete (yyvsp[-1].str_vec);
+    yyerror(&yyloc, result, scanner, "Expected INCLUDE.");
+    YYERROR;
+  }
+  free((yyvsp[-3].sval));
+  (yyval.str_vec) = (yyvsp[-1].str_vec);
+}
+#line 3831 "bison_parser.cpp"
+    break;
+
+  case 59: /* opt_index_include: %empty  */
+#line 647 "bison_parser.y"
+              { (yyval.str_vec) = nullptr; }
+#line 3837 "bison_parser.cpp"
+    break;
+
+  case 60: /* opt_not_exists: IF NOT EXISTS  */
+#line 649 "bison_parser.y"
                                { (yyval.bval) = true; }
-#line 3599 "bison_parser.cpp"
+#line 3843 "bison_parser.cpp"
     break;
 
-  case 51: /* opt_not_exists: %empty  */
-#line 548 "bison_parser.y"
+  case 61: /* opt_not_exists: %empty  */
+#line 650 "bison_parser.y"
               { (yyval.bval) = false; }
-#line 3605 "bison_parser.cpp"
+#line 3849 "bison_parser.cpp"
     break;
 
-  case 52: /* table_elem_commalist: table_elem  */
-#line 550 "bison_parser.y"
+  case 62: /* table_elem_commalist: table_elem  */
+#line 652 "bison_parser.y"
                                   {
   (yyval.table_element_vec) = new std::vector<TableElement*>();
   (yyval.table_element_vec)->push_back((yyvsp[0].table_element_t));
 }
-#line 3614 "bison_parser.cpp"
+#line 3858 "bison_parser.cpp"
     break;
 
-  case 53: /* table_elem_commalist: table_elem_commalist ',' table_elem  */
-#line 554 "bison_parser.y"
+  case 63: /* table_elem_commalist: table_elem_commalist ',' table_elem  */
+#line 656 "bison_parser.y"
                                       {
   (yyvsp[-2].table_element_vec)->push_back((yyvsp[0].table_element_t));
   (yyval.table_element_vec) = (yyvsp[-2].table_element_vec);
 }
-#line 3623 "bison_parser.cpp"
+#line 3867 "bison_parser.cpp"
     break;
 
-  case 54: /* table_elem: column_def  */
-#line 559 "bison_parser.y"
+  case 64: /* table_elem: column_def  */
+#line 661 "bison_parser.y"
                         { (yyval.table_element_t) = (yyvsp[0].column_t); }
-#line 3629 "bison_parser.cpp"
+#line 3873 "bison_parser.cpp"
     break;
 
-  case 55: /* table_elem: table_constraint  */
-#line 560 "bison_parser.y"
+  case 65: /* table_elem: table_constraint  */
+#line 662 "bison_parser.y"
                    { (yyval.table_element_t) = (yyvsp[0].table_constraint_t); }
-#line 3635 "bison_parser.cpp"
+#line 3879 "bison_parser.cpp"
+    break;
+
+  case 66: /* table_option_commalist: table_option  */
+#line 664 "bison_parser.y"
+                                      {
+  (yyval.table_option_vec) = new std::vector<TableOption*>();
+  (yyval.table_option_vec)->push_back((yyvsp[0].table_option_t));
+}
+#line 3888 "bison_parser.cpp"
+    break;
+
+  case 67: /* table_option_commalist: table_option_commalist ',' table_option  */
+#line 668 "bison_parser.y"
+                                          {
+  (yyvsp[-2].table_option_vec)->push_back((yyvsp[0].table_option_t));
+  (yyval.table_option_vec) = (yyvsp[-2].table_option_vec);
+}
+#line 3897 "bison_parser.cpp"
     break;
 
-  case 56: /* column_def: IDENTIFIER column_type opt_column_constraints  */
-#line 562 "bison_parser.y"
+  case 68: /* table_option: IDENTIFIER '=' table_option_value  */
+#line 673 "bison_parser.y"
+                                                 { (yyval.table_option_t) = new TableOption((yyvsp[-2].sval), (yyvsp[0].sval)); }
+#line 3903 "bison_parser.cpp"
+    break;
+
+  case 69: /* table_option_value: IDENTIFIER  */
+#line 675 "bison_parser.y"
+                                { (yyval.sval) = (yyvsp[0].sval); }
+#line 3909 "bison_parser.cpp"
+    break;
+
+  case 70: /* table_option_value: COLUMN  */
+#line 676 "bison_parser.y"
+         { (yyval.sval) = strdup("column"); }
+#line 3915 "bison_parser.cpp"
+    break;
+
+  case 71: /* column_def: IDENTIFIER column_type opt_column_constraints  */
+#line 678 "bison_parser.y"
                                                            {
   (yyval.column_t) = new ColumnDefinition((yyvsp[-2].sval), (yyvsp[-1].column_type_t), (yyvsp[0].column_constraint_set));
   if (!(yyval.column_t)->trySetNullableExplicit()) {
     yyerror(&yyloc, result, scanner, ("Conflicting nullability constraints for " + std::string{(yyvsp[-2].sval)}).c_str());
   }
 }
-#line 3646 "bison_parser.cpp"
+#line 3926 "bison_parser.cpp"
     break;
 
-  case 57: /* column_type: BIGINT  */
-#line 569 "bison_parser.y"
+  case 72: /* column_type: BIGINT  */
+#line 685 "bison_parser.y"
                      { (yyval.column_type_t) = ColumnType{DataType::BIGINT}; }
-#line 3652 "bison_parser.cpp"
+#line 3932 "bison_parser.cpp"
     break;
 
-  case 58: /* column_type: BOOLEAN  */
-#line 570 "bison_parser.y"
+  case 73: /* column_type: BOOLEAN  */
+#line 686 "bison_parser.y"
           { (yyval.column_type_t) = ColumnType{DataType::BOOLEAN}; }
-#line 3658 "bison_parser.cpp"
+#line 3938 "bison_parser.cpp"
     break;
 
-  case 59: /* column_type: CHAR '(' INTVAL ')'  */
-#line 571 "bison_parser.y"
+  case 74: /* column_type: CHAR '(' INTVAL ')'  */
+#line 687 "bison_parser.y"
                       { (yyval.column_type_t) = ColumnType{DataType::CHAR, (yyvsp[-1].ival)}; }
-#line 3664 "bison_parser.cpp"
+#line 3944 "bison_parser.cpp"
     break;
 
-  case 60: /* column_type: CHARACTER_VARYING '(' INTVAL ')'  */
-#line 572 "bison_parser.y"
+  case 75: /* column_type: CHARACTER_VARYING '(' INTVAL ')'  */
+#line 688 "bison_parser.y"
                                    { (yyval.column_type_t) = ColumnType{DataType::VARCHAR, (yyvsp[-1].ival)}; }
-#line 3670 "bison_parser.cpp"
+#line 3950 "bison_parser.cpp"
     break;
 
-  case 61: /* column_type: DATE  */
-#line 573 "bison_parser.y"
+  case 76: /* column_type: DATE  */
+#line 689 "bison_parser.y"
        { (yyval.column_type_t) = ColumnType{DataType::DATE}; }
-#line 3676 "bison_parser.cpp"
+#line 3956 "bison_parser.cpp"
     break;
 
-  case 62: /* column_type: DATETIME  */
-#line 574 "bison_parser.y"
+  case 77: /* column_type: DATETIME  */
+#line 690 "bison_parser.y"
            { (yyval.column_type_t) = ColumnType{DataType::DATETIME}; }
-#line 3682 "bison_parser.cpp"
+#line 3962 "bison_parser.cpp"
     break;
 
-  case 63: /* column_type: DECIMAL opt_decimal_specification  */
-#line 575 "bison_parser.y"
+  case 78: /* column_type: DECIMAL opt_decimal_specification  */
+#line 691 "bison_parser.y"
                                     {
   (yyval.column_type_t) = ColumnType{DataType::DECIMAL, 0, (yyvsp[0].ival_pair)->first, (yyvsp[0].ival_pair)->second};
   delete (yyvsp[0].ival_pair);
 }
-#line 3691 "bison_parser.cpp"
+#line 3971 "bison_parser.cpp"
     break;
 
-  case 64: /* column_type: DOUBLE  */
-#line 579 "bison_parser.y"
+  case 79: /* column_type: DOUBLE  */
+#line 695 "bison_parser.y"
          { (yyval.column_type_t) = ColumnType{DataType::DOUBLE}; }
-#line 3697 "bison_parser.cpp"
+#line 3977 "bison_parser.cpp"
     break;
 
-  case 65: /* column_type: FLOAT  */
-#line 580 "bison_parser.y"
+  case 80: /* column_type: FLOAT  */
+#line 696 "bison_parser.y"
         { (yyval.column_type_t) = ColumnType{DataType::FLOAT}; }
-#line 3703 "bison_parser.cpp"
+#line 3983 "bison_parser.cpp"
     break;
 
-  case 66: /* column_type: INT  */
-#line 581 "bison_parser.y"
+  case 81: /* column_type: INT  */
+#line 697 "bison_parser.y"
       { (yyval.column_type_t) = ColumnType{DataType::INT}; }
-#line 3709 "bison_parser.cpp"
+#line 3989 "bison_parser.cpp"
     break;
 
-  case 67: /* column_type: INTEGER  */
-#line 582 "bison_parser.y"
+  case 82: /* column_type: INTEGER  */
+#line 698 "bison_parser.y"
           { (yyval.column_type_t) = ColumnType{DataType::INT}; }
-#line 3715 "bison_parser.cpp"
+#line 3995 "bison_parser.cpp"
     break;
 
-  case 68: /* column_type: LONG  */
-#line 583 "bison_parser.y"
+  case 83: /* column_type: LONG  */
+#line 699 "bison_parser.y"
        { (yyval.column_type_t) = ColumnType{DataType::LONG}; }
-#line 3721 "bison_parser.cpp"
+#line 4001 "bison_parser.cpp"
     break;
 
-  case 69: /* column_type: REAL  */
-#line 584 "bison_parser.y"
+  case 84: /* column_type: REAL  */
+#line 700 "bison_parser.y"
        { (yyval.column_type_t) = ColumnType{DataType::REAL}; }
-#line 3727 "bison_parser.cpp"
+#line 4007 "bison_parser.cpp"
     break;
 
-  case 70: /* column_type: SMALLINT  */
-#line 585 "bison_parser.y"
+  case 85: /* column_type: SMALLINT  */
+#line 701 "bison_parser.y"
            { (yyval.column_type_t) = ColumnType{DataType::SMALLINT}; }
-#line 3733 "bison_parser.cpp"
+#line 4013 "bison_parser.cpp"
     break;
 
-  case 71: /* column_type: TEXT  */
-#line 586 "bison_parser.y"
+  case 86: /* column_type: TEXT  */
+#line 702 "bison_parser.y"
        { (yyval.column_type_t) = ColumnType{DataType::TEXT}; }
-#line 3739 "bison_parser.cpp"
+#line 4019 "bison_parser.cpp"
     break;
 
-  case 72: /* column_type: TIME opt_time_precision  */
-#line 587 "bison_parser.y"
+  case 87: /* column_type: TIME opt_time_precision  */
+#line 703 "bison_parser.y"
                           { (yyval.column_type_t) = ColumnType{DataType::TIME, 0, (yyvsp[0].ival)}; }
-#line 3745 "bison_parser.cpp"
+#line 4025 "bison_parser.cpp"
     break;
 
-  case 73: /* column_type: TIMESTAMP  */
-#line 588 "bison_parser.y"
+  case 88: /* column_type: TIMESTAMP  */
+#line 704 "bison_parser.y"
             { (yyval.column_type_t) = ColumnType{DataType::DATETIME}; }
-#line 3751 "bison_parser.cpp"
+#line 4031 "bison_parser.cpp"
     break;
 
-  case 74: /* column_type: VARCHAR '(' INTVAL ')'  */
-#line 589 "bison_parser.y"
+  case 89: /* column_type: VARCHAR '(' INTVAL ')'  */
+#line 705 "bison_parser.y"
                          { (yyval.column_type_t) = ColumnType{DataType::VARCHAR, (yyvsp[-1].ival)}; }
-#line 3757 "bison_parser.cpp"
+#line 4037 "bison_parser.cpp"
     break;
 
-  case 75: /* opt_time_precision: '(' INTVAL ')'  */
-#line 591 "bison_parser.y"
+  case 90: /* opt_time_precision: '(' INTVAL ')'  */
+#line 707 "bison_parser.y"
                                     { (yyval.ival) = (yyvsp[-1].ival); }
-#line 3763 "bison_parser.cpp"
+#line 4043 "bison_parser.cpp"
     break;
 
-  case 76: /* opt_time_precision: %empty  */
-#line 592 "bison_parser.y"
+  case 91: /* opt_time_precision: %empty  */
+#line 708 "bison_parser.y"
               { (yyval.ival) = 0; }
-#line 3769 "bison_parser.cpp"
+#line 4049 "bison_parser.cpp"
     break;
 
-  case 77: /* opt_decimal_specification: '(' INTVAL ',' INTVAL ')'  */
-#line 594 "bison_parser.y"
+  case 92: /* opt_decimal_specification: '(' INTVAL ',' INTVAL ')'  */
+#line 710 "bison_parser.y"
                                                       { (yyval.ival_pair) = new std::pair<int64_t, int64_t>{(yyvsp[-3].ival), (yyvsp[-1].ival)}; }
-#line 3775 "bison_parser.cpp"
+#line 4055 "bison_parser.cpp"
     break;
 
-  case 78: /* opt_decimal_specification: '(' INTVAL ')'  */
-#line 595 "bison_parser.y"
+  case 93: /* opt_decimal_specification: '(' INTVAL ')'  */
+#line 711 "bison_parser.y"
                  { (yyval.ival_pair) = new std::pair<int64_t, int64_t>{(yyvsp[-1].ival), 0}; }
-#line 3781 "bison_parser.cpp"
+#line 4061 "bison_parser.cpp"
     break;
 
-  case 79: /* opt_decimal_specification: %empty  */
-#line 596 "bison_parser.y"
+  case 94: /* opt_decimal_specification: %empty  */
+#line 712 "bison_parser.y"
               { (yyval.ival_pair) = new std::pair<int64_t, int64_t>{0, 0}; }
-#line 3787 "bison_parser.cpp"
+#line 4067 "bison_parser.cpp"
     break;
 
-  case 80: /* opt_column_constraints: column_constraint_set  */
-#line 598 "bison_parser.y"
+  case 95: /* opt_column_constraints: column_constraint_set  */
+#line 714 "bison_parser.y"
                                                { (yyval.column_constraint_set) = (yyvsp[0].column_constraint_set); }
-#line 3793 "bison_parser.cpp"
+#line 4073 "bison_parser.cpp"
     break;
 
-  case 81: /* opt_column_constraints: %empty  */
-#line 599 "bison_parser.y"
+  case 96: /* opt_column_constraints: %empty  */
+#line 715 "bison_parser.y"
               { (yyval.column_constraint_set) = new std::unordered_set<ConstraintType>(); }
-#line 3799 "bison_parser.cpp"
+#line 4079 "bison_parser.cpp"
     break;
 
-  case 82: /* column_constraint_set: column_constraint  */
-#line 601 "bison_parser.y"
+  case 97: /* column_constraint_set: column_constraint  */
+#line 717 "bison_parser.y"
                                           {
   (yyval.column_constraint_set) = new std::unordered_set<ConstraintType>();
   (yyval.column_constraint_set)->insert((yyvsp[0].column_constraint_t));
 }
-#line 3808 "bison_parser.cpp"
+#line 4088 "bison_parser.cpp"
     break;
 
-  case 83: /* column_constraint_set: column_constraint_set column_constraint  */
-#line 605 "bison_parser.y"
+  case 98: /* column_constraint_set: column_constraint_set column_constraint  */
+#line 721 "bison_parser.y"
                                           {
   (yyvsp[-1].column_constraint_set)->insert((yyvsp[0].column_constraint_t));
   (yyval.column_constraint_set) = (yyvsp[-1].column_constraint_set);
 }
-#line 3817 "bison_parser.cpp"
+#line 4097 "bison_parser.cpp"
     break;
 
-  case 84: /* column_constraint: PRIMARY KEY  */
-#line 610 "bison_parser.y"
+  case 99: /* column_constraint: PRIMARY KEY  */
+#line 726 "bison_parser.y"
                                 { (yyval.column_constraint_t) = ConstraintType::PrimaryKey; }
-#line 3823 "bison_parser.cpp"
+#line 4103 "bison_parser.cpp"
     break;
 
-  case 85: /* column_constraint: UNIQUE  */
-#line 611 "bison_parser.y"
+  case 100: /* column_constraint: UNIQUE  */
+#line 727 "bison_parser.y"
          { (yyval.column_constraint_t) = ConstraintType::Unique; }
-#line 3829 "bison_parser.cpp"
+#line 4109 "bison_parser.cpp"
     break;
 
-  case 86: /* column_constraint: NULL  */
-#line 612 "bison_parser.y"
+  case 101: /* column_constraint: NULL  */
+#line 728 "bison_parser.y"
        { (yyval.column_constraint_t) = ConstraintType::Null; }
-#line 3835 "bison_parser.cpp"
+#line 4115 "bison_parser.cpp"
     break;
 
-  case 87: /* column_constraint: NOT NULL  */
-#line 613 "bison_parser.y"
+  case 102: /* column_constraint: NOT NULL  */
+#line 729 "bison_parser.y"
            { (yyval.column_constraint_t) = ConstraintType::NotNull; }
-#line 3841 "bison_parser.cpp"
+#line 4121 "bison_parser.cpp"
     break;
 
-  case 88: /* table_constraint: PRIMARY KEY '(' ident_commalist ')'  */
-#line 615 "bison_parser.y"
+  case 103: /* table_constraint: PRIMARY KEY '(' ident_commalist ')'  */
+#line 731 "bison_parser.y"
                                                        { (yyval.table_constraint_t) = new TableConstraint(ConstraintType::PrimaryKey, (yyvsp[-1].str_vec)); }
-#line 3847 "bison_parser.cpp"
+#line 4127 "bison_parser.cpp"
     break;
 
-  case 89: /* table_constraint: UNIQUE '(' ident_commalist ')'  */
-#line 616 "bison_parser.y"
+  case 104: /* table_constraint: UNIQUE '(' ident_commalist ')'  */
+#line 732 "bison_parser.y"
                                  { (yyval.table_constraint_t) = new TableConstraint(ConstraintType::Unique, (yyvsp[-1].str_vec)); }
-#line 3853 "bison_parser.cpp"
+#line 4133 "bison_parser.cpp"
     break;
 
-  case 90: /* drop_statement: DROP TABLE opt_exists table_name  */
-#line 624 "bison_parser.y"
+  case 105: /* drop_statement: DROP TABLE opt_exists table_name  */
+#line 740 "bison_parser.y"
                                                   {
   (yyval.drop_stmt) = new DropStatement(kDropTable);
   (yyval.drop_stmt)->ifExists = (yyvsp[-1].bval);
   (yyval.drop_stmt)->schema = (yyvsp[0].table_name).schema;
   (yyval.drop_stmt)->name = (yyvsp[0].table_name).name;
 }
-#line 3864 "bison_parser.cpp"
+#line 4144 "bison_parser.cpp"
     break;
 
-  case 91: /* drop_statement: DROP VIEW opt_exists table_name  */
-#line 630 "bison_parser.y"
+  case 106: /* drop_statement: DROP VIEW opt_exists table_name  */
+#line 746 "bison_parser.y"
                                   {
   (yyval.drop_stmt) = new DropStatement(kDropView);
   (yyval.drop_stmt)->ifExists = (yyvsp[-1].bval);
   (yyval.drop_stmt)->schema = (yyvsp[0].table_name).schema;
   (yyval.drop_stmt)->name = (yyvsp[0].table_name).name;
 }
-#line 3875 "bison_parser.cpp"
+#line 4155 "bison_parser.cpp"
     break;
 
-  case 92: /* drop_statement: DEALLOCATE PREPARE IDENTIFIER  */
-#line 636 "bison_parser.y"
+  case 107: /* drop_statement: DEALLOCATE PREPARE IDENTIFIER  */
+#line 752 "bison_parser.y"
                                 {
   (yyval.drop_stmt) = new DropStatement(kDropPreparedStatement);
   (yyval.drop_stmt)->ifExists = false;
   (yyval.drop_stmt)->name = (yyvsp[0].sval);
 }
-#line 3885 "bison_parser.cpp"
+#line 4165 "bison_parser.cpp"
     break;
 
-  case 93: /* drop_statement: DROP INDEX opt_exists IDENTIFIER  */
-#line 642 "bison_parser.y"
+  case 108: /* drop_statement: DROP INDEX opt_exists IDENTIFIER  */
+#line 758 "bison_parser.y"
                                    {
   (yyval.drop_stmt) = new DropStatement(kDropIndex);
   (yyval.drop_stmt)->ifExists = (yyvsp[-1].bval);
   (yyval.drop_stmt)->indexName = (yyvsp[0].sval);
 }
-#line 3895 "bison_parser.cpp"
+#line 4175 "bison_parser.cpp"
     break;
 
-  case 94: /* opt_exists: IF EXISTS  */
-#line 648 "bison_parser.y"
+  case 109: /* opt_exists: IF EXISTS  */
+#line 764 "bison_parser.y"
                        { (yyval.bval) = true; }
-#line 3901 "bison_parser.cpp"
+#line 4181 "bison_parser.cpp"
     break;
 
-  case 95: /* opt_exists: %empty  */
-#line 649 "bison_parser.y"
+  case 110: /* opt_exists: %empty  */
+#line 765 "bison_parser.y"
               { (yyval.bval) = false; }
-#line 3907 "bison_parser.cpp"
+#line 4187 "bison_parser.cpp"
     break;
 
-  case 96: /* alter_statement: ALTER TABLE opt_exists table_name alter_action  */
-#line 656 "bison_parser.y"
+  case 111: /* alter_statement: ALTER TABLE opt_exists table_name alter_action  */
+#line 772 "bison_parser.y"
                                                                  {
   (yyval.alter_stmt) = new AlterStatement((yyvsp[-1].table_name).name, (yyvsp[0].alter_action_t));
   (yyval.alter_stmt)->ifTableExists = (yyvsp[-2].bval);
   (yyval.alter_stmt)->schema = (yyvsp[-1].table_name).schema;
 }
-#line 3917 "bison_parser.cpp"
+#line 4197 "bison_parser.cpp"
     break;
 
-  case 97: /* alter_action: drop_action  */
-#line 662 "bison_parser.y"
+  case 112: /* alter_action: drop_action  */
+#line 778 "bison_parser.y"
                            { (yyval.alter_action_t) = (yyvsp[0].drop_action_t); }
-#line 3923 "bison_parser.cpp"
+#line 4203 "bison_parser.cpp"
     break;
 
-  case 98: /* drop_action: DROP COLUMN opt_exists IDENTIFIER  */
-#line 664 "bison_parser.y"
+  case 113: /* drop_action: DROP COLUMN opt_exists IDENTIFIER  */
+#line 780 "bison_parser.y"
                                                 {
   (yyval.drop_action_t) = new DropColumnAction((yyvsp[0].sval));
   (yyval.drop_action_t)->ifExists = (yyvsp[-1].bval);
 }
-#line 3932 "bison_parser.cpp"
+#line 4212 "bison_parser.cpp"
     break;
 
-  case 99: /* delete_statement: DELETE FROM table_name opt_where  */
-#line 674 "bison_parser.y"
+  case 114: /* delete_statement: DELETE FROM table_name opt_where  */
+#line 790 "bison_parser.y"
                                                     {
   (yyval.delete_stmt) = new DeleteStatement();
   (yyval.delete_stmt)->schema = (yyvsp[-1].table_name).schema;
   (yyval.delete_stmt)->tableName = (yyvsp[-1].table_name).name;
   (yyval.delete_stmt)->expr = (yyvsp[0].expr);
 }
-#line 3943 "bison_parser.cpp"
+#line 4223 "bison_parser.cpp"
     break;
 
-  case 100: /* truncate_statement: TRUNCATE table_name  */
-#line 681 "bison_parser.y"
+  case 115: /* truncate_statement: TRUNCATE table_name  */
+#line 797 "bison_parser.y"
                                          {
   (yyval.delete_stmt) = new DeleteStatement();
   (yyval.delete_stmt)->schema = (yyvsp[0].table_name).schema;
   (yyval.delete_stmt)->tableName = (yyvsp[0].table_name).name;
 }
-#line 3953 "bison_parser.cpp"
+#line 4233 "bison_parser.cpp"
     break;
 
-  case 101: /* insert_statement: INSERT INTO table_name opt_column_list VALUES '(' literal_list ')'  */
-#line 692 "bison_parser.y"
-                                                                                      {
+  case 116: /* insert_statement: INSERT INTO table_name opt_column_list VALUES values_list  */
+#line 808 "bison_parser.y"
+                                                                             {
   (yyval.insert_stmt) = new InsertStatement(kInsertValues);
-  (yyval.insert_stmt)->schema = (yyvsp[-5].table_name).schema;
-  (yyval.insert_stmt)->tableName = (yyvsp[-5].table_name).name;
-  (yyval.insert_stmt)->columns = (yyvsp[-4].str_vec);
-  (yyval.insert_stmt)->values = (yyvsp[-1].expr_vec);
+  (yyval.insert_stmt)->schema = (yyvsp[-3].table_name).schema;
+  (yyval.insert_stmt)->tableName = (yyvsp[-3].table_name).name;
+  (yyval.insert_stmt)->columns = (yyvsp[-2].str_vec);
+  (yyval.insert_stmt)->valuesList = (yyvsp[0].expr_vec_list);
+  (yyval.insert_stmt)->values = (yyvsp[0].expr_vec_list)->front();
 }
-#line 3965 "bison_parser.cpp"
+#line 4246 "bison_parser.cpp"
     break;
 
-  case 102: /* insert_statement: INSERT INTO table_name opt_column_list select_no_paren  */
-#line 699 "bison_parser.y"
+  case 117: /* insert_statement: INSERT INTO table_name opt_column_list select_no_paren  */
+#line 816 "bison_parser.y"
                                                          {
   (yyval.insert_stmt) = new InsertStatement(kInsertSelect);
   (yyval.insert_stmt)->schema = (yyvsp[-2].table_name).schema;
@@ -3973,80 +4254,98 @@ yyreduce:
   (yyval.insert_stmt)->columns = (yyvsp[-1].str_vec);
   (yyval.insert_stmt)->select = (yyvsp[0].select_stmt);
 }
-#line 3977 "bison_parser.cpp"
+#line 4258 "bison_parser.cpp"
     break;
 
-  case 103: /* opt_column_list: '(' ident_commalist ')'  */
-#line 707 "bison_parser.y"
+  case 118: /* values_list: '(' literal_list ')'  */
+#line 824 "bison_parser.y"
+                                   {
+  (yyval.expr_vec_list) = new std::vector<std::vector<Expr*>*>();
+  (yyval.expr_vec_list)->push_back((yyvsp[-1].expr_vec));
+}
+#line 4267 "bison_parser.cpp"
+    break;
+
+  case 119: /* values_list: values_list ',' '(' literal_list ')'  */
+#line 828 "bison_parser.y"
+                                       {
+  (yyvsp[-4].expr_vec_list)->push_back((yyvsp[-1].expr_vec));
+  (yyval.expr_vec_list) = (yyvsp[-4].expr_vec_list);
+}
+#line 4276 "bison_parser.cpp"
+    break;
+
+  case 120: /* opt_column_list: '(' ident_commalist ')'  */
+#line 833 "bison_parser.y"
                                           { (yyval.str_vec) = (yyvsp[-1].str_vec); }
-#line 3983 "bison_parser.cpp"
+#line 4282 "bison_parser.cpp"
     break;
 
-  case 104: /* opt_column_list: %empty  */
-#line 708 "bison_parser.y"
+  case 121: /* opt_column_list: %empty  */
+#line 834 "bison_parser.y"
               { (yyval.str_vec) = nullptr; }
-#line 3989 "bison_parser.cpp"
+#line 4288 "bison_parser.cpp"
     break;
 
-  case 105: /* update_statement: UPDATE table_ref_name_no_alias SET update_clause_commalist opt_where  */
-#line 715 "bison_parser.y"
+  case 122: /* update_statement: UPDATE table_ref_name_no_alias SET update_clause_commalist opt_where  */
+#line 841 "bison_parser.y"
                                                                                         {
   (yyval.update_stmt) = new UpdateStatement();
   (yyval.update_stmt)->table = (yyvsp[-3].table);
   (yyval.update_stmt)->updates = (yyvsp[-1].update_vec);
   (yyval.update_stmt)->where = (yyvsp[0].expr);
 }
-#line 4000 "bison_parser.cpp"
+#line 4299 "bison_parser.cpp"
     break;
 
-  case 106: /* update_clause_commalist: update_clause  */
-#line 722 "bison_parser.y"
+  case 123: /* update_clause_commalist: update_clause  */
+#line 848 "bison_parser.y"
                                         {
   (yyval.update_vec) = new std::vector<UpdateClause*>();
   (yyval.update_vec)->push_back((yyvsp[0].update_t));
 }
-#line 4009 "bison_parser.cpp"
+#line 4308 "bison_parser.cpp"
     break;
 
-  case 107: /* update_clause_commalist: update_clause_commalist ',' update_clause  */
-#line 726 "bison_parser.y"
+  case 124: /* update_clause_commalist: update_clause_commalist ',' update_clause  */
+#line 852 "bison_parser.y"
                                             {
   (yyvsp[-2].update_vec)->push_back((yyvsp[0].update_t));
   (yyval.update_vec) = (yyvsp[-2].update_vec);
 }
-#line 4018 "bison_parser.cpp"
+#line 4317 "bison_parser.cpp"
     break;
 
-  case 108: /* update_clause: IDENTIFIER '=' expr  */
-#line 731 "bison_parser.y"
+  case 125: /* update_clause: IDENTIFIER '=' expr  */
+#line 857 "bison_parser.y"
                                     {
   (yyval.update_t) = new UpdateClause();
   (yyval.update_t)->column = (yyvsp[-2].sval);
   (yyval.update_t)->value = (yyvsp[0].expr);
 }
-#line 4028 "bison_parser.cpp"
+#line 4327 "bison_parser.cpp"
     break;
 
-  case 109: /* select_statement: opt_with_clause select_with_paren  */
-#line 741 "bison_parser.y"
+  case 126: /* select_statement: opt_with_clause select_with_paren  */
+#line 867 "bison_parser.y"
                                                      {
   (yyval.select_stmt) = (yyvsp[0].select_stmt);
   (yyval.select_stmt)->withDescriptions = (yyvsp[-1].with_description_vec);
 }
-#line 4037 "bison_parser.cpp"
+#line 4336 "bison_parser.cpp"
     break;
 
-  case 110: /* select_statement: opt_with_clause select_no_paren  */
-#line 745 "bison_parser.y"
+  case 127: /* select_statement: opt_with_clause select_no_paren  */
+#line 871 "bison_parser.y"
                                   {
   (yyval.select_stmt) = (yyvsp[0].select_stmt);
   (yyval.select_stmt)->withDescriptions = (yyvsp[-1].with_description_vec);
 }
-#line 4046 "bison_parser.cpp"
+#line 4345 "bison_parser.cpp"
     break;
 
-  case 111: /* select_statement: opt_with_clause select_with_paren set_operator select_within_set_operation opt_order opt_limit  */
-#line 749 "bison_parser.y"
+  case 128: /* select_statement: opt_with_clause select_with_paren set_operator select_within_set_operation opt_order opt_limit  */
+#line 875 "bison_parser.y"
                                                                                                  {
   (yyval.select_stmt) = (yyvsp[-4].select_stmt);
   if ((yyval.select_stmt)->setOperations == nullptr) {
@@ -4058,17 +4357,17 @@ yyreduce:
   (yyval.select_stmt)->setOperations->back()->resultLimit = (yyvsp[0].limit);
   (yyval.select_stmt)->withDescriptions = (yyvsp[-5].with_description_vec);
 }
-#line 4062 "bison_parser.cpp"
+#line 4361 "bison_parser.cpp"
     break;
 
-  case 114: /* select_within_set_operation_no_parentheses: select_clause  */
-#line 763 "bison_parser.y"
+  case 131: /* select_within_set_operation_no_parentheses: select_clause  */
+#line 889 "bison_parser.y"
                                                            { (yyval.select_stmt) = (yyvsp[0].select_stmt); }
-#line 4068 "bison_parser.cpp"
+#line 4367 "bison_parser.cpp"
     break;
 
-  case 115: /* select_within_set_operation_no_parentheses: select_clause set_operator select_within_set_operation  */
-#line 764 "bison_parser.y"
+  case 132: /* select_within_set_operation_no_parentheses: select_clause set_operator select_within_set_operation  */
+#line 890 "bison_parser.y"
                                                          {
   (yyval.select_stmt) = (yyvsp[-2].select_stmt);
   if ((yyval.select_stmt)->setOperations == nullptr) {
@@ -4077,23 +4376,23 @@ yyreduce:
   (yyval.select_stmt)->setOperations->push_back((yyvsp[-1].set_operator_t));
   (yyval.select_stmt)->setOperations->back()->nestedSelectStatement = (yyvsp[0].select_stmt);
 }
-#line 4081 "bison_parser.cpp"
+#line 4380 "bison_parser.cpp"
     break;
 
-  case 116: /* select_with_paren: '(' select_no_paren ')'  */
-#line 773 "bison_parser.y"
+  case 133: /* select_with_paren: '(' select_no_paren ')'  */
+#line 899 "bison_parser.y"
                                             { (yyval.select_stmt) = (yyvsp[-1].select_stmt); }
-#line 4087 "bison_parser.cpp"
+#line 4386 "bison_parser.cpp"
     break;
 
-  case 117: /* select_with_paren: '(' select_with_paren ')'  */
-#line 774 "bison_parser.y"
+  case 134: /* select_with_paren: '(' select_with_paren ')'  */
+#line 900 "bison_parser.y"
                             { (yyval.select_stmt) = (yyvsp[-1].select_stmt); }
-#line 4093 "bison_parser.cpp"
+#line 4392 "bison_parser.cpp"
     break;
 
-  case 118: /* select_no_paren: select_clause opt_order opt_limit opt_locking_clause  */
-#line 776 "bison_parser.y"
+  case 135: /* select_no_paren: select_clause opt_order opt_limit opt_locking_clause  */
+#line 902 "bison_parser.y"
                                                                        {
   (yyval.select_stmt) = (yyvsp[-3].select_stmt);
   (yyval.select_stmt)->order = (yyvsp[-2].order_vec);
@@ -4108,11 +4407,11 @@ yyreduce:
     (yyval.select_stmt)->lockings = (yyvsp[0].locking_clause_vec);
   }
 }
-#line 4112 "bison_parser.cpp"
+#line 4411 "bison_parser.cpp"
     break;
 
-  case 119: /* select_no_paren: select_clause set_operator select_within_set_operation opt_order opt_limit opt_locking_clause  */
-#line 790 "bison_parser.y"
+  case 136: /* select_no_paren: select_clause set_operator select_within_set_operation opt_order opt_limit opt_locking_clause  */
+#line 916 "bison_parser.y"
                                                                                                 {
   (yyval.select_stmt) = (yyvsp[-5].select_stmt);
   if ((yyval.select_stmt)->setOperations == nullptr) {
@@ -4124,59 +4423,59 @@ yyreduce:
   (yyval.select_stmt)->setOperations->back()->resultLimit = (yyvsp[-1].limit);
   (yyval.select_stmt)->lockings = (yyvsp[0].locking_clause_vec);
 }
-#line 4128 "bison_parser.cpp"
+#line 4427 "bison_parser.cpp"
     break;
 
-  case 120: /* set_operator: set_type opt_all  */
-#line 802 "bison_parser.y"
+  case 137: /* set_operator: set_type opt_all  */
+#line 928 "bison_parser.y"
                                 {
   (yyval.set_operator_t) = (yyvsp[-1].set_operator_t);
   (yyval.set_operator_t)->isAll = (yyvsp[0].bval);
 }
-#line 4137 "bison_parser.cpp"
+#line 4436 "bison_parser.cpp"
     break;
 
-  case 121: /* set_type: UNION  */
-#line 807 "bison_parser.y"
+  case 138: /* set_type: UNION  */
+#line 933 "bison_parser.y"
                  {
   (yyval.set_operator_t) = new SetOperation();
   (yyval.set_operator_t)->setType = SetType::kSetUnion;
 }
-#line 4146 "bison_parser.cpp"
+#line 4445 "bison_parser.cpp"
     break;
 
-  case 122: /* set_type: INTERSECT  */
-#line 811 "bison_parser.y"
+  case 139: /* set_type: INTERSECT  */
+#line 937 "bison_parser.y"
             {
   (yyval.set_operator_t) = new SetOperation();
   (yyval.set_operator_t)->setType = SetType::kSetIntersect;
 }
-#line 4155 "bison_parser.cpp"
+#line 4454 "bison_parser.cpp"
     break;
 
-  case 123: /* set_type: EXCEPT  */
-#line 815 "bison_parser.y"
+  case 140: /* set_type: EXCEPT  */
+#line 941 "bison_parser.y"
          {
   (yyval.set_operator_t) = new SetOperation();
   (yyval.set_operator_t)->setType = SetType::kSetExcept;
 }
-#line 4164 "bison_parser.cpp"
+#line 4463 "bison_parser.cpp"
     break;
 
-  case 124: /* opt_all: ALL  */
-#line 820 "bison_parser.y"
+  case 141: /* opt_all: ALL  */
+#line 946 "bison_parser.y"
               { (yyval.bval) = true; }
-#line 4170 "bison_parser.cpp"
+#line 4469 "bison_parser.cpp"
     break;
 
-  case 125: /* opt_all: %empty  */
-#line 821 "bison_parser.y"
+  case 142: /* opt_all: %empty  */
+#line 947 "bison_parser.y"
               { (yyval.bval) = false; }
-#line 4176 "bison_parser.cpp"
+#line 4475 "bison_parser.cpp"
     break;
 
-  case 126: /* select_clause: SELECT opt_top opt_distinct select_list opt_from_clause opt_where opt_group  */
-#line 823 "bison_parser.y"
+  case 143: /* select_clause: SELECT opt_top opt_distinct select_list opt_from_clause opt_where opt_group  */
+#line 949 "bison_parser.y"
                                                                                             {
   (yyval.select_stmt) = new SelectStatement();
   (yyval.select_stmt)->limit = (yyvsp[-5].limit);
@@ -4186,231 +4485,231 @@ yyreduce:
   (yyval.select_stmt)->whereClause = (yyvsp[-1].expr);
   (yyval.select_stmt)->groupBy = (yyvsp[0].group_t);
 }
-#line 4190 "bison_parser.cpp"
+#line 4489 "bison_parser.cpp"
     break;
 
-  case 127: /* opt_distinct: DISTINCT  */
-#line 833 "bison_parser.y"
+  case 144: /* opt_distinct: DISTINCT  */
+#line 959 "bison_parser.y"
                         { (yyval.bval) = true; }
-#line 4196 "bison_parser.cpp"
+#line 4495 "bison_parser.cpp"
     break;
 
-  case 128: /* opt_distinct: %empty  */
-#line 834 "bison_parser.y"
+  case 145: /* opt_distinct: %empty  */
+#line 960 "bison_parser.y"
               { (yyval.bval) = false; }
-#line 4202 "bison_parser.cpp"
+#line 4501 "bison_parser.cpp"
     break;
 
-  case 130: /* opt_from_clause: from_clause  */
-#line 838 "bison_parser.y"
+  case 147: /* opt_from_clause: from_clause  */
+#line 964 "bison_parser.y"
                               { (yyval.table) = (yyvsp[0].table); }
-#line 4208 "bison_parser.cpp"
+#line 4507 "bison_parser.cpp"
     break;
 
-  case 131: /* opt_from_clause: %empty  */
-#line 839 "bison_parser.y"
+  case 148: /* opt_from_clause: %empty  */
+#line 965 "bison_parser.y"
               { (yyval.table) = nullptr; }
-#line 4214 "bison_parser.cpp"
+#line 4513 "bison_parser.cpp"
     break;
 
-  case 132: /* from_clause: FROM table_ref  */
-#line 841 "bison_parser.y"
+  case 149: /* from_clause: FROM table_ref  */
+#line 967 "bison_parser.y"
                              { (yyval.table) = (yyvsp[0].table); }
-#line 4220 "bison_parser.cpp"
+#line 4519 "bison_parser.cpp"
     break;
 
-  case 133: /* opt_where: WHERE expr  */
-#line 843 "bison_parser.y"
+  case 150: /* opt_where: WHERE expr  */
+#line 969 "bison_parser.y"
                        { (yyval.expr) = (yyvsp[0].expr); }
-#line 4226 "bison_parser.cpp"
+#line 4525 "bison_parser.cpp"
     break;
 
-  case 134: /* opt_where: %empty  */
-#line 844 "bison_parser.y"
+  case 151: /* opt_where: %empty  */
+#line 970 "bison_parser.y"
               { (yyval.expr) = nullptr; }
-#line 4232 "bison_parser.cpp"
+#line 4531 "bison_parser.cpp"
     break;
 
-  case 135: /* opt_group: GROUP BY expr_list opt_having  */
-#line 846 "bison_parser.y"
+  case 152: /* opt_group: GROUP BY expr_list opt_having  */
+#line 972 "bison_parser.y"
                                           {
   (yyval.group_t) = new GroupByDescription();
   (yyval.group_t)->columns = (yyvsp[-1].expr_vec);
   (yyval.group_t)->having = (yyvsp[0].expr);
 }
-#line 4242 "bison_parser.cpp"
+#line 4541 "bison_parser.cpp"
     break;
 
-  case 136: /* opt_group: %empty  */
-#line 851 "bison_parser.y"
+  case 153: /* opt_group: %empty  */
+#line 977 "bison_parser.y"
               { (yyval.group_t) = nullptr; }
-#line 4248 "bison_parser.cpp"
+#line 4547 "bison_parser.cpp"
     break;
 
-  case 137: /* opt_having: HAVING expr  */
-#line 853 "bison_parser.y"
+  case 154: /* opt_having: HAVING expr  */
+#line 979 "bison_parser.y"
                          { (yyval.expr) = (yyvsp[0].expr); }
-#line 4254 "bison_parser.cpp"
+#line 4553 "bison_parser.cpp"
     break;
 
-  case 138: /* opt_having: %empty  */
-#line 854 "bison_parser.y"
+  case 155: /* opt_having: %empty  */
+#line 980 "bison_parser.y"
               { (yyval.expr) = nullptr; }
-#line 4260 "bison_parser.cpp"
+#line 4559 "bison_parser.cpp"
     break;
 
-  case 139: /* opt_order: ORDER BY order_list  */
-#line 856 "bison_parser.y"
+  case 156: /* opt_order: ORDER BY order_list  */
+#line 982 "bison_parser.y"
                                 { (yyval.order_vec) = (yyvsp[0].order_vec); }
-#line 4266 "bison_parser.cpp"
+#line 4565 "bison_parser.cpp"
     break;
 
-  case 140: /* opt_order: %empty  */
-#line 857 "bison_parser.y"
+  case 157: /* opt_order: %empty  */
+#line 983 "bison_parser.y"
               { (yyval.order_vec) = nullptr; }
-#line 4272 "bison_parser.cpp"
+#line 4571 "bison_parser.cpp"
     break;
 
-  case 141: /* order_list: order_desc  */
-#line 859 "bison_parser.y"
+  case 158: /* order_list: order_desc  */
+#line 985 "bison_parser.y"
                         {
   (yyval.order_vec) = new std::vector<OrderDescription*>();
   (yyval.order_vec)->push_back((yyvsp[0].order));
 }
-#line 4281 "bison_parser.cpp"
+#line 4580 "bison_parser.cpp"
     break;
 
-  case 142: /* order_list: order_list ',' order_desc  */
-#line 863 "bison_parser.y"
+  case 159: /* order_list: order_list ',' order_desc  */
+#line 989 "bison_parser.y"
                             {
   (yyvsp[-2].order_vec)->push_back((yyvsp[0].order));
   (yyval.order_vec) = (yyvsp[-2].order_vec);
 }
-#line 4290 "bison_parser.cpp"
+#line 4589 "bison_parser.cpp"
     break;
 
-  case 143: /* order_desc: expr opt_order_type  */
-#line 868 "bison_parser.y"
+  case 160: /* order_desc: expr opt_order_type  */
+#line 994 "bison_parser.y"
                                  { (yyval.order) = new OrderDescription((yyvsp[0].order_type), (yyvsp[-1].expr)); }
-#line 4296 "bison_parser.cpp"
+#line 4595 "bison_parser.cpp"
     break;
 
-  case 144: /* opt_order_type: ASC  */
-#line 870 "bison_parser.y"
+  case 161: /* opt_order_type: ASC  */
+#line 996 "bison_parser.y"
                      { (yyval.order_type) = kOrderAsc; }
-#line 4302 "bison_parser.cpp"
+#line 4601 "bison_parser.cpp"
     break;
 
-  case 145: /* opt_order_type: DESC  */
-#line 871 "bison_parser.y"
+  case 162: /* opt_order_type: DESC  */
+#line 997 "bison_parser.y"
        { (yyval.order_type) = kOrderDesc; }
-#line 4308 "bison_parser.cpp"
+#line 4607 "bison_parser.cpp"
     break;
 
-  case 146: /* opt_order_type: %empty  */
-#line 872 "bison_parser.y"
+  case 163: /* opt_order_type: %empty  */
+#line 998 "bison_parser.y"
               { (yyval.order_type) = kOrderAsc; }
-#line 4314 "bison_parser.cpp"
+#line 4613 "bison_parser.cpp"
     break;
 
-  case 147: /* opt_top: TOP int_literal  */
-#line 876 "bison_parser.y"
+  case 164: /* opt_top: TOP int_literal  */
+#line 1002 "bison_parser.y"
                           { (yyval.limit) = new LimitDescription((yyvsp[0].expr), nullptr); }
-#line 4320 "bison_parser.cpp"
+#line 4619 "bison_parser.cpp"
     break;
 
-  case 148: /* opt_top: %empty  */
-#line 877 "bison_parser.y"
+  case 165: /* opt_top: %empty  */
+#line 1003 "bison_parser.y"
               { (yyval.limit) = nullptr; }
-#line 4326 "bison_parser.cpp"
+#line 4625 "bison_parser.cpp"
     break;
 
-  case 149: /* opt_limit: LIMIT expr  */
-#line 879 "bison_parser.y"
+  case 166: /* opt_limit: LIMIT expr  */
+#line 1005 "bison_parser.y"
                        { (yyval.limit) = new LimitDescription((yyvsp[0].expr), nullptr); }
-#line 4332 "bison_parser.cpp"
+#line 4631 "bison_parser.cpp"
     break;
 
-  case 150: /* opt_limit: OFFSET expr  */
-#line 880 "bison_parser.y"
+  case 167: /* opt_limit: OFFSET expr  */
+#line 1006 "bison_parser.y"
               { (yyval.limit) = new LimitDescription(nullptr, (yyvsp[0].expr)); }
-#line 4338 "bison_parser.cpp"
+#line 4637 "bison_parser.cpp"
     break;
 
-  case 151: /* opt_limit: LIMIT expr OFFSET expr  */
-#line 881 "bison_parser.y"
+  case 168: /* opt_limit: LIMIT expr OFFSET expr  */
+#line 1007 "bison_parser.y"
                          { (yyval.limit) = new LimitDescription((yyvsp[-2].expr), (yyvsp[0].expr)); }
-#line 4344 "bison_parser.cpp"
+#line 4643 "bison_parser.cpp"
     break;
 
-  case 152: /* opt_limit: LIMIT ALL  */
-#line 882 "bison_parser.y"
+  case 169: /* opt_limit: LIMIT ALL  */
+#line 1008 "bison_parser.y"
             { (yyval.limit) = new LimitDescription(nullptr, nullptr); }
-#line 4350 "bison_parser.cpp"
+#line 4649 "bison_parser.cpp"
     break;
 
-  case 153: /* opt_limit: LIMIT ALL OFFSET expr  */
-#line 883 "bison_parser.y"
+  case 170: /* opt_limit: LIMIT ALL OFFSET expr  */
+#line 1009 "bison_parser.y"
                         { (yyval.limit) = new LimitDescription(nullptr, (yyvsp[0].expr)); }
-#line 4356 "bison_parser.cpp"
+#line 4655 "bison_parser.cpp"
     break;
 
-  case 154: /* opt_limit: %empty  */
-#line 884 "bison_parser.y"
+  case 171: /* opt_limit: %empty  */
+#line 1010 "bison_parser.y"
               { (yyval.limit) = nullptr; }
-#line 4362 "bison_parser.cpp"
+#line 4661 "bison_parser.cpp"
     break;
 
-  case 155: /* expr_list: expr_alias  */
-#line 889 "bison_parser.y"
+  case 172: /* expr_list: expr_alias  */
+#line 1015 "bison_parser.y"
                        {
   (yyval.expr_vec) = new std::vector<Expr*>();
   (yyval.expr_vec)->push_back((yyvsp[0].expr));
 }
-#line 4371 "bison_parser.cpp"
+#line 4670 "bison_parser.cpp"
     break;
 
-  case 156: /* expr_list: expr_list ',' expr_alias  */
-#line 893 "bison_parser.y"
+  case 173: /* expr_list: expr_list ',' expr_alias  */
+#line 1019 "bison_parser.y"
                            {
   (yyvsp[-2].expr_vec)->push_back((yyvsp[0].expr));
   (yyval.expr_vec) = (yyvsp[-2].expr_vec);
 }
-#line 4380 "bison_parser.cpp"
+#line 4679 "bison_parser.cpp"
     break;
 
-  case 157: /* opt_literal_list: literal_list  */
-#line 898 "bison_parser.y"
+  case 174: /* opt_literal_list: literal_list  */
+#line 1024 "bison_parser.y"
                                 { (yyval.expr_vec) = (yyvsp[0].expr_vec); }
-#line 4386 "bison_parser.cpp"
+#line 4685 "bison_parser.cpp"
     break;
 
-  case 158: /* opt_literal_list: %empty  */
-#line 899 "bison_parser.y"
+  case 175: /* opt_literal_list: %empty  */
+#line 1025 "bison_parser.y"
               { (yyval.expr_vec) = nullptr; }
-#line 4392 "bison_parser.cpp"
+#line 4691 "bison_parser.cpp"
     break;
 
-  case 159: /* literal_list: literal  */
-#line 901 "bison_parser.y"
+  case 176: /* literal_list: literal  */
+#line 1027 "bison_parser.y"
                        {
   (yyval.expr_vec) = new std::vector<Expr*>();
   (yyval.expr_vec)->push_back((yyvsp[0].expr));
 }
-#line 4401 "bison_parser.cpp"
+#line 4700 "bison_parser.cpp"
     break;
 
-  case 160: /* literal_list: literal_list ',' literal  */
-#line 905 "bison_parser.y"
+  case 177: /* literal_list: literal_list ',' literal  */
+#line 1031 "bison_parser.y"
                            {
   (yyvsp[-2].expr_vec)->push_back((yyvsp[0].expr));
   (yyval.expr_vec) = (yyvsp[-2].expr_vec);
 }
-#line 4410 "bison_parser.cpp"
+#line 4709 "bison_parser.cpp"
     break;
 
-  case 161: /* expr_alias: expr opt_alias  */
-#line 910 "bison_parser.y"
+  case 178: /* expr_alias: expr opt_alias  */
+#line 1036 "bison_parser.y"
                             {
   (yyval.expr) = (yyvsp[-1].expr);
   if ((yyvsp[0].alias_t)) {
@@ -4418,415 +4717,415 @@ yyreduce:
     delete (yyvsp[0].alias_t);
   }
 }
-#line 4422 "bison_parser.cpp"
+#line 4721 "bison_parser.cpp"
     break;
 
-  case 167: /* operand: '(' expr ')'  */
-#line 920 "bison_parser.y"
+  case 184: /* operand: '(' expr ')'  */
+#line 1046 "bison_parser.y"
                        { (yyval.expr) = (yyvsp[-1].expr); }
-#line 4428 "bison_parser.cpp"
+#line 4727 "bison_parser.cpp"
     break;
 
-  case 177: /* operand: '(' select_no_paren ')'  */
-#line 922 "bison_parser.y"
+  case 194: /* operand: '(' select_no_paren ')'  */
+#line 1048 "bison_parser.y"
                                          {
   (yyval.expr) = Expr::makeSelect((yyvsp[-1].select_stmt));
 }
-#line 4436 "bison_parser.cpp"
+#line 4735 "bison_parser.cpp"
     break;
 
-  case 180: /* unary_expr: '-' operand  */
-#line 928 "bison_parser.y"
+  case 197: /* unary_expr: '-' operand  */
+#line 1054 "bison_parser.y"
                          { (yyval.expr) = Expr::makeOpUnary(kOpUnaryMinus, (yyvsp[0].expr)); }
-#line 4442 "bison_parser.cpp"
+#line 4741 "bison_parser.cpp"
     break;
 
-  case 181: /* unary_expr: NOT operand  */
-#line 929 "bison_parser.y"
+  case 198: /* unary_expr: NOT operand  */
+#line 1055 "bison_parser.y"
               { (yyval.expr) = Expr::makeOpUnary(kOpNot, (yyvsp[0].expr)); }
-#line 4448 "bison_parser.cpp"
+#line 4747 "bison_parser.cpp"
     break;
 
-  case 182: /* unary_expr: operand ISNULL  */
-#line 930 "bison_parser.y"
+  case 199: /* unary_expr: operand ISNULL  */
+#line 1056 "bison_parser.y"
                  { (yyval.expr) = Expr::makeOpUnary(kOpIsNull, (yyvsp[-1].expr)); }
-#line 4454 "bison_parser.cpp"
+#line 4753 "bison_parser.cpp"
     break;
 
-  case 183: /* unary_expr: operand IS NULL  */
-#line 931 "bison_parser.y"
+  case 200: /* unary_expr: operand IS NULL  */
+#line 1057 "bison_parser.y"
                   { (yyval.expr) = Expr::makeOpUnary(kOpIsNull, (yyvsp[-2].expr)); }
-#line 4460 "bison_parser.cpp"
+#line 4759 "bison_parser.cpp"
     break;
 
-  case 184: /* unary_expr: operand IS NOT NULL  */
-#line 932 "bison_parser.y"
+  case 201: /* unary_expr: operand IS NOT NULL  */
+#line 1058 "bison_parser.y"
                       { (yyval.expr) = Expr::makeOpUnary(kOpNot, Expr::makeOpUnary(kOpIsNull, (yyvsp[-3].expr))); }
-#line 4466 "bison_parser.cpp"
+#line 4765 "bison_parser.cpp"
     break;
 
-  case 186: /* binary_expr: operand '-' operand  */
-#line 934 "bison_parser.y"
+  case 203: /* binary_expr: operand '-' operand  */
+#line 1060 "bison_parser.y"
                                               { (yyval.expr) = Expr::makeOpBinary((yyvsp[-2].expr), kOpMinus, (yyvsp[0].expr)); }
-#line 4472 "bison_parser.cpp"
+#line 4771 "bison_parser.cpp"
     break;
 
-  case 187: /* binary_expr: operand '+' operand  */
-#line 935 "bison_parser.y"
+  case 204: /* binary_expr: operand '+' operand  */
+#line 1061 "bison_parser.y"
                       { (yyval.expr) = Expr::makeOpBinary((yyvsp[-2].expr), kOpPlus, (yyvsp[0].expr)); }
-#line 4478 "bison_parser.cpp"
+#line 4777 "bison_parser.cpp"
     break;
 
-  case 188: /* binary_expr: operand '/' operand  */
-#line 936 "bison_parser.y"
+  case 205: /* binary_expr: operand '/' operand  */
+#line 1062 "bison_parser.y"
                       { (yyval.expr) = Expr::makeOpBinary((yyvsp[-2].expr), kOpSlash, (yyvsp[0].expr)); }
-#line 4484 "bison_parser.cpp"
+#line 4783 "bison_parser.cpp"
     break;
 
-  case 189: /* binary_expr: operand '*' operand  */
-#line 937 "bison_parser.y"
+  case 206: /* binary_expr: operand '*' operand  */
+#line 1063 "bison_parser.y"
                       { (yyval.expr) = Expr::makeOpBinary((yyvsp[-2].expr), kOpAsterisk, (yyvsp[0].expr)); }
-#line 4490 "bison_parser.cpp"
+#line 4789 "bison_parser.cpp"
     break;
 
-  case 190: /* binary_expr: operand '%' operand  */
-#line 938 "bison_parser.y"
+  case 207: /* binary_expr: operand '%' operand  */
+#line 1064 "bison_parser.y"
                       { (yyval.expr) = Expr::makeOpBinary((yyvsp[-2].expr), kOpPercentage, (yyvsp[0].expr)); }
-#line 4496 "bison_parser.cpp"
+#line 4795 "bison_parser.cpp"
     break;
 
-  case 191: /* binary_expr: operand '^' operand  */
-#line 939 "bison_parser.y"
+  case 208: /* binary_expr: operand '^' operand  */
+#line 1065 "bison_parser.y"
                       { (yyval.expr) = Expr::makeOpBinary((yyvsp[-2].expr), kOpCaret, (yyvsp[0].expr)); }
-#line 4502 "bison_parser.cpp"
+#line 4801 "bison_parser.cpp"
     break;
 
-  case 192: /* binary_expr: operand LIKE operand  */
-#line 940 "bison_parser.y"
+  case 209: /* binary_expr: operand LIKE operand  */
+#line 1066 "bison_parser.y"
                        { (yyval.expr) = Expr::makeOpBinary((yyvsp[-2].expr), kOpLike, (yyvsp[0].expr)); }
-#line 4508 "bison_parser.cpp"
+#line 4807 "bison_parser.cpp"
     break;
 
-  case 193: /* binary_expr: operand NOT LIKE operand  */
-#line 941 "bison_parser.y"
+  case 210: /* binary_expr: operand NOT LIKE operand  */
+#line 1067 "bison_parser.y"
                            { (yyval.expr) = Expr::makeOpBinary((yyvsp[-3].expr), kOpNotLike, (yyvsp[0].expr)); }
-#line 4514 "bison_parser.cpp"
+#line 4813 "bison_parser.cpp"
     break;
 
-  case 194: /* binary_expr: operand ILIKE operand  */
-#line 942 "bison_parser.y"
+  case 211: /* binary_expr: operand ILIKE operand  */
+#line 1068 "bison_parser.y"
                         { (yyval.expr) = Expr::makeOpBinary((yyvsp[-2].expr), kOpILike, (yyvsp[0].expr)); }
-#line 4520 "bison_parser.cpp"
+#line 4819 "bison_parser.cpp"
     break;
 
-  case 195: /* binary_expr: operand CONCAT operand  */
-#line 943 "bison_parser.y"
+  case 212: /* binary_expr: operand CONCAT operand  */
+#line 1069 "bison_parser.y"
                          { (yyval.expr) = Expr::makeOpBinary((yyvsp[-2].expr), kOpConcat, (yyvsp[0].expr)); }
-#line 4526 "bison_parser.cpp"
+#line 4825 "bison_parser.cpp"
     break;
 
-  case 196: /* logic_expr: expr AND expr  */
-#line 945 "bison_parser.y"
+  case 213: /* logic_expr: expr AND expr  */
+#line 1071 "bison_parser.y"
                            { (yyval.expr) = Expr::makeOpBinary((yyvsp[-2].expr), kOpAnd, (yyvsp[0].expr)); }
-#line 4532 "bison_parser.cpp"
+#line 4831 "bison_parser.cpp"
     break;
 
-  case 197: /* logic_expr: expr OR expr  */
-#line 946 "bison_parser.y"
+  case 214: /* logic_expr: expr OR expr  */
+#line 1072 "bison_parser.y"
                { (yyval.expr) = Expr::makeOpBinary((yyvsp[-2].expr), kOpOr, (yyvsp[0].expr)); }
-#line 4538 "bison_parser.cpp"
+#line 4837 "bison_parser.cpp"
     break;
 
-  case 198: /* in_expr: operand IN '(' expr_list ')'  */
-#line 948 "bison_parser.y"
+  case 215: /* in_expr: operand IN '(' expr_list ')'  */
+#line 1074 "bison_parser.y"
                                        { (yyval.expr) = Expr::makeInOperator((yyvsp[-4].expr), (yyvsp[-1].expr_vec)); }
-#line 4544 "bison_parser.cpp"
+#line 4843 "bison_parser.cpp"
     break;
 
-  case 199: /* in_expr: operand NOT IN '(' expr_list ')'  */
-#line 949 "bison_parser.y"
+  case 216: /* in_expr: operand NOT IN '(' expr_list ')'  */
+#line 1075 "bison_parser.y"
                                    { (yyval.expr) = Expr::makeOpUnary(kOpNot, Expr::makeInOperator((yyvsp[-5].expr), (yyvsp[-1].expr_vec))); }
-#line 4550 "bison_parser.cpp"
+#line 4849 "bison_parser.cpp"
     break;
 
-  case 200: /* in_expr: operand IN '(' select_no_paren ')'  */
-#line 950 "bison_parser.y"
+  case 217: /* in_expr: operand IN '(' select_no_paren ')'  */
+#line 1076 "bison_parser.y"
                                      { (yyval.expr) = Expr::makeInOperator((yyvsp[-4].expr), (yyvsp[-1].select_stmt)); }
-#line 4556 "bison_parser.cpp"
+#line 4855 "bison_parser.cpp"
     break;
 
-  case 201: /* in_expr: operand NOT IN '(' select_no_paren ')'  */
-#line 951 "bison_parser.y"
+  case 218: /* in_expr: operand NOT IN '(' select_no_paren ')'  */
+#line 1077 "bison_parser.y"
                                          { (yyval.expr) = Expr::makeOpUnary(kOpNot, Expr::makeInOperator((yyvsp[-5].expr), (yyvsp[-1].select_stmt))); }
-#line 4562 "bison_parser.cpp"
+#line 4861 "bison_parser.cpp"
     break;
 
-  case 202: /* case_expr: CASE expr case_list END  */
-#line 955 "bison_parser.y"
+  case 219: /* case_expr: CASE expr case_list END  */
+#line 1081 "bison_parser.y"
                                     { (yyval.expr) = Expr::makeCase((yyvsp[-2].expr), (yyvsp[-1].expr), nullptr); }
-#line 4568 "bison_parser.cpp"
+#line 4867 "bison_parser.cpp"
     break;
 
-  case 203: /* case_expr: CASE expr case_list ELSE expr END  */
-#line 956 "bison_parser.y"
+  case 220: /* case_expr: CASE expr case_list ELSE expr END  */
+#line 1082 "bison_parser.y"
                                     { (yyval.expr) = Expr::makeCase((yyvsp[-4].expr), (yyvsp[-3].expr), (yyvsp[-1].expr)); }
-#line 4574 "bison_parser.cpp"
+#line 4873 "bison_parser.cpp"
     break;
 
-  case 204: /* case_expr: CASE case_list END  */
-#line 957 "bison_parser.y"
+  case 221: /* case_expr: CASE case_list END  */
+#line 1083 "bison_parser.y"
                      { (yyval.expr) = Expr::makeCase(nullptr, (yyvsp[-1].expr), nullptr); }
-#line 4580 "bison_parser.cpp"
+#line 4879 "bison_parser.cpp"
     break;
 
-  case 205: /* case_expr: CASE case_list ELSE expr END  */
-#line 958 "bison_parser.y"
+  case 222: /* case_expr: CASE case_list ELSE expr END  */
+#line 1084 "bison_parser.y"
                                { (yyval.expr) = Expr::makeCase(nullptr, (yyvsp[-3].expr), (yyvsp[-1].expr)); }
-#line 4586 "bison_parser.cpp"
+#line 4885 "bison_parser.cpp"
     break;
 
-  case 206: /* case_list: WHEN expr THEN expr  */
-#line 960 "bison_parser.y"
+  case 223: /* case_list: WHEN expr THEN expr  */
+#line 1086 "bison_parser.y"
                                 { (yyval.expr) = Expr::makeCaseList(Expr::makeCaseListElement((yyvsp[-2].expr), (yyvsp[0].expr))); }
-#line 4592 "bison_parser.cpp"
+#line 4891 "bison_parser.cpp"
     break;
 
-  case 207: /* case_list: case_list WHEN expr THEN expr  */
-#line 961 "bison_parser.y"
+  case 224: /* case_list: case_list WHEN expr THEN expr  */
+#line 1087 "bison_parser.y"
                                 { (yyval.expr) = Expr::caseListAppend((yyvsp[-4].expr), Expr::makeCaseListElement((yyvsp[-2].expr), (yyvsp[0].expr))); }
-#line 4598 "bison_parser.cpp"
+#line 4897 "bison_parser.cpp"
     break;
 
-  case 208: /* exists_expr: EXISTS '(' select_no_paren ')'  */
-#line 963 "bison_parser.y"
+  case 225: /* exists_expr: EXISTS '(' select_no_paren ')'  */
+#line 1089 "bison_parser.y"
                                              { (yyval.expr) = Expr::makeExists((yyvsp[-1].select_stmt)); }
-#line 4604 "bison_parser.cpp"
+#line 4903 "bison_parser.cpp"
     break;
 
-  case 209: /* exists_expr: NOT EXISTS '(' select_no_paren ')'  */
-#line 964 "bison_parser.y"
+  case 226: /* exists_expr: NOT EXISTS '(' select_no_paren ')'  */
+#line 1090 "bison_parser.y"
                                      { (yyval.expr) = Expr::makeOpUnary(kOpNot, Expr::makeExists((yyvsp[-1].select_stmt))); }
-#line 4610 "bison_parser.cpp"
+#line 4909 "bison_parser.cpp"
     break;
 
-  case 210: /* comp_expr: operand '=' operand  */
-#line 966 "bison_parser.y"
+  case 227: /* comp_expr: operand '=' operand  */
+#line 1092 "bison_parser.y"
                                 { (yyval.expr) = Expr::makeOpBinary((yyvsp[-2].expr), kOpEquals, (yyvsp[0].expr)); }
-#line 4616 "bison_parser.cpp"
+#line 4915 "bison_parser.cpp"
     break;
 
-  case 211: /* comp_expr: operand EQUALS operand  */
-#line 967 "bison_parser.y"
+  case 228: /* comp_expr: operand EQUALS operand  */
+#line 1093 "bison_parser.y"
                          { (yyval.expr) = Expr::makeOpBinary((yyvsp[-2].expr), kOpEquals, (yyvsp[0].expr)); }
-#line 4622 "bison_parser.cpp"
+#line 4921 "bison_parser.cpp"
     break;
 
-  case 212: /* comp_expr: operand NOTEQUALS operand  */
-#line 968 "bison_parser.y"
+  case 229: /* comp_expr: operand NOTEQUALS operand  */
+#line 1094 "bison_parser.y"
                             { (yyval.expr) = Expr::makeOpBinary((yyvsp[-2].expr), kOpNotEquals, (yyvsp[0].expr)); }
-#line 4628 "bison_parser.cpp"
+#line 4927 "bison_parser.cpp"
     break;
 
-  case 213: /* comp_expr: operand '<' operand  */
-#line 969 "bison_parser.y"
+  case 230: /* comp_expr: operand '<' operand  */
+#line 1095 "bison_parser.y"
                       { (yyval.expr) = Expr::makeOpBinary((yyvsp[-2].expr), kOpLess, (yyvsp[0].expr)); }
-#line 4634 "bison_parser.cpp"
+#line 4933 "bison_parser.cpp"
     break;
 
-  case 214: /* comp_expr: operand '>' operand  */
-#line 970 "bison_parser.y"
+  case 231: /* comp_expr: operand '>' operand  */
+#line 1096 "bison_parser.y"
                       { (yyval.expr) = Expr::makeOpBinary((yyvsp[-2].expr), kOpGreater, (yyvsp[0].expr)); }
-#line 4640 "bison_parser.cpp"
+#line 4939 "bison_parser.cpp"
     break;
 
-  case 215: /* comp_expr: operand LESSEQ operand  */
-#line 971 "bison_parser.y"
+  case 232: /* comp_expr: operand LESSEQ operand  */
+#line 1097 "bison_parser.y"
                          { (yyval.expr) = Expr::makeOpBinary((yyvsp[-2].expr), kOpLessEq, (yyvsp[0].expr)); }
-#line 4646 "bison_parser.cpp"
+#line 4945 "bison_parser.cpp"
     break;
 
-  case 216: /* comp_expr: operand GREATEREQ operand  */
-#line 972 "bison_parser.y"
+  case 233: /* comp_expr: operand GREATEREQ operand  */
+#line 1098 "bison_parser.y"
                             { (yyval.expr) = Expr::makeOpBinary((yyvsp[-2].expr), kOpGreaterEq, (yyvsp[0].expr)); }
-#line 4652 "bison_parser.cpp"
+#line 4951 "bison_parser.cpp"
     break;
 
-  case 217: /* function_expr: IDENTIFIER '(' ')'  */
-#line 974 "bison_parser.y"
+  case 234: /* function_expr: IDENTIFIER '(' ')'  */
+#line 1100 "bison_parser.y"
                                    { (yyval.expr) = Expr::makeFunctionRef((yyvsp[-2].sval), new std::vector<Expr*>(), false); }
-#line 4658 "bison_parser.cpp"
+#line 4957 "bison_parser.cpp"
     break;
 
-  case 218: /* function_expr: IDENTIFIER '(' opt_distinct expr_list ')'  */
-#line 975 "bison_parser.y"
+  case 235: /* function_expr: IDENTIFIER '(' opt_distinct expr_list ')'  */
+#line 1101 "bison_parser.y"
                                             { (yyval.expr) = Expr::makeFunctionRef((yyvsp[-4].sval), (yyvsp[-1].expr_vec), (yyvsp[-2].bval)); }
-#line 4664 "bison_parser.cpp"
+#line 4963 "bison_parser.cpp"
     break;
 
-  case 219: /* extract_expr: EXTRACT '(' datetime_field FROM expr ')'  */
-#line 977 "bison_parser.y"
+  case 236: /* extract_expr: EXTRACT '(' datetime_field FROM expr ')'  */
+#line 1103 "bison_parser.y"
                                                         { (yyval.expr) = Expr::makeExtract((yyvsp[-3].datetime_field), (yyvsp[-1].expr)); }
-#line 4670 "bison_parser.cpp"
+#line 4969 "bison_parser.cpp"
     break;
 
-  case 220: /* cast_expr: CAST '(' expr AS column_type ')'  */
-#line 979 "bison_parser.y"
+  case 237: /* cast_expr: CAST '(' expr AS column_type ')'  */
+#line 1105 "bison_parser.y"
                                              { (yyval.expr) = Expr::makeCast((yyvsp[-3].expr), (yyvsp[-1].column_type_t)); }
-#line 4676 "bison_parser.cpp"
+#line 4975 "bison_parser.cpp"
     break;
 
-  case 221: /* datetime_field: SECOND  */
-#line 981 "bison_parser.y"
+  case 238: /* datetime_field: SECOND  */
+#line 1107 "bison_parser.y"
                         { (yyval.datetime_field) = kDatetimeSecond; }
-#line 4682 "bison_parser.cpp"
+#line 4981 "bison_parser.cpp"
     break;
 
-  case 222: /* datetime_field: MINUTE  */
-#line 982 "bison_parser.y"
+  case 239: /* datetime_field: MINUTE  */
+#line 1108 "bison_parser.y"
          { (yyval.datetime_field) = kDatetimeMinute; }
-#line 4688 "bison_parser.cpp"
+#line 4987 "bison_parser.cpp"
     break;
 
-  case 223: /* datetime_field: HOUR  */
-#line 983 "bison_parser.y"
+  case 240: /* datetime_field: HOUR  */
+#line 1109 "bison_parser.y"
        { (yyval.datetime_field) = kDatetimeHour; }
-#line 4694 "bison_parser.cpp"
+#line 4993 "bison_parser.cpp"
     break;
 
-  case 224: /* datetime_field: DAY  */
-#line 984 "bison_parser.y"
+  case 241: /* datetime_field: DAY  */
+#line 1110 "bison_parser.y"
       { (yyval.datetime_field) = kDatetimeDay; }
-#line 4700 "bison_parser.cpp"
+#line 4999 "bison_parser.cpp"
     break;
 
-  case 225: /* datetime_field: MONTH  */
-#line 985 "bison_parser.y"
+  case 242: /* datetime_field: MONTH  */
+#line 1111 "bison_parser.y"
         { (yyval.datetime_field) = kDatetimeMonth; }
-#line 4706 "bison_parser.cpp"
+#line 5005 "bison_parser.cpp"
     break;
 
-  case 226: /* datetime_field: YEAR  */
-#line 986 "bison_parser.y"
+  case 243: /* datetime_field: YEAR  */
+#line 1112 "bison_parser.y"
        { (yyval.datetime_field) = kDatetimeYear; }
-#line 4712 "bison_parser.cpp"
+#line 5011 "bison_parser.cpp"
     break;
 
-  case 227: /* datetime_field_plural: SECONDS  */
-#line 988 "bison_parser.y"
+  case 244: /* datetime_field_plural: SECONDS  */
+#line 1114 "bison_parser.y"
                                 { (yyval.datetime_field) = kDatetimeSecond; }
-#line 4718 "bison_parser.cpp"
+#line 5017 "bison_parser.cpp"
     break;
 
-  case 228: /* datetime_field_plural: MINUTES  */
-#line 989 "bison_parser.y"
+  case 245: /* datetime_field_plural: MINUTES  */
+#line 1115 "bison_parser.y"
           { (yyval.datetime_field) = kDatetimeMinute; }
-#line 4724 "bison_parser.cpp"
+#line 5023 "bison_parser.cpp"
     break;
 
-  case 229: /* datetime_field_plural: HOURS  */
-#line 990 "bison_parser.y"
+  case 246: /* datetime_field_plural: HOURS  */
+#line 1116 "bison_parser.y"
         { (yyval.datetime_field) = kDatetimeHour; }
-#line 4730 "bison_parser.cpp"
+#line 5029 "bison_parser.cpp"
     break;
 
-  case 230: /* datetime_field_plural: DAYS  */
-#line 991 "bison_parser.y"
+  case 247: /* datetime_field_plural: DAYS  */
+#line 1117 "bison_parser.y"
        { (yyval.datetime_field) = kDatetimeDay; }
-#line 4736 "bison_parser.cpp"
+#line 5035 "bison_parser.cpp"
     break;
 
-  case 231: /* datetime_field_plural: MONTHS  */
-#line 992 "bison_parser.y"
+  case 248: /* datetime_field_plural: MONTHS  */
+#line 1118 "bison_parser.y"
          { (yyval.datetime_field) = kDatetimeMonth; }
-#line 4742 "bison_parser.cpp"
+#line 5041 "bison_parser.cpp"
     break;
 
-  case 232: /* datetime_field_plural: YEARS  */
-#line 993 "bison_parser.y"
+  case 249: /* datetime_field_plural: YEARS  */
+#line 1119 "bison_parser.y"
         { (yyval.datetime_field) = kDatetimeYear; }
-#line 4748 "bison_parser.cpp"
+#line 5047 "bison_parser.cpp"
     break;
 
-  case 235: /* array_expr: ARRAY '[' expr_list ']'  */
-#line 997 "bison_parser.y"
+  case 252: /* array_expr: ARRAY '[' expr_list ']'  */
+#line 1123 "bison_parser.y"
                                      { (yyval.expr) = Expr::makeArray((yyvsp[-1].expr_vec)); }
-#line 4754 "bison_parser.cpp"
+#line 5053 "bison_parser.cpp"
     break;
 
-  case 236: /* array_index: operand '[' int_literal ']'  */
-#line 999 "bison_parser.y"
+  case 253: /* array_index: operand '[' int_literal ']'  */
+#line 1125 "bison_parser.y"
                                           { (yyval.expr) = Expr::makeArrayIndex((yyvsp[-3].expr), (yyvsp[-1].expr)->ival); }
-#line 4760 "bison_parser.cpp"
+#line 5059 "bison_parser.cpp"
     break;
 
-  case 237: /* between_expr: operand BETWEEN operand AND operand  */
-#line 1001 "bison_parser.y"
+  case 254: /* between_expr: operand BETWEEN operand AND operand  */
+#line 1127 "bison_parser.y"
                                                    { (yyval.expr) = Expr::makeBetween((yyvsp[-4].expr), (yyvsp[-2].expr), (yyvsp[0].expr)); }
-#line 4766 "bison_parser.cpp"
+#line 5065 "bison_parser.cpp"
     break;
 
-  case 238: /* column_name: IDENTIFIER  */
-#line 1003 "bison_parser.y"
+  case 255: /* column_name: IDENTIFIER  */
+#line 1129 "bison_parser.y"
                          { (yyval.expr) = Expr::makeColumnRef((yyvsp[0].sval)); }
-#line 4772 "bison_parser.cpp"
+#line 5071 "bison_parser.cpp"
     break;
 
-  case 239: /* column_name: IDENTIFIER '.' IDENTIFIER  */
-#line 1004 "bison_parser.y"
+  case 256: /* column_name: IDENTIFIER '.' IDENTIFIER  */
+#line 1130 "bison_parser.y"
                             { (yyval.expr) = Expr::makeColumnRef((yyvsp[-2].sval), (yyvsp[0].sval)); }
-#line 4778 "bison_parser.cpp"
+#line 5077 "bison_parser.cpp"
     break;
 
-  case 240: /* column_name: '*'  */
-#line 1005 "bison_parser.y"
+  case 257: /* column_name: '*'  */
+#line 1131 "bison_parser.y"
       { (yyval.expr) = Expr::makeStar(); }
-#line 4784 "bison_parser.cpp"
+#line 5083 "bison_parser.cpp"
     break;
 
-  case 241: /* column_name: IDENTIFIER '.' '*'  */
-#line 1006 "bison_parser.y"
+  case 258: /* column_name: IDENTIFIER '.' '*'  */
+#line 1132 "bison_parser.y"
                      { (yyval.expr) = Expr::makeStar((yyvsp[-2].sval)); }
-#line 4790 "bison_parser.cpp"
+#line 5089 "bison_parser.cpp"
     break;
 
-  case 249: /* string_literal: STRING  */
-#line 1010 "bison_parser.y"
+  case 266: /* string_literal: STRING  */
+#line 1136 "bison_parser.y"
                         { (yyval.expr) = Expr::makeLiteral((yyvsp[0].sval)); }
-#line 4796 "bison_parser.cpp"
+#line 5095 "bison_parser.cpp"
     break;
 
-  case 250: /* bool_literal: TRUE  */
-#line 1012 "bison_parser.y"
+  case 267: /* bool_literal: TRUE  */
+#line 1138 "bison_parser.y"
                     { (yyval.expr) = Expr::makeLiteral(true); }
-#line 4802 "bison_parser.cpp"
+#line 5101 "bison_parser.cpp"
     break;
 
-  case 251: /* bool_literal: FALSE  */
-#line 1013 "bison_parser.y"
+  case 268: /* bool_literal: FALSE  */
+#line 1139 "bison_parser.y"
         { (yyval.expr) = Expr::makeLiteral(false); }
-#line 4808 "bison_parser.cpp"
+#line 5107 "bison_parser.cpp"
     break;
 
-  case 252: /* num_literal: FLOATVAL  */
-#line 1015 "bison_parser.y"
+  case 269: /* num_literal: FLOATVAL  */
+#line 1141 "bison_parser.y"
                        { (yyval.expr) = Expr::makeLiteral((yyvsp[0].fval)); }
-#line 4814 "bison_parser.cpp"
+#line 5113 "bison_parser.cpp"
     break;
 
-  case 254: /* int_literal: INTVAL  */
-#line 1018 "bison_parser.y"
+  case 271: /* int_literal: INTVAL  */
+#line 1144 "bison_parser.y"
                      { (yyval.expr) = Expr::makeLiteral((yyvsp[0].ival)); }
-#line 4820 "bison_parser.cpp"
+#line 5119 "bison_parser.cpp"
     break;
 
-  case 255: /* null_literal: NULL  */
-#line 1020 "bison_parser.y"
+  case 272: /* null_literal: NULL  */
+#line 1146 "bison_parser.y"
                     { (yyval.expr) = Expr::makeNullLiteral(); }
-#line 4826 "bison_parser.cpp"
+#line 5125 "bison_parser.cpp"
     break;
 
-  case 256: /* date_literal: DATE STRING  */
-#line 1022 "bison_parser.y"
+  case 273: /* date_literal: DATE STRING  */
+#line 1148 "bison_parser.y"
                            {
   int day{0}, month{0}, year{0}, chars_parsed{0};
   // If the whole string is parsed, chars_parsed points to the terminating null byte after the last character
@@ -4837,20 +5136,20 @@ yyreduce:
   }
   (yyval.expr) = Expr::makeDateLiteral((yyvsp[0].sval));
 }
-#line 4841 "bison_parser.cpp"
+#line 5140 "bison_parser.cpp"
     break;
 
-  case 257: /* interval_literal: int_literal duration_field  */
-#line 1033 "bison_parser.y"
+  case 274: /* interval_literal: int_literal duration_field  */
+#line 1159 "bison_parser.y"
                                               {
   (yyval.expr) = Expr::makeIntervalLiteral((yyvsp[-1].expr)->ival, (yyvsp[0].datetime_field));
   delete (yyvsp[-1].expr);
 }
-#line 4850 "bison_parser.cpp"
+#line 5149 "bison_parser.cpp"
     break;
 
-  case 258: /* interval_literal: INTERVAL STRING datetime_field  */
-#line 1037 "bison_parser.y"
+  case 275: /* interval_literal: INTERVAL STRING datetime_field  */
+#line 1163 "bison_parser.y"
                                  {
   int duration{0}, chars_parsed{0};
   // If the whole string is parsed, chars_parsed points to the terminating null byte after the last character
@@ -4862,11 +5161,11 @@ yyreduce:
   free((yyvsp[-1].sval));
   (yyval.expr) = Expr::makeIntervalLiteral(duration, (yyvsp[0].datetime_field));
 }
-#line 4866 "bison_parser.cpp"
+#line 5165 "bison_parser.cpp"
     break;
 
-  case 259: /* interval_literal: INTERVAL STRING  */
-#line 1048 "bison_parser.y"
+  case 276: /* interval_literal: INTERVAL STRING  */
+#line 1174 "bison_parser.y"
                   {
   int duration{0}, chars_parsed{0};
   // 'seconds' and 'minutes' are the longest accepted interval qualifiers (7 chars) + null byte
@@ -4898,61 +5197,61 @@ yyreduce:
   }
   (yyval.expr) = Expr::makeIntervalLiteral(duration, unit);
 }
-#line 4902 "bison_parser.cpp"
+#line 5201 "bison_parser.cpp"
     break;
 
-  case 260: /* param_expr: '?'  */
-#line 1080 "bison_parser.y"
+  case 277: /* param_expr: '?'  */
+#line 1206 "bison_parser.y"
                  {
   (yyval.expr) = Expr::makeParameter(yylloc.total_column);
   (yyval.expr)->ival2 = yyloc.param_list.size();
   yyloc.param_list.push_back((yyval.expr));
 }
-#line 4912 "bison_parser.cpp"
+#line 5211 "bison_parser.cpp"
     break;
 
-  case 262: /* table_ref: table_ref_commalist ',' table_ref_atomic  */
-#line 1089 "bison_parser.y"
+  case 279: /* table_ref: table_ref_commalist ',' table_ref_atomic  */
+#line 1215 "bison_parser.y"
                                                                         {
   (yyvsp[-2].table_vec)->push_back((yyvsp[0].table));
   auto tbl = new TableRef(kTableCrossProduct);
   tbl->list = (yyvsp[-2].table_vec);
   (yyval.table) = tbl;
 }
-#line 4923 "bison_parser.cpp"
+#line 5222 "bison_parser.cpp"
     break;
 
-  case 266: /* nonjoin_table_ref_atomic: '(' select_statement ')' opt_table_alias  */
-#line 1098 "bison_parser.y"
+  case 283: /* nonjoin_table_ref_atomic: '(' select_statement ')' opt_table_alias  */
+#line 1224 "bison_parser.y"
                                                                                      {
   auto tbl = new TableRef(kTableSelect);
   tbl->select = (yyvsp[-2].select_stmt);
   tbl->alias = (yyvsp[0].alias_t);
   (yyval.table) = tbl;
 }
-#line 4934 "bison_parser.cpp"
+#line 5233 "bison_parser.cpp"
     break;
 
-  case 267: /* table_ref_commalist: table_ref_atomic  */
-#line 1105 "bison_parser.y"
+  case 284: /* table_ref_commalist: table_ref_atomic  */
+#line 1231 "bison_parser.y"
                                        {
   (yyval.table_vec) = new std::vector<TableRef*>();
   (yyval.table_vec)->push_back((yyvsp[0].table));
 }
-#line 4943 "bison_parser.cpp"
+#line 5242 "bison_parser.cpp"
     break;
 
-  case 268: /* table_ref_commalist: table_ref_commalist ',' table_ref_atomic  */
-#line 1109 "bison_parser.y"
+  case 285: /* table_ref_commalist: table_ref_commalist ',' table_ref_atomic  */
+#line 1235 "bison_parser.y"
                                            {
   (yyvsp[-2].table_vec)->push_back((yyvsp[0].table));
   (yyval.table_vec) = (yyvsp[-2].table_vec);
 }
-#line 4952 "bison_parser.cpp"
+#line 5251 "bison_parser.cpp"
     break;
 
-  case 269: /* table_ref_name: table_name opt_table_alias  */
-#line 1114 "bison_parser.y"
+  case 286: /* table_ref_name: table_name opt_table_alias  */
+#line 1240 "bison_parser.y"
                                             {
   auto tbl = new TableRef(kTableName);
   tbl->schema = (yyvsp[-1].table_name).schema;
@@ -4960,215 +5259,233 @@ yyreduce:
   tbl->alias = (yyvsp[0].alias_t);
   (yyval.table) = tbl;
 }
-#line 4964 "bison_parser.cpp"
+#line 5263 "bison_parser.cpp"
     break;
 
-  case 270: /* table_ref_name_no_alias: table_name  */
-#line 1122 "bison_parser.y"
+  case 287: /* table_ref_name_no_alias: table_name  */
+#line 1248 "bison_parser.y"
                                      {
   (yyval.table) = new TableRef(kTableName);
   (yyval.table)->schema = (yyvsp[0].table_name).schema;
   (yyval.table)->name = (yyvsp[0].table_name).name;
 }
-#line 4974 "bison_parser.cpp"
+#line 5273 "bison_parser.cpp"
     break;
 
-  case 271: /* table_name: IDENTIFIER  */
-#line 1128 "bison_parser.y"
+  case 288: /* table_name: IDENTIFIER  */
+#line 1254 "bison_parser.y"
                         {
   (yyval.table_name).schema = nullptr;
   (yyval.table_name).name = (yyvsp[0].sval);
 }
-#line 4983 "bison_parser.cpp"
+#line 5282 "bison_parser.cpp"
     break;
 
-  case 272: /* table_name: IDENTIFIER '.' IDENTIFIER  */
-#line 1132 "bison_parser.y"
+  case 289: /* table_name: IDENTIFIER '.' IDENTIFIER  */
+#line 1258 "bison_parser.y"
                             {
   (yyval.table_name).schema = (yyvsp[-2].sval);
   (yyval.table_name).name = (yyvsp[0].sval);
 }
-#line 4992 "bison_parser.cpp"
+#line 5291 "bison_parser.cpp"
     break;
 
-  case 273: /* opt_index_name: IDENTIFIER  */
-#line 1137 "bison_parser.y"
+  case 290: /* opt_index_name: IDENTIFIER  */
+#line 1263 "bison_parser.y"
                             { (yyval.sval) = (yyvsp[0].sval); }
-#line 4998 "bison_parser.cpp"
+#line 5297 "bison_parser.cpp"
     break;
 
-  case 274: /* opt_index_name: %empty  */
-#line 1138 "bison_parser.y"
+  case 291: /* opt_index_name: %empty  */
+#line 1264 "bison_parser.y"
+              { (yyval.sval) = nullptr; }
+#line 5303 "bison_parser.cpp"
+    break;
+
+  case 292: /* opt_index_method: USING IDENTIFIER  */
+#line 1266 "bison_parser.y"
+                                    { (yyval.sval) = (yyvsp[0].sval); }
+#line 5309 "bison_parser.cpp"
+    break;
+
+  case 293: /* opt_index_method: USING HASH  */
+#line 1267 "bison_parser.y"
+             { (yyval.sval) = strdup("hash"); }
+#line 5315 "bison_parser.cpp"
+    break;
+
+  case 294: /* opt_index_method: %empty  */
+#line 1268 "bison_parser.y"
               { (yyval.sval) = nullptr; }
-#line 5004 "bison_parser.cpp"
+#line 5321 "bison_parser.cpp"
     break;
 
-  case 276: /* table_alias: AS IDENTIFIER '(' ident_commalist ')'  */
-#line 1140 "bison_parser.y"
+  case 296: /* table_alias: AS IDENTIFIER '(' ident_commalist ')'  */
+#line 1270 "bison_parser.y"
                                                             { (yyval.alias_t) = new Alias((yyvsp[-3].sval), (yyvsp[-1].str_vec)); }
-#line 5010 "bison_parser.cpp"
+#line 5327 "bison_parser.cpp"
     break;
 
-  case 278: /* opt_table_alias: %empty  */
-#line 1142 "bison_parser.y"
+  case 298: /* opt_table_alias: %empty  */
+#line 1272 "bison_parser.y"
                                             { (yyval.alias_t) = nullptr; }
-#line 5016 "bison_parser.cpp"
+#line 5333 "bison_parser.cpp"
     break;
 
-  case 279: /* alias: AS IDENTIFIER  */
-#line 1144 "bison_parser.y"
+  case 299: /* alias: AS IDENTIFIER  */
+#line 1274 "bison_parser.y"
                       { (yyval.alias_t) = new Alias((yyvsp[0].sval)); }
-#line 5022 "bison_parser.cpp"
+#line 5339 "bison_parser.cpp"
     break;
 
-  case 280: /* alias: IDENTIFIER  */
-#line 1145 "bison_parser.y"
+  case 300: /* alias: IDENTIFIER  */
+#line 1275 "bison_parser.y"
              { (yyval.alias_t) = new Alias((yyvsp[0].sval)); }
-#line 5028 "bison_parser.cpp"
+#line 5345 "bison_parser.cpp"
     break;
 
-  case 282: /* opt_alias: %empty  */
-#line 1147 "bison_parser.y"
+  case 302: /* opt_alias: %empty  */
+#line 1277 "bison_parser.y"
                                 { (yyval.alias_t) = nullptr; }
-#line 5034 "bison_parser.cpp"
+#line 5351 "bison_parser.cpp"
     break;
 
-  case 283: /* opt_locking_clause: opt_locking_clause_list  */
-#line 1153 "bison_parser.y"
+  case 303: /* opt_locking_clause: opt_locking_clause_list  */
+#line 1283 "bison_parser.y"
                                              { (yyval.locking_clause_vec) = (yyvsp[0].locking_clause_vec); }
-#line 5040 "bison_parser.cpp"
+#line 5357 "bison_parser.cpp"
     break;
 
-  case 284: /* opt_locking_clause: %empty  */
-#line 1154 "bison_parser.y"
+  case 304: /* opt_locking_clause: %empty  */
+#line 1284 "bison_parser.y"
               { (yyval.locking_clause_vec) = nullptr; }
-#line 5046 "bison_parser.cpp"
+#line 5363 "bison_parser.cpp"
     break;
 
-  case 285: /* opt_locking_clause_list: locking_clause  */
-#line 1156 "bison_parser.y"
+  case 305: /* opt_locking_clause_list: locking_clause  */
+#line 1286 "bison_parser.y"
                                          {
   (yyval.locking_clause_vec) = new std::vector<LockingClause*>();
   (yyval.locking_clause_vec)->push_back((yyvsp[0].locking_t));
 }
-#line 5055 "bison_parser.cpp"
+#line 5372 "bison_parser.cpp"
     break;
 
-  case 286: /* opt_locking_clause_list: opt_locking_clause_list locking_clause  */
-#line 1160 "bison_parser.y"
+  case 306: /* opt_locking_clause_list: opt_locking_clause_list locking_clause  */
+#line 1290 "bison_parser.y"
                                          {
   (yyvsp[-1].locking_clause_vec)->push_back((yyvsp[0].locking_t));
   (yyval.locking_clause_vec) = (yyvsp[-1].locking_clause_vec);
 }
-#line 5064 "bison_parser.cpp"
+#line 5381 "bison_parser.cpp"
     break;
 
-  case 287: /* locking_clause: FOR row_lock_mode opt_row_lock_policy  */
-#line 1165 "bison_parser.y"
+  case 307: /* locking_clause: FOR row_lock_mode opt_row_lock_policy  */
+#line 1295 "bison_parser.y"
                                                        {
   (yyval.locking_t) = new LockingClause();
   (yyval.locking_t)->rowLockMode = (yyvsp[-1].lock_mode_t);
   (yyval.locking_t)->rowLockWaitPolicy = (yyvsp[0].lock_wait_policy_t);
   (yyval.locking_t)->tables = nullptr;
 }
-#line 5075 "bison_parser.cpp"
+#line 5392 "bison_parser.cpp"
     break;
 
-  case 288: /* locking_clause: FOR row_lock_mode OF ident_commalist opt_row_lock_policy  */
-#line 1171 "bison_parser.y"
+  case 308: /* locking_clause: FOR row_lock_mode OF ident_commalist opt_row_lock_policy  */
+#line 1301 "bison_parser.y"
                                                            {
   (yyval.locking_t) = new LockingClause();
   (yyval.locking_t)->rowLockMode = (yyvsp[-3].lock_mode_t);
   (yyval.locking_t)->tables = (yyvsp[-1].str_vec);
   (yyval.locking_t)->rowLockWaitPolicy = (yyvsp[0].lock_wait_policy_t);
 }
-#line 5086 "bison_parser.cpp"
+#line 5403 "bison_parser.cpp"
     break;
 
-  case 289: /* row_lock_mode: UPDATE  */
-#line 1178 "bison_parser.y"
+  case 309: /* row_lock_mode: UPDATE  */
+#line 1308 "bison_parser.y"
                        { (yyval.lock_mode_t) = RowLockMode::ForUpdate; }
-#line 5092 "bison_parser.cpp"
+#line 5409 "bison_parser.cpp"
     break;
 
-  case 290: /* row_lock_mode: NO KEY UPDATE  */
-#line 1179 "bison_parser.y"
+  case 310: /* row_lock_mode: NO KEY UPDATE  */
+#line 1309 "bison_parser.y"
                 { (yyval.lock_mode_t) = RowLockMode::ForNoKeyUpdate; }
-#line 5098 "bison_parser.cpp"
+#line 5415 "bison_parser.cpp"
     break;
 
-  case 291: /* row_lock_mode: SHARE  */
-#line 1180 "bison_parser.y"
+  case 311: /* row_lock_mode: SHARE  */
+#line 1310 "bison_parser.y"
         { (yyval.lock_mode_t) = RowLockMode::ForShare; }
-#line 5104 "bison_parser.cpp"
+#line 5421 "bison_parser.cpp"
     break;
 
-  case 292: /* row_lock_mode: KEY SHARE  */
-#line 1181 "bison_parser.y"
+  case 312: /* row_lock_mode: KEY SHARE  */
+#line 1311 "bison_parser.y"
             { (yyval.lock_mode_t) = RowLockMode::ForKeyShare; }
-#line 5110 "bison_parser.cpp"
+#line 5427 "bison_parser.cpp"
     break;
 
-  case 293: /* opt_row_lock_policy: SKIP LOCKED  */
-#line 1183 "bison_parser.y"
+  case 313: /* opt_row_lock_policy: SKIP LOCKED  */
+#line 1313 "bison_parser.y"
                                   { (yyval.lock_wait_policy_t) = RowLockWaitPolicy::SkipLocked; }
-#line 5116 "bison_parser.cpp"
+#line 5433 "bison_parser.cpp"
     break;
 
-  case 294: /* opt_row_lock_policy: NOWAIT  */
-#line 1184 "bison_parser.y"
+  case 314: /* opt_row_lock_policy: NOWAIT  */
+#line 1314 "bison_parser.y"
          { (yyval.lock_wait_policy_t) = RowLockWaitPolicy::NoWait; }
-#line 5122 "bison_parser.cpp"
+#line 5439 "bison_parser.cpp"
     break;
 
-  case 295: /* opt_row_lock_policy: %empty  */
-#line 1185 "bison_parser.y"
+  case 315: /* opt_row_lock_policy: %empty  */
+#line 1315 "bison_parser.y"
               { (yyval.lock_wait_policy_t) = RowLockWaitPolicy::None; }
-#line 5128 "bison_parser.cpp"
+#line 5445 "bison_parser.cpp"
     break;
 
-  case 297: /* opt_with_clause: %empty  */
-#line 1191 "bison_parser.y"
+  case 317: /* opt_with_clause: %empty  */
+#line 1321 "bison_parser.y"
                                             { (yyval.with_description_vec) = nullptr; }
-#line 5134 "bison_parser.cpp"
+#line 5451 "bison_parser.cpp"
     break;
 
-  case 298: /* with_clause: WITH with_description_list  */
-#line 1193 "bison_parser.y"
+  case 318: /* with_clause: WITH with_description_list  */
+#line 1323 "bison_parser.y"
                                          { (yyval.with_description_vec) = (yyvsp[0].with_description_vec); }
-#line 5140 "bison_parser.cpp"
+#line 5457 "bison_parser.cpp"
     break;
 
-  case 299: /* with_description_list: with_description  */
-#line 1195 "bison_parser.y"
+  case 319: /* with_description_list: with_description  */
+#line 1325 "bison_parser.y"
                                          {
   (yyval.with_description_vec) = new std::vector<WithDescription*>();
   (yyval.with_description_vec)->push_back((yyvsp[0].with_description_t));
 }
-#line 5149 "bison_parser.cpp"
+#line 5466 "bison_parser.cpp"
     break;
 
-  case 300: /* with_description_list: with_description_list ',' with_description  */
-#line 1199 "bison_parser.y"
+  case 320: /* with_description_list: with_description_list ',' with_description  */
+#line 1329 "bison_parser.y"
                                              {
   (yyvsp[-2].with_description_vec)->push_back((yyvsp[0].with_description_t));
   (yyval.with_description_vec) = (yyvsp[-2].with_description_vec);
 }
-#line 5158 "bison_parser.cpp"
+#line 5475 "bison_parser.cpp"
     break;
 
-  case 301: /* with_description: IDENTIFIER AS select_with_paren  */
-#line 1204 "bison_parser.y"
+  case 321: /* with_description: IDENTIFIER AS select_with_paren  */
+#line 1334 "bison_parser.y"
                                                    {
   (yyval.with_description_t) = new WithDescription();
   (yyval.with_description_t)->alias = (yyvsp[-2].sval);
   (yyval.with_description_t)->select = (yyvsp[0].select_stmt);
 }
-#line 5168 "bison_parser.cpp"
+#line 5485 "bison_parser.cpp"
     break;
 
-  case 302: /* join_clause: table_ref_atomic NATURAL JOIN nonjoin_table_ref_atomic  */
-#line 1214 "bison_parser.y"
+  case 322: /* join_clause: table_ref_atomic NATURAL JOIN nonjoin_table_ref_atomic  */
+#line 1344 "bison_parser.y"
                                                                      {
   (yyval.table) = new TableRef(kTableJoin);
   (yyval.table)->join = new JoinDefinition();
@@ -5176,11 +5493,11 @@ yyreduce:
   (yyval.table)->join->left = (yyvsp[-3].table);
   (yyval.table)->join->right = (yyvsp[0].table);
 }
-#line 5180 "bison_parser.cpp"
+#line 5497 "bison_parser.cpp"
     break;
 
-  case 303: /* join_clause: table_ref_atomic opt_join_type JOIN table_ref_atomic ON join_condition  */
-#line 1221 "bison_parser.y"
+  case 323: /* join_clause: table_ref_atomic opt_join_type JOIN table_ref_atomic ON join_condition  */
+#line 1351 "bison_parser.y"
                                                                          {
   (yyval.table) = new TableRef(kTableJoin);
   (yyval.table)->join = new JoinDefinition();
@@ -5189,11 +5506,11 @@ yyreduce:
   (yyval.table)->join->right = (yyvsp[-2].table);
   (yyval.table)->join->condition = (yyvsp[0].expr);
 }
-#line 5193 "bison_parser.cpp"
+#line 5510 "bison_parser.cpp"
     break;
 
-  case 304: /* join_clause: table_ref_atomic opt_join_type JOIN table_ref_atomic USING '(' column_name ')'  */
-#line 1229 "bison_parser.y"
+  case 324: /* join_clause: table_ref_atomic opt_join_type JOIN table_ref_atomic USING '(' column_name ')'  */
+#line 1359 "bison_parser.y"
                                                                                  {
   (yyval.table) = new TableRef(kTableJoin);
   (yyval.table)->join = new JoinDefinition();
@@ -5209,89 +5526,89 @@ yyreduce:
   (yyval.table)->join->condition = Expr::makeOpBinary(left_col, kOpEquals, right_col);
   delete (yyvsp[-1].expr);
 }
-#line 5213 "bison_parser.cpp"
+#line 5530 "bison_parser.cpp"
     break;
 
-  case 305: /* opt_join_type: INNER  */
-#line 1245 "bison_parser.y"
+  case 325: /* opt_join_type: INNER  */
+#line 1375 "bison_parser.y"
                       { (yyval.join_type) = kJoinInner; }
-#line 5219 "bison_parser.cpp"
+#line 5536 "bison_parser.cpp"
     break;
 
-  case 306: /* opt_join_type: LEFT OUTER  */
-#line 1246 "bison_parser.y"
+  case 326: /* opt_join_type: LEFT OUTER  */
+#line 1376 "bison_parser.y"
              { (yyval.join_type) = kJoinLeft; }
-#line 5225 "bison_parser.cpp"
+#line 5542 "bison_parser.cpp"
     break;
 
-  case 307: /* opt_join_type: LEFT  */
-#line 1247 "bison_parser.y"
+  case 327: /* opt_join_type: LEFT  */
+#line 1377 "bison_parser.y"
        { (yyval.join_type) = kJoinLeft; }
-#line 5231 "bison_parser.cpp"
+#line 5548 "bison_parser.cpp"
     break;
 
-  case 308: /* opt_join_type: RIGHT OUTER  */
-#line 1248 "bison_parser.y"
+  case 328: /* opt_join_type: RIGHT OUTER  */
+#line 1378 "bison_parser.y"
               { (yyval.join_type) = kJoinRight; }
-#line 5237 "bison_parser.cpp"
+#line 5554 "bison_parser.cpp"
     break;
 
-  case 309: /* opt_join_type: RIGHT  */
-#line 1249 "bison_parser.y"
+  case 329: /* opt_join_type: RIGHT  */
+#line 1379 "bison_parser.y"
         { (yyval.join_type) = kJoinRight; }
-#line 5243 "bison_parser.cpp"
+#line 5560 "bison_parser.cpp"
     break;
 
-  case 310: /* opt_join_type: FULL OUTER  */
-#line 1250 "bison_parser.y"
+  case 330: /* opt_join_type: FULL OUTER  */
+#line 1380 "bison_parser.y"
              { (yyval.join_type) = kJoinFull; }
-#line 5249 "bison_parser.cpp"
+#line 5566 "bison_parser.cpp"
     break;
 
-  case 311: /* opt_join_type: OUTER  */
-#line 1251 "bison_parser.y"
+  case 331: /* opt_join_type: OUTER  */
+#line 1381 "bison_parser.y"
         { (yyval.join_type) = kJoinFull; }
-#line 5255 "bison_parser.cpp"
+#line 5572 "bison_parser.cpp"
     break;
 
-  case 312: /* opt_join_type: FULL  */
-#line 1252 "bison_parser.y"
+  case 332: /* opt_join_type: FULL  */
+#line 1382 "bison_parser.y"
        { (yyval.join_type) = kJoinFull; }
-#line 5261 "bison_parser.cpp"
+#line 5578 "bison_parser.cpp"
     break;
 
-  case 313: /* opt_join_type: CROSS  */
-#line 1253 "bison_parser.y"
+  case 333: /* opt_join_type: CROSS  */
+#line 1383 "bison_parser.y"
         { (yyval.join_type) = kJoinCross; }
-#line 5267 "bison_parser.cpp"
+#line 5584 "bison_parser.cpp"
     break;
 
-  case 314: /* opt_join_type: %empty  */
-#line 1254 "bison_parser.y"
+  case 334: /* opt_join_type: %empty  */
+#line 1384 "bison_parser.y"
                        { (yyval.join_type) = kJoinInner; }
-#line 5273 "bison_parser.cpp"
+#line 5590 "bison_parser.cpp"
     break;
 
-  case 318: /* ident_commalist: IDENTIFIER  */
-#line 1265 "bison_parser.y"
+  case 338: /* ident_commalist: IDENTIFIER  */
+#line 1395 "bison_parser.y"
                              {
   (yyval.str_vec) = new std::vector<char*>();
   (yyval.str_vec)->push_back((yyvsp[0].sval));
 }
-#line 5282 "bison_parser.cpp"
+#line 5599 "bison_parser.cpp"
     break;
 
-  case 319: /* ident_commalist: ident_commalist ',' IDENTIFIER  */
-#line 1269 "bison_parser.y"
+  case 339: /* ident_commalist: ident_commalist ',' IDENTIFIER  */
+#line 1399 "bison_parser.y"
                                  {
   (yyvsp[-2].str_vec)->push_back((yyvsp[0].sval));
   (yyval.str_vec) = (yyvsp[-2].str_vec);
 }
-#line 5291 "bison_parser.cpp"
+#line 5608 "bison_parser.cpp"
     break;
 
 
-#line 5295 "bison_parser.cpp"
+#line 5612 "bison_parser.cpp"
 
       default: break;
     }
@@ -5520,7 +5837,7 @@ yyreturnlab:
   return yyresult;
 }
 
-#line 1275 "bison_parser.y"
+#line 1405 "bison_parser.y"
 
     // clang-format on
     /*********************************
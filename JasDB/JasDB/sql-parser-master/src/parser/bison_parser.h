@@ -305,6 +305,7 @@ union HSQL_STYPE
   hsql::SetOperation* set_operator_t;
   hsql::TableConstraint* table_constraint_t;
   hsql::TableElement* table_element_t;
+  hsql::TableOption* table_option_t;
   hsql::TableName table_name;
   hsql::TableRef* table;
   hsql::UpdateClause* update_t;
@@ -314,9 +315,11 @@ union HSQL_STYPE
   std::vector<char*>* str_vec;
   std::unordered_set<hsql::ConstraintType>* column_constraint_set;
   std::vector<hsql::Expr*>* expr_vec;
+  std::vector<std::vector<hsql::Expr*>*>* expr_vec_list;
   std::vector<hsql::OrderDescription*>* order_vec;
   std::vector<hsql::SQLStatement*>* stmt_vec;
   std::vector<hsql::TableElement*>* table_element_vec;
+  std::vector<hsql::TableOption*>* table_option_vec;
   std::vector<hsql::TableRef*>* table_vec;
   std::vector<hsql::UpdateClause*>* update_vec;
   std::vector<hsql::WithDescription*>* with_description_vec;
@@ -327,7 +330,7 @@ union HSQL_STYPE
   hsql::RowLockMode lock_mode_t;
   hsql::RowLockWaitPolicy lock_wait_policy_t;
 
-#line 331 "bison_parser.h"
+#line 334 "bison_parser.h"
 
 };
 typedef union HSQL_STYPE HSQL_STYPE;
@@ -136,6 +136,7 @@
   hsql::SetOperation* set_operator_t;
   hsql::TableConstraint* table_constraint_t;
   hsql::TableElement* table_element_t;
+  hsql::TableOption* table_option_t;
   hsql::TableName table_name;
   hsql::TableRef* table;
   hsql::UpdateClause* update_t;
@@ -145,9 +146,11 @@
   std::vector<char*>* str_vec;
   std::unordered_set<hsql::ConstraintType>* column_constraint_set;
   std::vector<hsql::Expr*>* expr_vec;
+  std::vector<std::vector<hsql::Expr*>*>* expr_vec_list;
   std::vector<hsql::OrderDescription*>* order_vec;
   std::vector<hsql::SQLStatement*>* stmt_vec;
   std::vector<hsql::TableElement*>* table_element_vec;
+  std::vector<hsql::TableOption*>* table_option_vec;
   std::vector<hsql::TableRef*>* table_vec;
   std::vector<hsql::UpdateClause*>* update_vec;
   std::vector<hsql::WithDescription*>* with_description_vec;
@@ -181,7 +184,18 @@
         }
       }
       delete ($$);
-    } <table_vec> <table_element_vec> <update_vec> <expr_vec> <order_vec> <stmt_vec>
+    } <table_vec> <table_element_vec> <table_option_vec> <update_vec> <expr_vec> <order_vec> <stmt_vec>
+    %destructor {
+      if (($$) != nullptr) {
+        for (auto row : *($$)) {
+          for (auto ptr : *row) {
+            delete ptr;
+          }
+          delete row;
+        }
+      }
+      delete ($$);
+    } <expr_vec_list>
     %destructor { delete ($$); } <*>
 
 
@@ -217,14 +231,14 @@
      ** Non-Terminal types (http://www.gnu.org/software/bison/manual/html_node/Type-Decl.html)
      *********************************/
     %type <stmt_vec>               statement_list
-    %type <statement>              statement preparable_statement
+    %type <statement>              statement preparable_statement create_table_statement
     %type <exec_stmt>              execute_statement
     %type <transaction_stmt>       transaction_statement
     %type <prep_stmt>              prepare_statement
     %type <select_stmt>            select_statement select_with_paren select_no_paren select_clause select_within_set_operation select_within_set_operation_no_parentheses
     %type <import_stmt>            import_statement
     %type <export_stmt>            export_statement
-    %type <create_stmt>            create_statement
+    %type <create_stmt>            create_statement index_head create_table_columns
     %type <insert_stmt>            insert_statement
     %type <delete_stmt>            delete_statement truncate_statement
     %type <update_stmt>            update_statement
@@ -232,7 +246,7 @@
     %type <alter_stmt>             alter_statement
     %type <show_stmt>              show_statement
     %type <table_name>             table_name
-    %type <sval>                   opt_index_name
+    %type <sval>                   opt_index_name opt_index_method
     %type <sval>                   file_path prepare_target_query
     %type <bval>                   opt_not_exists opt_exists opt_distinct opt_all
     %type <ival_pair>              opt_decimal_specification
@@ -270,13 +284,17 @@
     // ImportType is used for compatibility reasons
     %type <import_type_t>          opt_file_type file_type
 
-    %type <str_vec>                ident_commalist opt_column_list
+    %type <str_vec>                ident_commalist opt_column_list opt_index_include
     %type <expr_vec>               expr_list select_list opt_literal_list literal_list hint_list opt_hints
+    %type <expr_vec_list>          values_list
     %type <table_vec>              table_ref_commalist
     %type <order_vec>              opt_order order_list
     %type <with_description_vec>   opt_with_clause with_clause with_description_list
     %type <update_vec>             update_clause_commalist
     %type <table_element_vec>      table_elem_commalist
+    %type <table_option_vec>       table_option_commalist
+    %type <table_option_t>         table_option
+    %type <sval>                   table_option_value
     %type <locking_clause_vec>     opt_locking_clause_list opt_locking_clause
 
     /******************************
@@ -349,6 +367,7 @@ statement : prepare_statement opt_hints {
   $$ = $1;
   $$->hints = $2;
 }
+| create_table_statement { $$ = $1; }
 | show_statement { $$ = $1; }
 | import_statement { $$ = $1; }
 | export_statement { $$ = $1; };
@@ -509,18 +528,6 @@ create_statement : CREATE TABLE opt_not_exists table_name FROM IDENTIFIER FILE f
   free($6);
   $$->filePath = $8;
 }
-| CREATE TABLE opt_not_exists table_name '(' table_elem_commalist ')' {
-  $$ = new CreateStatement(kCreateTable);
-  $$->ifNotExists = $3;
-  $$->schema = $4.schema;
-  $$->tableName = $4.name;
-  $$->setColumnDefsAndConstraints($6);
-  delete $6;
-  if (result->errorMsg()) {
-    delete $$;
-    YYERROR;
-  }
-}
 | CREATE TABLE opt_not_exists table_name AS select_statement {
   $$ = new CreateStatement(kCreateTable);
   $$->ifNotExists = $3;
@@ -528,12 +535,22 @@ create_statement : CREATE TABLE opt_not_exists table_name FROM IDENTIFIER FILE f
   $$->tableName = $4.name;
   $$->select = $6;
 }
-| CREATE INDEX opt_not_exists opt_index_name ON table_name '(' ident_commalist ')' {
-  $$ = new CreateStatement(kCreateIndex);
-  $$->indexName = $4;
-  $$->ifNotExists = $3;
-  $$->tableName = $6.name;
+| CREATE INDEX index_head ON table_name opt_index_method '(' ident_commalist ')' opt_index_method opt_index_include {
+  $$ = $3;
+  $$->schema = $5.schema;
+  $$->tableName = $5.name;
+  $$->indexMethod = $6;
   $$->indexColumns = $8;
+  $$->indexInclude = $11;
+  if ($10 != nullptr) {
+    if ($6 != nullptr) {
+      free($10);
+      delete $$;
+      yyerror(&yyloc, result, scanner, "Index method is specified twice.");
+      YYERROR;
+    }
+    $$->indexMethod = $10;
+  }
 }
 | CREATE VIEW opt_not_exists table_name opt_column_list AS select_statement {
   $$ = new CreateStatement(kCreateView);
@@ -544,6 +561,91 @@ create_statement : CREATE TABLE opt_not_exists table_name FROM IDENTIFIER FILE f
   $$->select = $7;
 };
 
+/* Table options (WITH (...)) and hints (WITH HINT(...)) both start with WITH, so a CREATE TABLE with
+ * a column list reads its own WITH and the token after it decides. It is no preparable_statement,
+ * which would have to decide at WITH whether the statement ends. */
+create_table_statement : create_table_columns { $$ = $1; }
+| create_table_columns WITH HINT '(' hint_list ')' {
+  $$ = $1;
+  $$->hints = $5;
+}
+| create_table_columns WITH '(' table_option_commalist ')' opt_hints {
+  $1->tableOptions = $4;
+  $$ = $1;
+  $$->hints = $6;
+};
+
+create_table_columns : CREATE TABLE opt_not_exists table_name '(' table_elem_commalist ')' {
+  $$ = new CreateStatement(kCreateTable);
+  $$->ifNotExists = $3;
+  $$->schema = $4.schema;
+  $$->tableName = $4.name;
+  $$->setColumnDefsAndConstraints($6);
+  delete $6;
+  if (result->errorMsg()) {
+    delete $$;
+    YYERROR;
+  }
+};
+
+/* [CONCURRENTLY] [IF NOT EXISTS] [name] of CREATE INDEX, CONCURRENTLY is no keyword of the lexer */
+index_head : opt_index_name {
+  $$ = new CreateStatement(kCreateIndex);
+  // CREATE INDEX CONCURRENTLY ON ... has no name, CONCURRENTLY is read as one
+  if ($1 != nullptr && strcasecmp($1, "concurrently") == 0) {
+    free($1);
+    $$->concurrently = true;
+  } else {
+    $$->indexName = $1;
+  }
+}
+| IF NOT EXISTS opt_index_name {
+  $$ = new CreateStatement(kCreateIndex);
+  $$->ifNotExists = true;
+  $$->indexName = $4;
+}
+| IDENTIFIER IDENTIFIER {
+  if (strcasecmp($1, "concurrently") != 0) {
+    free($1);
+    free($2);
+    yyerror(&yyloc, result, scanner, "Expected CONCURRENTLY or ON.");
+    YYERROR;
+  }
+  free($1);
+  $$ = new CreateStatement(kCreateIndex);
+  $$->concurrently = true;
+  $$->indexName = $2;
+}
+| IDENTIFIER IF NOT EXISTS opt_index_name {
+  if (strcasecmp($1, "concurrently") != 0) {
+    free($1);
+    free($5);
+    yyerror(&yyloc, result, scanner, "Expected CONCURRENTLY or ON.");
+    YYERROR;
+  }
+  free($1);
+  $$ = new CreateStatement(kCreateIndex);
+  $$->concurrently = true;
+  $$->ifNotExists = true;
+  $$->indexName = $5;
+};
+
+/* INCLUDE (columns) of CREATE INDEX, INCLUDE is no keyword of the lexer either */
+opt_index_include : IDENTIFIER '(' ident_commalist ')' {
+  if (strcasecmp($1, "include") != 0) {
+    free($1);
+    for (char* column : *$3) {
+      free(column);
+    }
+    delete $3;
+    yyerror(&yyloc, result, scanner, "Expected INCLUDE.");
+    YYERROR;
+  }
+  free($1);
+  $$ = $3;
+}
+| /* empty */ { $$ = nullptr; };
+
 opt_not_exists : IF NOT EXISTS { $$ = true; }
 | /* empty */ { $$ = false; };
 
@@ -559,6 +661,20 @@ table_elem_commalist : table_elem {
 table_elem : column_def { $$ = $1; }
 | table_constraint { $$ = $1; };
 
+table_option_commalist : table_option {
+  $$ = new std::vector<TableOption*>();
+  $$->push_back($1);
+}
+| table_option_commalist ',' table_option {
+  $1->push_back($3);
+  $$ = $1;
+};
+
+table_option : IDENTIFIER '=' table_option_value { $$ = new TableOption($1, $3); };
+
+table_option_value : IDENTIFIER { $$ = $1; }
+| COLUMN { $$ = strdup("column"); };
+
 column_def : IDENTIFIER column_type opt_column_constraints {
   $$ = new ColumnDefinition($1, $2, $3);
   if (!$$->trySetNullableExplicit()) {
@@ -689,12 +805,13 @@ truncate_statement : TRUNCATE table_name {
  * INSERT INTO students VALUES ('Max', 1112233, 'Musterhausen', 2.3)
  * INSERT INTO employees SELECT * FROM stundents
  ******************************/
-insert_statement : INSERT INTO table_name opt_column_list VALUES '(' literal_list ')' {
+insert_statement : INSERT INTO table_name opt_column_list VALUES values_list {
   $$ = new InsertStatement(kInsertValues);
   $$->schema = $3.schema;
   $$->tableName = $3.name;
   $$->columns = $4;
-  $$->values = $7;
+  $$->valuesList = $6;
+  $$->values = $6->front();
 }
 | INSERT INTO table_name opt_column_list select_no_paren {
   $$ = new InsertStatement(kInsertSelect);
@@ -704,6 +821,15 @@ insert_statement : INSERT INTO table_name opt_column_list VALUES '(' literal_lis
   $$->select = $5;
 };
 
+values_list : '(' literal_list ')' {
+  $$ = new std::vector<std::vector<Expr*>*>();
+  $$->push_back($2);
+}
+| values_list ',' '(' literal_list ')' {
+  $1->push_back($4);
+  $$ = $1;
+};
+
 opt_column_list : '(' ident_commalist ')' { $$ = $2; }
 | /* empty */ { $$ = nullptr; };
 
@@ -1137,6 +1263,10 @@ table_name : IDENTIFIER {
 opt_index_name : IDENTIFIER { $$ = $1; }
 | /* empty */ { $$ = nullptr; };
 
+opt_index_method : USING IDENTIFIER { $$ = $2; }
+| USING HASH { $$ = strdup("hash"); }
+| /* empty */ { $$ = nullptr; };
+
 table_alias : alias | AS IDENTIFIER '(' ident_commalist ')' { $$ = new Alias($2, $4); };
 
 opt_table_alias : table_alias | /* empty */ { $$ = nullptr; };
@@ -4,17 +4,30 @@
 namespace hsql {
 
 // CreateStatemnet
+// TableOption
+TableOption::TableOption(char* name, char* value) : name(name), value(value) {}
+
+TableOption::~TableOption() {
+  free(name);
+  free(value);
+}
+
+// CreateStatement
 CreateStatement::CreateStatement(CreateType type)
     : SQLStatement(kStmtCreate),
       type(type),
       ifNotExists(false),
+      concurrently(false),
       filePath(nullptr),
       schema(nullptr),
       tableName(nullptr),
       indexName(nullptr),
+      indexMethod(nullptr),
       indexColumns(nullptr),
+      indexInclude(nullptr),
       columns(nullptr),
       tableConstraints(nullptr),
+      tableOptions(nullptr),
       viewColumns(nullptr),
       select(nullptr){};
 
@@ -23,6 +36,7 @@ CreateStatement::~CreateStatement() {
   free(schema);
   free(tableName);
   free(indexName);
+  free(indexMethod);
   delete select;
 
   if (columns != nullptr) {
@@ -39,6 +53,13 @@ CreateStatement::~CreateStatement() {
     delete tableConstraints;
   }
 
+  if (tableOptions != nullptr) {
+    for (TableOption* option : *tableOptions) {
+      delete option;
+    }
+    delete tableOptions;
+  }
+
   if (indexColumns != nullptr) {
     for (char* column : *indexColumns) {
       free(column);
@@ -46,6 +67,13 @@ CreateStatement::~CreateStatement() {
     delete indexColumns;
   }
 
+  if (indexInclude != nullptr) {
+    for (char* column : *indexInclude) {
+      free(column);
+    }
+    delete indexInclude;
+  }
+
   if (viewColumns != nullptr) {
     for (char* column : *viewColumns) {
       free(column);
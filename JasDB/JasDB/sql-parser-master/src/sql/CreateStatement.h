@@ -53,6 +53,16 @@ struct ColumnDefinition : TableElement {
   bool nullable;
 };
 
+// Represents a "name = value" option of CREATE TABLE ... WITH (...)
+// Example: "WITH (storage = column)"
+struct TableOption {
+  TableOption(char* name, char* value);
+  virtual ~TableOption();
+
+  char* name;
+  char* value;
+};
+
 enum CreateType {
   kCreateTable,
   kCreateTableFromTbl,  // Hyrise file format
@@ -70,13 +80,17 @@ struct CreateStatement : SQLStatement {
 
   CreateType type;
   bool ifNotExists;                                 // default: false
+  bool concurrently;                                // default: false, CREATE INDEX CONCURRENTLY
   char* filePath;                                   // default: nullptr
   char* schema;                                     // default: nullptr
   char* tableName;                                  // default: nullptr
   char* indexName;                                  // default: nullptr
+  char* indexMethod;                                // default: nullptr, e.g. "hash" of USING HASH
   std::vector<char*>* indexColumns;                 // default: nullptr
+  std::vector<char*>* indexInclude;                 // default: nullptr, columns of INCLUDE (...)
   std::vector<ColumnDefinition*>* columns;          // default: nullptr
   std::vector<TableConstraint*>* tableConstraints;  // default: nullptr
+  std::vector<TableOption*>* tableOptions;          // default: nullptr
   std::vector<char*>* viewColumns;
   SelectStatement* select;
 };
@@ -9,6 +9,7 @@ enum InsertType { kInsertValues, kInsertSelect };
 
 // Represents SQL Insert statements.
 // Example: "INSERT INTO students VALUES ('Max', 1112233, 'Musterhausen', 2.3)"
+// Example: "INSERT INTO students VALUES ('Max', 1112233), ('Anna', 1112234)"
 struct InsertStatement : SQLStatement {
   InsertStatement(InsertType type);
   ~InsertStatement() override;
@@ -17,7 +18,9 @@ struct InsertStatement : SQLStatement {
   char* schema;
   char* tableName;
   std::vector<char*>* columns;
+  // values is the first row of valuesList
   std::vector<Expr*>* values;
+  std::vector<std::vector<Expr*>*>* valuesList;
   SelectStatement* select;
 };
 
@@ -174,6 +174,7 @@ InsertStatement::InsertStatement(InsertType type)
       tableName(nullptr),
       columns(nullptr),
       values(nullptr),
+      valuesList(nullptr),
       select(nullptr) {}
 
 InsertStatement::~InsertStatement() {
@@ -194,6 +195,16 @@ InsertStatement::~InsertStatement() {
     }
     delete values;
   }
+
+  if (valuesList != nullptr) {
+    for (size_t i = 1; i < valuesList->size(); ++i) {
+      for (Expr* expr : *(*valuesList)[i]) {
+        delete expr;
+      }
+      delete (*valuesList)[i];
+    }
+    delete valuesList;
+  }
 }
 
 // ShowStatament
@@ -331,8 +331,16 @@ void printInsertStatementInfo(const InsertStatement* stmt, uintmax_t numIndent)
   switch (stmt->type) {
     case kInsertValues:
       inprint("Values", numIndent + 1);
-      for (Expr* expr : *stmt->values) {
-        printExpression(expr, numIndent + 2);
+      if (stmt->valuesList != nullptr) {
+        for (std::vector<Expr*>* row : *stmt->valuesList) {
+          for (Expr* expr : *row) {
+            printExpression(expr, numIndent + 2);
+          }
+        }
+      } else {
+        for (Expr* expr : *stmt->values) {
+          printExpression(expr, numIndent + 2);
+        }
       }
       break;
     case kInsertSelect:
@@ -33,11 +33,15 @@ CREATE TABLE teachers (name CHARACTER VARYING(30));
 CREATE TABLE students_2 AS SELECT * FROM students
 CREATE TABLE students_3 AS SELECT city, grade FROM students WHERE grade > 3.0
 CREATE TABLE students (date_of_birth DATE, matriculation_date DATETIME, graduation_date TIMESTAMP, graduated BOOLEAN);
+CREATE TABLE events (id INT, status CHAR(10)) WITH (storage = column);
+CREATE TABLE events (id INT, status CHAR(10)) WITH HINT(NO_CACHE);
+CREATE TABLE events (id INT, status CHAR(10)) WITH (storage = column) WITH HINT(NO_CACHE);
 # Multiple statements
 CREATE TABLE "table" FROM TBL FILE 'students.tbl'; SELECT * FROM "table";
 # INSERT
 INSERT INTO test_table VALUES (1, 2, 'test');
 INSERT INTO test_table (id, value, name) VALUES (1, 2, 'test');
+INSERT INTO test_table VALUES (1, 2, 'test'), (3, 4, 'test2');
 INSERT INTO test_table SELECT * FROM students;
 INSERT INTO some_schema.test_table SELECT * FROM another_schema.students;
 # DELETE
@@ -195,6 +195,51 @@ TEST(CreateAsSelectStatementTest) {
   ASSERT_STREQ(stmt->select->selectList->at(1)->getName(), "grade");
 }
 
+TEST(CreateStatementWithTableOptionsTest) {
+  SQLParserResult result;
+  SQLParser::parse("CREATE TABLE events (id INT, status CHAR(10)) WITH (storage = column, row_group = large);", &result);
+
+  ASSERT(result.isValid());
+  ASSERT_EQ(result.size(), 1);
+  ASSERT_EQ(result.getStatement(0)->type(), kStmtCreate);
+
+  const CreateStatement* stmt = (const CreateStatement*)result.getStatement(0);
+  ASSERT_EQ(stmt->type, kCreateTable);
+  ASSERT_STREQ(stmt->tableName, "events");
+  ASSERT_EQ(stmt->columns->size(), 2);
+  ASSERT_NOTNULL(stmt->tableOptions);
+  ASSERT_EQ(stmt->tableOptions->size(), 2);
+  ASSERT_STREQ(stmt->tableOptions->at(0)->name, "storage");
+  ASSERT_STREQ(stmt->tableOptions->at(0)->value, "column");
+  ASSERT_STREQ(stmt->tableOptions->at(1)->name, "row_group");
+  ASSERT_STREQ(stmt->tableOptions->at(1)->value, "large");
+}
+
+TEST(CreateStatementWithHintsTest) {
+  SQLParserResult result;
+  SQLParser::parse("CREATE TABLE events (id INT) WITH HINT(NO_CACHE);", &result);
+
+  ASSERT(result.isValid());
+  ASSERT_EQ(result.size(), 1);
+  const CreateStatement* stmt = (const CreateStatement*)result.getStatement(0);
+  ASSERT_EQ(stmt->columns->size(), 1);
+  ASSERT_NULL(stmt->tableOptions);
+  ASSERT_NOTNULL(stmt->hints);
+  ASSERT_EQ(stmt->hints->size(), 1);
+  ASSERT_STREQ(stmt->hints->at(0)->name, "NO_CACHE");
+
+  SQLParserResult options_result;
+  SQLParser::parse("CREATE TABLE events (id INT) WITH (storage = column) WITH HINT(NO_CACHE);", &options_result);
+
+  ASSERT(options_result.isValid());
+  ASSERT_EQ(options_result.size(), 1);
+  stmt = (const CreateStatement*)options_result.getStatement(0);
+  ASSERT_NOTNULL(stmt->tableOptions);
+  ASSERT_EQ(stmt->tableOptions->size(), 1);
+  ASSERT_NOTNULL(stmt->hints);
+  ASSERT_EQ(stmt->hints->size(), 1);
+}
+
 TEST(UpdateStatementTest) {
   SQLParserResult result;
   SQLParser::parse("UPDATE students SET grade = 5.0, name = 'test' WHERE name = 'Max O''Mustermann';", &result);
@@ -228,9 +273,22 @@ TEST(InsertStatementTest) {
                         InsertStatement, result, stmt);
 
   ASSERT_EQ(stmt->values->size(), 4);
+  ASSERT_EQ(stmt->valuesList->size(), 1);
   // TODO
 }
 
+TEST(InsertMultipleRowsTest) {
+  TEST_PARSE_SINGLE_SQL("INSERT INTO students VALUES ('Max', 12345), ('Anna', 12346), ('Tom', 12347)", kStmtInsert,
+                        InsertStatement, result, stmt);
+
+  ASSERT_EQ(stmt->type, kInsertValues);
+  ASSERT_EQ(stmt->valuesList->size(), 3);
+  ASSERT_EQ(stmt->values, stmt->valuesList->front());
+  ASSERT_EQ((*stmt->valuesList)[1]->size(), 2);
+  ASSERT_STREQ((*(*stmt->valuesList)[1])[0]->name, "Anna");
+  ASSERT_EQ((*(*stmt->valuesList)[2])[1]->ival, 12347);
+}
+
 TEST(AlterStatementDropActionTest) {
   SQLParserResult result;
   SQLParser::parse("ALTER TABLE mytable DROP COLUMN IF EXISTS mycolumn", &result);
@@ -278,6 +336,123 @@ TEST(CreateIndexStatementIfNotExistsTest) {
   ASSERT_EQ(stmt->indexColumns->size(), 2);
 }
 
+TEST(CreateIndexStatementSchemaTest) {
+  SQLParserResult result;
+  SQLParser::parse("CREATE INDEX myindex ON mySchema.myTable (col1);", &result);
+
+  ASSERT(result.isValid());
+  ASSERT_EQ(result.size(), 1);
+
+  const CreateStatement* stmt = (const CreateStatement*)result.getStatement(0);
+  ASSERT_STREQ(stmt->indexName, "myindex");
+  ASSERT_STREQ(stmt->schema, "mySchema");
+  ASSERT_STREQ(stmt->tableName, "myTable");
+  ASSERT_EQ(stmt->type, kCreateIndex);
+}
+
+TEST(CreateIndexStatementMethodTest) {
+  SQLParserResult result;
+  SQLParser::parse("CREATE INDEX myindex ON mySchema.myTable USING HASH (col1);", &result);
+
+  ASSERT(result.isValid());
+  ASSERT_EQ(result.size(), 1);
+
+  const CreateStatement* stmt = (const CreateStatement*)result.getStatement(0);
+  ASSERT_STREQ(stmt->indexName, "myindex");
+  ASSERT_STREQ(stmt->indexMethod, "hash");
+  ASSERT_EQ(stmt->indexColumns->size(), 1);
+
+  SQLParserResult trailing;
+  SQLParser::parse("CREATE INDEX myindex ON mySchema.myTable (col1) USING hash;", &trailing);
+
+  ASSERT(trailing.isValid());
+  stmt = (const CreateStatement*)trailing.getStatement(0);
+  ASSERT_STREQ(stmt->indexMethod, "hash");
+
+  SQLParserResult plain;
+  SQLParser::parse("CREATE INDEX myindex ON mySchema.myTable (col1);", &plain);
+
+  ASSERT(plain.isValid());
+  stmt = (const CreateStatement*)plain.getStatement(0);
+  ASSERT_NULL(stmt->indexMethod);
+
+  SQLParserResult twice;
+  SQLParser::parse("CREATE INDEX myindex ON mySchema.myTable USING hash (col1) USING btree;", &twice);
+  ASSERT_FALSE(twice.isValid());
+}
+
+TEST(CreateIndexStatementConcurrentlyTest) {
+  SQLParserResult result;
+  SQLParser::parse("CREATE INDEX CONCURRENTLY myindex ON myTable (col1);", &result);
+
+  ASSERT(result.isValid());
+  const CreateStatement* stmt = (const CreateStatement*)result.getStatement(0);
+  ASSERT_STREQ(stmt->indexName, "myindex");
+  ASSERT_EQ(stmt->concurrently, true);
+  ASSERT_EQ(stmt->ifNotExists, false);
+
+  SQLParserResult not_exists;
+  SQLParser::parse("CREATE INDEX concurrently IF NOT EXISTS myindex ON myTable USING hash (col1);", &not_exists);
+
+  ASSERT(not_exists.isValid());
+  stmt = (const CreateStatement*)not_exists.getStatement(0);
+  ASSERT_STREQ(stmt->indexName, "myindex");
+  ASSERT_STREQ(stmt->indexMethod, "hash");
+  ASSERT_EQ(stmt->concurrently, true);
+  ASSERT_EQ(stmt->ifNotExists, true);
+
+  SQLParserResult unnamed;
+  SQLParser::parse("CREATE INDEX CONCURRENTLY ON myTable (col1);", &unnamed);
+
+  ASSERT(unnamed.isValid());
+  stmt = (const CreateStatement*)unnamed.getStatement(0);
+  ASSERT_NULL(stmt->indexName);
+  ASSERT_STREQ(stmt->tableName, "myTable");
+  ASSERT_EQ(stmt->concurrently, true);
+
+  SQLParserResult plain;
+  SQLParser::parse("CREATE INDEX myindex ON myTable (col1);", &plain);
+
+  ASSERT(plain.isValid());
+  stmt = (const CreateStatement*)plain.getStatement(0);
+  ASSERT_EQ(stmt->concurrently, false);
+
+  SQLParserResult unknown;
+  SQLParser::parse("CREATE INDEX quickly myindex ON myTable (col1);", &unknown);
+  ASSERT_FALSE(unknown.isValid());
+}
+
+TEST(CreateIndexStatementIncludeTest) {
+  SQLParserResult result;
+  SQLParser::parse("CREATE INDEX myindex ON myTable (col1) INCLUDE (col2, col3);", &result);
+
+  ASSERT(result.isValid());
+  const CreateStatement* stmt = (const CreateStatement*)result.getStatement(0);
+  ASSERT_EQ(stmt->indexColumns->size(), 1);
+  ASSERT_EQ(stmt->indexInclude->size(), 2);
+  ASSERT_STREQ(stmt->indexInclude->at(0), "col2");
+  ASSERT_STREQ(stmt->indexInclude->at(1), "col3");
+
+  SQLParserResult method;
+  SQLParser::parse("CREATE INDEX myindex ON myTable (col1) USING btree include (col2);", &method);
+
+  ASSERT(method.isValid());
+  stmt = (const CreateStatement*)method.getStatement(0);
+  ASSERT_STREQ(stmt->indexMethod, "btree");
+  ASSERT_EQ(stmt->indexInclude->size(), 1);
+
+  SQLParserResult plain;
+  SQLParser::parse("CREATE INDEX myindex ON myTable (col1);", &plain);
+
+  ASSERT(plain.isValid());
+  stmt = (const CreateStatement*)plain.getStatement(0);
+  ASSERT_NULL(stmt->indexInclude);
+
+  SQLParserResult unknown;
+  SQLParser::parse("CREATE INDEX myindex ON myTable (col1) covering (col2);", &unknown);
+  ASSERT_FALSE(unknown.isValid());
+}
+
 TEST(DropIndexTest) {
   SQLParserResult result;
   SQLParser::parse("DROP INDEX myindex", &result);
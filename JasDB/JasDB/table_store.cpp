@@ -0,0 +1,1237 @@
+//
+//  table_store.cpp
+//  JasDB
+//
+
+#include "table_store.hpp"
+#include "index_store.hpp"
+#include "buffer_pool.hpp"
+#include "transaction.hpp"
+#include <iostream>
+#include <cstring>
+#include <cstdlib>
+#include <algorithm>
+#include <functional>
+#include <string_view>
+
+using namespace hsql;
+
+namespace jasdb{
+
+TupleLayout::TupleLayout(std::vector<ColumnDefinition*>* columns) : columns(columns){
+    null_bytes = static_cast<uint32_t>((columns->size() + 7) / 8);
+    size = null_bytes;
+    for(auto col_def : *columns){
+        offsets.push_back(size);
+        size += columnWidth(col_def);
+    }
+}
+
+uint32_t TupleLayout::columnWidth(ColumnDefinition* col_def){
+    switch (col_def->type.data_type) {
+        case DataType::INT:
+            return sizeof(int32_t);
+        case DataType::LONG:
+            return sizeof(int64_t);
+        case DataType::CHAR:
+        case DataType::VARCHAR:
+            return static_cast<uint32_t>(sizeof(uint16_t) + col_def->type.length);
+        default:
+            return 0;
+    }
+}
+
+uint32_t TupleLayout::tupleSize(std::vector<ColumnDefinition*>* columns){
+    uint32_t size = static_cast<uint32_t>((columns->size() + 7) / 8);
+    for(auto col_def : *columns){
+        size += columnWidth(col_def);
+    }
+    return size;
+}
+
+void TupleLayout::encode(std::vector<Expr*>* values, char* dst){
+    memset(dst, 0, size);
+    for(size_t i=0;i<columns->size();i++){
+        encodeColumn(i, (*values)[i], dst);
+    }
+}
+
+void TupleLayout::encodeColumn(size_t idx, Expr* val, char* dst){
+    if(val == NULL || val->type == kExprLiteralNull){
+        memset(dst + offsets[idx], 0, columnWidth((*columns)[idx]));
+        dst[idx >> 3] |= (1 << (idx & 7));
+        return;
+    }
+    dst[idx >> 3] &= ~(1 << (idx & 7));
+    encodeField((*columns)[idx], val, dst + offsets[idx]);
+}
+
+Expr* TupleLayout::decodeColumn(size_t idx, const char* src){
+    if(isNull(idx, src)){
+        return Expr::makeNullLiteral();
+    }
+    return decodeField((*columns)[idx], src + offsets[idx]);
+}
+
+void TupleLayout::encodeField(ColumnDefinition* col_def, Expr* val, char* field){
+    memset(field, 0, columnWidth(col_def));
+    switch (col_def->type.data_type) {
+        case DataType::INT:
+        {
+            int32_t v = static_cast<int32_t>(val->ival);
+            memcpy(field, &v, sizeof(v));
+            break;
+        }
+        case DataType::LONG:
+        {
+            int64_t v = val->ival;
+            memcpy(field, &v, sizeof(v));
+            break;
+        }
+        case DataType::CHAR:
+        case DataType::VARCHAR:
+        {
+            // parser already checked the length, still never write over the next column
+            size_t len = strlen(val->name);
+            if(len > static_cast<size_t>(col_def->type.length)){
+                len = col_def->type.length;
+            }
+            uint16_t len16 = static_cast<uint16_t>(len);
+            memcpy(field, &len16, sizeof(len16));
+            memcpy(field + sizeof(len16), val->name, len);
+            break;
+        }
+        default:
+            break;
+    }
+}
+
+Expr* TupleLayout::decodeField(ColumnDefinition* col_def, const char* field){
+    switch (col_def->type.data_type) {
+        case DataType::INT:
+        {
+            int32_t v;
+            memcpy(&v, field, sizeof(v));
+            return Expr::makeLiteral(static_cast<int64_t>(v));
+        }
+        case DataType::LONG:
+        {
+            int64_t v;
+            memcpy(&v, field, sizeof(v));
+            return Expr::makeLiteral(v);
+        }
+        case DataType::CHAR:
+        case DataType::VARCHAR:
+        {
+            uint16_t len;
+            memcpy(&len, field, sizeof(len));
+            // Expr frees its name with free()
+            char* str = static_cast<char*>(malloc(len + 1));
+            memcpy(str, field + sizeof(len), len);
+            str[len] = '\0';
+            return Expr::makeLiteral(str);
+        }
+        default:
+            return Expr::makeNullLiteral();
+    }
+}
+
+int TupleLayout::compareField(ColumnDefinition* col_def, const char* a, const char* b){
+    switch (col_def->type.data_type) {
+        case DataType::INT:
+        {
+            int32_t va, vb;
+            memcpy(&va, a, sizeof(va));
+            memcpy(&vb, b, sizeof(vb));
+            return va < vb ? -1 : (va > vb ? 1 : 0);
+        }
+        case DataType::LONG:
+        {
+            int64_t va, vb;
+            memcpy(&va, a, sizeof(va));
+            memcpy(&vb, b, sizeof(vb));
+            return va < vb ? -1 : (va > vb ? 1 : 0);
+        }
+        case DataType::CHAR:
+        case DataType::VARCHAR:
+        {
+            uint16_t len_a, len_b;
+            memcpy(&len_a, a, sizeof(len_a));
+            memcpy(&len_b, b, sizeof(len_b));
+            int res = memcmp(a + sizeof(len_a), b + sizeof(len_b), std::min(len_a, len_b));
+            if(res != 0){
+                return res;
+            }
+            return len_a < len_b ? -1 : (len_a > len_b ? 1 : 0);
+        }
+        default:
+            return 0;
+    }
+}
+
+void ZoneMap::add(ColumnDefinition* col_def, const char* field, bool is_null){
+    if(is_null){
+        null_count++;
+        return;
+    }
+    uint32_t width = TupleLayout::columnWidth(col_def);
+    if(value_count == 0){
+        min.assign(field, field + width);
+        max.assign(field, field + width);
+    }
+    else if(TupleLayout::compareField(col_def, field, min.data()) < 0){
+        min.assign(field, field + width);
+    }
+    else if(TupleLayout::compareField(col_def, field, max.data()) > 0){
+        max.assign(field, field + width);
+    }
+    value_count++;
+    if(!bloom.empty()){
+        uint64_t hash = hashField(col_def, field);
+        uint64_t step = (hash >> 32) | 1;
+        uint64_t mask = bloom.size() * 64 - 1;
+        for(uint32_t i=0;i<kBloomProbes;i++, hash += step){
+            bloom[(hash & mask) / 64] |= 1ULL << (hash & 63);
+        }
+    }
+}
+
+bool ZoneMap::mayContain(uint64_t hash){
+    if(bloom.empty()){
+        return true;
+    }
+    uint64_t step = (hash >> 32) | 1;
+    uint64_t mask = bloom.size() * 64 - 1;
+    for(uint32_t i=0;i<kBloomProbes;i++, hash += step){
+        if((bloom[(hash & mask) / 64] & (1ULL << (hash & 63))) == 0){
+            return false;
+        }
+    }
+    return true;
+}
+
+uint64_t ZoneMap::hashField(ColumnDefinition* col_def, const char* field){
+    uint64_t hash = 0;
+    switch (col_def->type.data_type) {
+        case DataType::INT:
+        {
+            int32_t v;
+            memcpy(&v, field, sizeof(v));
+            hash = static_cast<uint64_t>(static_cast<int64_t>(v));
+            break;
+        }
+        case DataType::LONG:
+            memcpy(&hash, field, sizeof(hash));
+            break;
+        case DataType::CHAR:
+        case DataType::VARCHAR:
+        {
+            // the bytes after the length are padding
+            uint16_t len;
+            memcpy(&len, field, sizeof(len));
+            hash = std::hash<std::string_view>()(std::string_view(field + sizeof(len), len));
+            break;
+        }
+        default:
+            break;
+    }
+    // mix every bit into the low ones, both halves pick probes
+    hash ^= hash >> 33;
+    hash *= 0xff51afd7ed558ccdULL;
+    hash ^= hash >> 33;
+    hash *= 0xc4ceb9fe1a85ec53ULL;
+    hash ^= hash >> 33;
+    return hash;
+}
+
+void ScanPredicate::prepare(ExprType type, int64_t ival, const char* sval){
+    this->ival = ival;
+    this->sval = sval != NULL ? sval : "";
+    switch (col_def->type.data_type) {
+        case DataType::INT:
+        case DataType::LONG:
+            matchable = type == kExprLiteralInt;
+            break;
+        case DataType::CHAR:
+        case DataType::VARCHAR:
+            matchable = type == kExprLiteralString;
+            break;
+        default:
+            matchable = false;
+            break;
+    }
+    if(op == kOpLike && col_def->type.data_type != DataType::CHAR && col_def->type.data_type != DataType::VARCHAR){
+        matchable = false;
+    }
+    field.clear();
+    if(!matchable || op != kOpEquals){
+        return;
+    }
+    // a value the column can't hold is never equal to a stored one
+    bool fits = true;
+    if(col_def->type.data_type == DataType::INT){
+        fits = ival >= INT32_MIN && ival <= INT32_MAX;
+    }
+    else if(col_def->type.data_type == DataType::CHAR || col_def->type.data_type == DataType::VARCHAR){
+        fits = this->sval.size() <= static_cast<size_t>(col_def->type.length);
+    }
+    if(!fits){
+        matchable = false;
+        return;
+    }
+    field.assign(TupleLayout::columnWidth(col_def), 0);
+    if(col_def->type.data_type == DataType::INT){
+        int32_t v = static_cast<int32_t>(ival);
+        memcpy(field.data(), &v, sizeof(v));
+    }
+    else if(col_def->type.data_type == DataType::LONG){
+        memcpy(field.data(), &ival, sizeof(ival));
+    }
+    else{
+        uint16_t len = static_cast<uint16_t>(this->sval.size());
+        memcpy(field.data(), &len, sizeof(len));
+        memcpy(field.data() + sizeof(len), this->sval.data(), len);
+    }
+    hash = ZoneMap::hashField(col_def, field.data());
+}
+
+int ScanPredicate::compare(const char* field){
+    switch (col_def->type.data_type) {
+        case DataType::INT:
+        {
+            int32_t v;
+            memcpy(&v, field, sizeof(v));
+            return v < ival ? -1 : (v > ival ? 1 : 0);
+        }
+        case DataType::LONG:
+        {
+            int64_t v;
+            memcpy(&v, field, sizeof(v));
+            return v < ival ? -1 : (v > ival ? 1 : 0);
+        }
+        default:
+        {
+            uint16_t len;
+            memcpy(&len, field, sizeof(len));
+            int res = memcmp(field + sizeof(len), sval.data(), std::min(static_cast<size_t>(len), sval.size()));
+            if(res != 0){
+                return res;
+            }
+            return len < sval.size() ? -1 : (len > sval.size() ? 1 : 0);
+        }
+    }
+}
+
+int ScanPredicate::comparePrefix(const char* field, const std::string& prefix){
+    uint16_t len;
+    memcpy(&len, field, sizeof(len));
+    int res = memcmp(field + sizeof(len), prefix.data(), std::min(static_cast<size_t>(len), prefix.size()));
+    if(res != 0){
+        return res;
+    }
+    return len < prefix.size() ? -1 : 0;
+}
+
+// % matches any number of bytes, _ exactly one.
+// a % which fails is retried one byte further, earlier ones never have to be revisited
+bool ScanPredicate::likeMatch(const char* str, size_t len, const std::string& pattern){
+    size_t i = 0, j = 0;
+    size_t star = std::string::npos, star_i = 0;
+    while(i < len){
+        if(j < pattern.size() && (pattern[j] == '_' || pattern[j] == str[i])){
+            i++;
+            j++;
+        }
+        else if(j < pattern.size() && pattern[j] == '%'){
+            star = j++;
+            star_i = i;
+        }
+        else if(star != std::string::npos){
+            j = star + 1;
+            i = ++star_i;
+        }
+        else{
+            return false;
+        }
+    }
+    while(j < pattern.size() && pattern[j] == '%'){
+        j++;
+    }
+    return j == pattern.size();
+}
+
+bool ScanPredicate::match(const char* field){
+    if(op == kOpEquals){
+        return memcmp(field, this->field.data(), this->field.size()) == 0;
+    }
+    if(op == kOpLike){
+        uint16_t len;
+        memcpy(&len, field, sizeof(len));
+        return likeMatch(field + sizeof(len), len, sval);
+    }
+    int res = compare(field);
+    switch (op) {
+        case kOpNotEquals:
+            return res != 0;
+        case kOpLess:
+            return res < 0;
+        case kOpLessEq:
+            return res <= 0;
+        case kOpGreater:
+            return res > 0;
+        case kOpGreaterEq:
+            return res >= 0;
+        default:
+            return false;
+    }
+}
+
+bool ScanPredicate::mayMatch(ZoneMap& zone){
+    if(zone.value_count == 0){
+        // only NULLs, they never match
+        return false;
+    }
+    if(op == kOpLike){
+        // only values starting with the prefix can match
+        std::string prefix = likePrefix();
+        return comparePrefix(zone.min.data(), prefix) <= 0 && comparePrefix(zone.max.data(), prefix) >= 0;
+    }
+    int min_res = compare(zone.min.data());
+    int max_res = compare(zone.max.data());
+    switch (op) {
+        case kOpEquals:
+            return min_res <= 0 && max_res >= 0 && zone.mayContain(hash);
+        case kOpNotEquals:
+            return min_res != 0 || max_res != 0;
+        case kOpLess:
+            return min_res < 0;
+        case kOpLessEq:
+            return min_res <= 0;
+        case kOpGreater:
+            return max_res > 0;
+        case kOpGreaterEq:
+            return max_res >= 0;
+        default:
+            return true;
+    }
+}
+
+bool ScanFilter::match(TupleLayout* layout, const char* row){
+    for(auto& predicate : predicates){
+        if(layout->isNull(predicate.idx, row) || !predicate.match(row + layout->offsets[predicate.idx])){
+            return false;
+        }
+    }
+    return true;
+}
+
+ColumnVector::ColumnVector(ColumnDefinition* col_def) : col_def(col_def){
+    width = TupleLayout::columnWidth(col_def);
+    integer = col_def->type.data_type == DataType::INT || col_def->type.data_type == DataType::LONG;
+}
+
+Batch::Batch(std::vector<ColumnDefinition*>* cols){
+    for(auto col_def : *cols){
+        columns.emplace_back(col_def);
+    }
+}
+
+void Batch::clear(){
+    tuples.clear();
+    sel.clear();
+    for(auto& col : columns){
+        col.ints.clear();
+        col.fields.clear();
+        col.nulls.clear();
+    }
+}
+
+void Batch::selectAll(){
+    sel.resize(tuples.size());
+    for(uint32_t i=0;i<sel.size();i++){
+        sel[i] = i;
+    }
+}
+
+void Batch::appendRow(Tuple tup, TupleLayout* layout, std::vector<size_t>& col_ids, const char* row){
+    tuples.push_back(tup);
+    for(auto idx : col_ids){
+        appendField(idx, row + layout->offsets[idx], layout->isNull(idx, row));
+    }
+}
+
+void Batch::appendField(size_t idx, const char* field, bool is_null){
+    ColumnVector& col = columns[idx];
+    col.nulls.push_back(is_null ? 1 : 0);
+    if(col.integer){
+        int64_t v = 0;
+        if(!is_null && col.col_def->type.data_type == DataType::INT){
+            int32_t v32;
+            memcpy(&v32, field, sizeof(v32));
+            v = v32;
+        }
+        else if(!is_null){
+            memcpy(&v, field, sizeof(v));
+        }
+        col.ints.push_back(v);
+        return;
+    }
+    // a field of the column store may lack its padding
+    size_t pos = col.fields.size();
+    col.fields.resize(pos + col.width, 0);
+    if(!is_null){
+        uint16_t len;
+        memcpy(&len, field, sizeof(len));
+        memcpy(col.fields.data() + pos, field, sizeof(len) + len);
+    }
+}
+
+void Batch::writeRow(uint32_t row, TupleLayout* layout, std::vector<size_t>& col_ids, char* dst){
+    memset(dst, 0, layout->size);
+    for(auto idx : col_ids){
+        ColumnVector& col = columns[idx];
+        char* field = dst + layout->offsets[idx];
+        if(col.nulls[row]){
+            dst[idx >> 3] |= (1 << (idx & 7));
+        }
+        else if(col.integer && col.col_def->type.data_type == DataType::INT){
+            int32_t v = static_cast<int32_t>(col.ints[row]);
+            memcpy(field, &v, sizeof(v));
+        }
+        else if(col.integer){
+            memcpy(field, &col.ints[row], sizeof(int64_t));
+        }
+        else{
+            memcpy(field, col.field(row), col.width);
+        }
+    }
+}
+
+void Batch::loadValue(size_t idx, uint32_t row, Expr* val){
+    ColumnVector& col = columns[idx];
+    DataType data_type = col.col_def->type.data_type;
+    if(col.nulls[row] || (!col.integer && data_type != DataType::CHAR && data_type != DataType::VARCHAR)){
+        val->type = kExprLiteralNull;
+        return;
+    }
+    if(col.integer){
+        val->type = kExprLiteralInt;
+        val->ival = col.ints[row];
+        return;
+    }
+    const char* field = col.field(row);
+    uint16_t len;
+    memcpy(&len, field, sizeof(len));
+    // the field width counts the length prefix, that leaves room for the terminator
+    if(val->name == NULL){
+        val->name = static_cast<char*>(malloc(col.width));
+    }
+    memcpy(val->name, field + sizeof(len), len);
+    val->name[len] = '\0';
+    val->type = kExprLiteralString;
+}
+
+bool TableStore::scanBatch(Tuple* tup, ScanFilter* filter, std::vector<size_t>& col_ids, Batch* batch, bool* done){
+    batch->clear();
+    *done = false;
+    while(batch->tuples.size() < kBatchSize){
+        if(filter != NULL ? filterScan(tup, filter, done) : seqScan(tup, done)){
+            return true;
+        }
+        if(*done){
+            break;
+        }
+        readColumns(tup, col_ids, batch);
+    }
+    batch->selectAll();
+    return false;
+}
+
+Batch* TableStore::morselBatch(std::vector<Batch*>& batches, size_t* used){
+    if(*used > 0 && batches[*used - 1]->tuples.size() < kBatchSize){
+        return batches[*used - 1];
+    }
+    if(*used == batches.size()){
+        batches.push_back(new Batch(columns));
+    }
+    Batch* batch = batches[(*used)++];
+    batch->clear();
+    return batch;
+}
+
+void TableStore::indexInsert(Tuple* tup, const char* data){
+    for(auto index : indexes){
+        index->insertRow(tup, data);
+    }
+}
+
+void TableStore::indexErase(Tuple* tup, const char* data){
+    for(auto index : indexes){
+        index->eraseRow(tup, data);
+    }
+}
+
+void TableStore::indexUpdate(Tuple* tup, const char* before, const char* after){
+    for(auto index : indexes){
+        index->updateRow(tup, before, after);
+    }
+}
+
+RowStore::RowStore(std::vector<ColumnDefinition*>* columns, std::string path, bool create) : TableStore(columns), layout(columns){
+    file = new PageFile(path);
+    // a new table never takes over a file left behind by an old one
+    file->open(create);
+    ring = new ScanRing();
+    scan_page_id = kInvalidBlock;
+    scan_page = NULL;
+}
+
+RowStore::~RowStore(){
+    endScan();
+    global_buffer_pool.flushFile(file);
+    global_buffer_pool.discardFile(file);
+    delete file;
+    delete ring;
+}
+
+bool RowStore::flush(){
+    return global_buffer_pool.flushFile(file);
+}
+
+bool RowStore::checkpoint(){
+    return global_buffer_pool.checkpointFile(file);
+}
+
+uint64_t RowStore::recLsn(){
+    return global_buffer_pool.minRecLsn(file);
+}
+
+void RowStore::drop(){
+    endScan();
+    zones.clear();
+    global_buffer_pool.discardFile(file);
+    file->remove();
+}
+
+ScanRing* RowStore::scanRing(){
+    // small tables are scanned through the whole pool, like every other access
+    if(file->page_count > global_buffer_pool.frameCount() / 4){
+        return ring;
+    }
+    return NULL;
+}
+
+char* RowStore::pinPage(uint32_t page_id){
+    if(page_id == scan_page_id){
+        return scan_page;
+    }
+    return global_buffer_pool.fetchPage(file, page_id);
+}
+
+void RowStore::unpinPage(uint32_t page_id, char* page, bool dirty){
+    if(page == NULL){
+        return;
+    }
+    if(page_id == scan_page_id){
+        // the scan keeps its pin, but checkpoints have to know about the change now
+        if(dirty){
+            global_buffer_pool.markDirty(file, page_id);
+        }
+        return;
+    }
+    global_buffer_pool.unpinPage(file, page_id, dirty);
+}
+
+void RowStore::endScan(){
+    if(scan_page != NULL){
+        global_buffer_pool.unpinPage(file, scan_page_id, false);
+    }
+    scan_page_id = kInvalidBlock;
+    scan_page = NULL;
+}
+
+void RowStore::initPage(char* page, uint32_t page_id){
+    PageHeader* header = reinterpret_cast<PageHeader*>(page);
+    header->lsn = 0;
+    header->page_id = page_id;
+    header->slot_count = 0;
+    header->live_count = 0;
+    header->free_begin = sizeof(PageHeader);
+    header->free_end = kPageSize;
+    header->free_slot_count = 0;
+    header->reserved = 0;
+}
+
+int32_t RowStore::freeSlot(char* page){
+    PageHeader* header = reinterpret_cast<PageHeader*>(page);
+    uint32_t free_space = header->free_end - header->free_begin;
+    if(header->free_slot_count > 0){
+        if(free_space < layout.size){
+            return -1;
+        }
+        Slot* slots = reinterpret_cast<Slot*>(page + sizeof(PageHeader));
+        for(uint16_t i=0;i<header->slot_count;i++){
+            if(slots[i].offset == 0){
+                return i;
+            }
+        }
+    }
+    if(free_space < sizeof(Slot) + layout.size){
+        return -1;
+    }
+    return header->slot_count;
+}
+
+void RowStore::placeTuple(char* page, uint32_t slot_id, const char* data){
+    PageHeader* header = reinterpret_cast<PageHeader*>(page);
+    Slot* slot = reinterpret_cast<Slot*>(page + sizeof(PageHeader)) + slot_id;
+    if(slot_id == header->slot_count){
+        header->free_begin += sizeof(Slot);
+        header->slot_count++;
+    }
+    else{
+        header->free_slot_count--;
+    }
+    header->free_end -= layout.size;
+    slot->offset = header->free_end;
+    slot->length = static_cast<uint16_t>(layout.size);
+    memcpy(page + slot->offset, data, layout.size);
+    header->live_count++;
+}
+
+// move the live tuples together at the end of the page and free the slots of deleted ones,
+// slot numbers of live tuples stay the same
+void RowStore::compactPage(char* page){
+    PageHeader* header = reinterpret_cast<PageHeader*>(page);
+    Slot* slots = reinterpret_cast<Slot*>(page + sizeof(PageHeader));
+    std::vector<uint16_t> live;
+    for(uint16_t i=0;i<header->slot_count;i++){
+        if(slots[i].length != 0){
+            live.push_back(i);
+        }
+        else if(slots[i].offset != 0){
+            slots[i].offset = 0;
+            header->free_slot_count++;
+        }
+    }
+    // tuples are moved towards the end, starting with the one closest to it, so none is overwritten
+    std::sort(live.begin(), live.end(), [slots](uint16_t a, uint16_t b){
+        return slots[a].offset > slots[b].offset;
+    });
+    uint16_t free_end = kPageSize;
+    for(auto i : live){
+        free_end -= slots[i].length;
+        memmove(page + free_end, page + slots[i].offset, slots[i].length);
+        slots[i].offset = free_end;
+    }
+    header->free_end = free_end;
+}
+
+bool RowStore::vacuum(){
+    endScan();
+    dead_tuples = 0;
+    free_pages.clear();
+    ScanRing* scan_ring = scanRing();
+    for(uint32_t page_id=0;page_id<file->page_count;page_id++){
+        char* page = global_buffer_pool.fetchPage(file, page_id, scan_ring);
+        if(page == NULL){
+            return true;
+        }
+        PageHeader* header = reinterpret_cast<PageHeader*>(page);
+        uint32_t dead = header->slot_count - header->live_count - header->free_slot_count;
+        // pages with only a few deleted tuples are left alone
+        bool sparse = dead > 0 && dead * 4 >= header->slot_count;
+        if(sparse){
+            Tuple tup;
+            tup.block = page_id;
+            tup.slot = 0;
+            uint64_t lsn = global_log_manager.append(kLogCompact, 0, table_id, &tup, NULL, 0);
+            compactPage(page);
+            setPageLsn(page, lsn);
+        }
+        if(page_id + 1 < file->page_count && freeSlot(page) >= 0){
+            free_pages.push_back(page_id);
+        }
+        global_buffer_pool.unpinPage(file, page_id, sparse);
+    }
+    // fill the pages at the front first
+    std::reverse(free_pages.begin(), free_pages.end());
+    return false;
+}
+
+void RowStore::setPageLsn(char* page, uint64_t lsn){
+    // changes made while no transaction runs (recovery) keep the LSN of the page
+    if(lsn != 0){
+        reinterpret_cast<PageHeader*>(page)->lsn = lsn;
+    }
+}
+
+char* RowStore::getTupleData(char* page, Tuple* tup){
+    if(page == NULL){
+        return NULL;
+    }
+    PageHeader* header = reinterpret_cast<PageHeader*>(page);
+    if(tup->slot >= header->slot_count){
+        return NULL;
+    }
+    Slot* slot = reinterpret_cast<Slot*>(page + sizeof(PageHeader)) + tup->slot;
+    if(slot->length == 0){
+        return NULL;
+    }
+    return page + slot->offset;
+}
+
+bool RowStore::insertTuple(std::vector<Expr*>* values){
+    std::vector<std::vector<Expr*>*> rows(1, values);
+    return insertTuples(rows);
+}
+
+bool RowStore::insertTuples(std::vector<std::vector<Expr*>*>& rows){
+    for(auto values : rows){
+        if(values == NULL || values->size() != columns->size()){
+            std::cout << "Column count doesn't match value count." << std::endl;
+            return true;
+        }
+    }
+    if(layout.size > maxTupleSize()){
+        std::cout << "Tuple is too large." << std::endl;
+        return true;
+    }
+    // a page stays pinned until it is full, so a batch only looks for a page once per page
+    uint32_t page_id = kInvalidBlock;
+    char* page = NULL;
+    int32_t slot_id = -1;
+    std::vector<char> data(layout.size);
+    for(auto values : rows){
+        if(page != NULL && (slot_id = freeSlot(page)) < 0){
+            unpinPage(page_id, page, true);
+            page = NULL;
+        }
+        if(page == NULL && (page = pageForInsert(&page_id, &slot_id)) == NULL){
+            return true;
+        }
+        layout.encode(values, data.data());
+        placeTuple(page, slot_id, data.data());
+        Slot* slot = reinterpret_cast<Slot*>(page + sizeof(PageHeader)) + slot_id;
+        updateZone(page_id, page + slot->offset);
+        Tuple tup;
+        tup.block = page_id;
+        tup.slot = slot_id;
+        indexInsert(&tup, page + slot->offset);
+        setPageLsn(page, global_transaction.log(this, kLogInsert, &tup, NULL, page + slot->offset, layout.size));
+    }
+    if(page != NULL){
+        unpinPage(page_id, page, true);
+    }
+    return false;
+}
+
+// pin a page with room for one more tuple, slot_id is the slot the tuple goes to.
+// pages vacuum has made room in are filled first, otherwise the tuple goes to the last page
+char* RowStore::pageForInsert(uint32_t* page_id, int32_t* slot_id){
+    char* page = NULL;
+    while(page == NULL && !free_pages.empty()){
+        *page_id = free_pages.back();
+        page = pinPage(*page_id);
+        if(page != NULL && (*slot_id = freeSlot(page)) < 0){
+            unpinPage(*page_id, page, false);
+            page = NULL;
+        }
+        if(page == NULL){
+            free_pages.pop_back();
+        }
+    }
+    if(page == NULL && file->page_count != 0){
+        *page_id = file->page_count - 1;
+        page = pinPage(*page_id);
+        if(page != NULL && (*slot_id = freeSlot(page)) < 0){
+            unpinPage(*page_id, page, false);
+            page = NULL;
+        }
+    }
+    if(page == NULL){
+        page = global_buffer_pool.newPage(file, page_id);
+        if(page == NULL){
+            return NULL;
+        }
+        initPage(page, *page_id);
+        *slot_id = 0;
+    }
+    return page;
+}
+
+bool RowStore::seqScan(Tuple* tup, bool* done){
+    *done = false;
+    uint32_t page_id = 0;
+    uint32_t slot_id = 0;
+    if(tup->block != kInvalidBlock){
+        page_id = tup->block;
+        slot_id = tup->slot + 1;
+    }
+    else{
+        endScan();
+    }
+    ScanRing* scan_ring = scanRing();
+    for(;page_id<file->page_count;page_id++, slot_id = 0){
+        if(page_id != scan_page_id){
+            endScan();
+            scan_page = global_buffer_pool.fetchPage(file, page_id, scan_ring);
+            if(scan_page == NULL){
+                std::cout << "Fail to read page " << page_id << " of " << file->path << std::endl;
+                return true;
+            }
+            scan_page_id = page_id;
+        }
+        PageHeader* header = reinterpret_cast<PageHeader*>(scan_page);
+        if(header->live_count == 0){
+            continue;
+        }
+        Slot* slots = reinterpret_cast<Slot*>(scan_page + sizeof(PageHeader));
+        for(;slot_id<header->slot_count;slot_id++){
+            if(slots[slot_id].length != 0){
+                tup->block = page_id;
+                tup->slot = slot_id;
+                return false;
+            }
+        }
+    }
+    endScan();
+    *done = true;
+    return false;
+}
+
+bool RowStore::filterScan(Tuple* tup, ScanFilter* filter, bool* done){
+    *done = false;
+    if(!filter->matchable()){
+        endScan();
+        *done = true;
+        return false;
+    }
+    uint32_t page_id = 0;
+    uint32_t slot_id = 0;
+    if(tup->block != kInvalidBlock){
+        page_id = tup->block;
+        slot_id = tup->slot + 1;
+    }
+    else{
+        endScan();
+    }
+    ScanRing* scan_ring = scanRing();
+    for(;page_id<file->page_count;page_id++, slot_id = 0){
+        if(page_id != scan_page_id){
+            // a page whose zone can't match is not read at all
+            if(page_id < zones.size() && zones[page_id].built && !filter->mayMatch(zones[page_id].columns)){
+                continue;
+            }
+            endScan();
+            scan_page = global_buffer_pool.fetchPage(file, page_id, scan_ring);
+            if(scan_page == NULL){
+                std::cout << "Fail to read page " << page_id << " of " << file->path << std::endl;
+                return true;
+            }
+            scan_page_id = page_id;
+            if(page_id >= zones.size() || !zones[page_id].built){
+                buildZone(page_id, scan_page);
+            }
+        }
+        PageHeader* header = reinterpret_cast<PageHeader*>(scan_page);
+        if(header->live_count == 0){
+            continue;
+        }
+        Slot* slots = reinterpret_cast<Slot*>(scan_page + sizeof(PageHeader));
+        for(;slot_id<header->slot_count;slot_id++){
+            if(slots[slot_id].length == 0){
+                continue;
+            }
+            // the fields are compared in place, without decoding the row
+            if(filter->match(&layout, scan_page + slots[slot_id].offset)){
+                tup->block = page_id;
+                tup->slot = slot_id;
+                return false;
+            }
+        }
+    }
+    endScan();
+    *done = true;
+    return false;
+}
+
+bool RowStore::matchTuple(Tuple* tup, ScanFilter* filter){
+    if(tup->block >= file->page_count){
+        return false;
+    }
+    char* page = pinPage(tup->block);
+    char* data = getTupleData(page, tup);
+    bool match = data != NULL && (filter == NULL || filter->match(&layout, data));
+    unpinPage(tup->block, page, false);
+    return match;
+}
+
+bool RowStore::readTuple(Tuple* tup, char* dst){
+    char* page = pinPage(tup->block);
+    char* data = getTupleData(page, tup);
+    if(data != NULL){
+        memcpy(dst, data, layout.size);
+    }
+    unpinPage(tup->block, page, false);
+    return data == NULL;
+}
+
+void RowStore::buildZone(uint32_t page_id, char* page){
+    if(page_id >= zones.size()){
+        zones.resize(page_id + 1);
+    }
+    PageZone& zone = zones[page_id];
+    zone.columns.assign(columns->size(), ZoneMap(kPageBloomBits));
+    zone.built = true;
+    PageHeader* header = reinterpret_cast<PageHeader*>(page);
+    Slot* slots = reinterpret_cast<Slot*>(page + sizeof(PageHeader));
+    for(uint16_t i=0;i<header->slot_count;i++){
+        if(slots[i].length != 0){
+            updateZone(page_id, page + slots[i].offset);
+        }
+    }
+}
+
+void RowStore::updateZone(uint32_t page_id, const char* data){
+    if(page_id >= zones.size() || !zones[page_id].built){
+        // built by the next filtered scan
+        return;
+    }
+    PageZone& zone = zones[page_id];
+    for(size_t i=0;i<columns->size();i++){
+        zone.columns[i].add((*columns)[i], data + layout.offsets[i], layout.isNull(i, data));
+    }
+}
+
+bool RowStore::beginMorselScan(uint32_t* block_count){
+    if(zones.size() < file->page_count){
+        zones.resize(file->page_count);
+    }
+    *block_count = file->page_count;
+    return false;
+}
+
+uint32_t RowStore::morselBlocks(){
+    uint32_t per_page = maxTupleSize() / (layout.size + sizeof(Slot));
+    return std::max<uint32_t>(1, kMorselRows / std::max<uint32_t>(1, per_page));
+}
+
+bool RowStore::scanMorsel(uint32_t begin, uint32_t end, ScanFilter* filter, std::vector<size_t>& col_ids,
+                          std::vector<Batch*>& batches, size_t* used){
+    *used = 0;
+    if(filter != NULL && !filter->matchable()){
+        return false;
+    }
+    // pages are pinned one at a time and never through scan_page, which belongs to the serial scan
+    ScanRing* scan_ring = scanRing();
+    for(uint32_t page_id=begin;page_id<end && page_id<zones.size();page_id++){
+        if(filter != NULL && zones[page_id].built && !filter->mayMatch(zones[page_id].columns)){
+            continue;
+        }
+        char* page = global_buffer_pool.fetchPage(file, page_id, scan_ring);
+        if(page == NULL){
+            return true;
+        }
+        if(filter != NULL && !zones[page_id].built){
+            buildZone(page_id, page);
+        }
+        PageHeader* header = reinterpret_cast<PageHeader*>(page);
+        Slot* slots = reinterpret_cast<Slot*>(page + sizeof(PageHeader));
+        for(uint16_t slot_id=0;slot_id<header->slot_count;slot_id++){
+            if(slots[slot_id].length == 0){
+                continue;
+            }
+            const char* data = page + slots[slot_id].offset;
+            if(filter == NULL || filter->match(&layout, data)){
+                Tuple tup;
+                tup.block = page_id;
+                tup.slot = slot_id;
+                morselBatch(batches, used)->appendRow(tup, &layout, col_ids, data);
+            }
+        }
+        global_buffer_pool.unpinPage(file, page_id, false);
+    }
+    for(size_t i=0;i<*used;i++){
+        batches[i]->selectAll();
+    }
+    return false;
+}
+
+void RowStore::readColumns(Tuple* tup, std::vector<size_t>& col_ids, Batch* batch){
+    char* page = pinPage(tup->block);
+    char* data = getTupleData(page, tup);
+    if(data != NULL){
+        batch->appendRow(*tup, &layout, col_ids, data);
+    }
+    unpinPage(tup->block, page, false);
+}
+
+bool RowStore::updateTuple(Tuple* tup, std::vector<size_t>& idxs, std::vector<Expr*>& values){
+    char* page = pinPage(tup->block);
+    char* data = getTupleData(page, tup);
+    if(data == NULL){
+        unpinPage(tup->block, page, false);
+        std::cout << "Tuple not found." << std::endl;
+        return true;
+    }
+    // tuples have fixed width, so the new values always fit in place
+    std::string before(data, layout.size);
+    for(size_t i=0;i<idxs.size() && i<values.size();i++){
+        layout.encodeColumn(idxs[i], values[i], data);
+    }
+    updateZone(tup->block, data);
+    indexUpdate(tup, before.data(), data);
+    setPageLsn(page, global_transaction.log(this, kLogUpdate, tup, before.data(), data, layout.size));
+    unpinPage(tup->block, page, true);
+    return false;
+}
+
+bool RowStore::writeTuple(Tuple* tup, const char* new_data){
+    char* page = pinPage(tup->block);
+    char* data = getTupleData(page, tup);
+    if(data == NULL){
+        unpinPage(tup->block, page, false);
+        std::cout << "Tuple not found." << std::endl;
+        return true;
+    }
+    std::string before(data, layout.size);
+    memcpy(data, new_data, layout.size);
+    updateZone(tup->block, data);
+    indexUpdate(tup, before.data(), data);
+    setPageLsn(page, global_transaction.log(this, kLogUpdate, tup, before.data(), data, layout.size));
+    unpinPage(tup->block, page, true);
+    return false;
+}
+
+bool RowStore::deleteTuple(Tuple* tup){
+    char* page = pinPage(tup->block);
+    char* data = getTupleData(page, tup);
+    if(data == NULL){
+        unpinPage(tup->block, page, false);
+        std::cout << "Tuple not found." << std::endl;
+        return true;
+    }
+    indexErase(tup, data);
+    PageHeader* header = reinterpret_cast<PageHeader*>(page);
+    Slot* slot = reinterpret_cast<Slot*>(page + sizeof(PageHeader)) + tup->slot;
+    slot->length = 0;
+    header->live_count--;
+    dead_tuples++;
+    setPageLsn(page, global_transaction.log(this, kLogDelete, tup, NULL, NULL, 0));
+    unpinPage(tup->block, page, true);
+    return false;
+}
+
+bool RowStore::restoreTuple(Tuple* tup){
+    char* page = pinPage(tup->block);
+    if(page == NULL){
+        return true;
+    }
+    PageHeader* header = reinterpret_cast<PageHeader*>(page);
+    Slot* slot = reinterpret_cast<Slot*>(page + sizeof(PageHeader)) + tup->slot;
+    if(tup->slot >= header->slot_count || slot->length != 0 || slot->offset == 0){
+        unpinPage(tup->block, page, false);
+        std::cout << "Tuple not found." << std::endl;
+        return true;
+    }
+    // a deleted tuple keeps its bytes, only the slot has to be marked used again
+    slot->length = static_cast<uint16_t>(layout.size);
+    header->live_count++;
+    indexInsert(tup, page + slot->offset);
+    if(dead_tuples > 0){
+        dead_tuples--;
+    }
+    setPageLsn(page, global_transaction.log(this, kLogRestore, tup, NULL, NULL, 0));
+    unpinPage(tup->block, page, true);
+    return false;
+}
+
+bool RowStore::prepareRedo(LogRecord* record){
+    // pages created after the last write back of the table are missing in the file,
+    // they are added before the pages are redone in parallel
+    while(file->page_count <= record->header.block){
+        uint32_t page_id;
+        char* page = global_buffer_pool.newPage(file, &page_id);
+        if(page == NULL){
+            return true;
+        }
+        initPage(page, page_id);
+        global_buffer_pool.unpinPage(file, page_id, true);
+    }
+    return false;
+}
+
+uint32_t RowStore::redoPartition(LogRecord* record){
+    // every record changes one page only
+    return record->header.block;
+}
+
+// recovery runs before any scan, so there are no zone maps to keep up to date here
+bool RowStore::redo(LogRecord* record){
+    Tuple tup = record->tuple();
+    if(tup.block >= file->page_count){
+        return true;
+    }
+    char* page = pinPage(tup.block);
+    if(page == NULL){
+        return true;
+    }
+    PageHeader* header = reinterpret_cast<PageHeader*>(page);
+    if(header->free_end == 0){
+        // allocated, but never written back before the crash
+        initPage(page, tup.block);
+    }
+    if(header->lsn >= record->lsn){
+        // the page was written back after this change
+        unpinPage(tup.block, page, false);
+        return false;
+    }
+    Slot* slot = reinterpret_cast<Slot*>(page + sizeof(PageHeader)) + tup.slot;
+    bool res = false;
+    switch (record->header.type) {
+        case kLogInsert:
+            // the page is in the state it had at the insert, so the logged slot is the free one
+            if(freeSlot(page) != static_cast<int32_t>(tup.slot)){
+                res = true;
+                break;
+            }
+            placeTuple(page, tup.slot, record->data.data());
+            break;
+        case kLogUpdate:
+            if(tup.slot >= header->slot_count){
+                res = true;
+                break;
+            }
+            memcpy(page + slot->offset, record->data.data() + layout.size, layout.size);
+            break;
+        case kLogDelete:
+            if(tup.slot < header->slot_count && slot->length != 0){
+                slot->length = 0;
+                header->live_count--;
+                dead_tuples++;
+            }
+            break;
+        case kLogRestore:
+            if(tup.slot < header->slot_count && slot->length == 0 && slot->offset != 0){
+                slot->length = static_cast<uint16_t>(layout.size);
+                header->live_count++;
+            }
+            break;
+        case kLogCompact:
+            compactPage(page);
+            break;
+        default:
+            break;
+    }
+    if(res){
+        unpinPage(tup.block, page, false);
+        std::cout << "Log record doesn't match page " << tup.block << " of " << file->path << std::endl;
+        return true;
+    }
+    header->lsn = record->lsn;
+    unpinPage(tup.block, page, true);
+    return false;
+}
+
+}
@@ -0,0 +1,411 @@
+//
+//  table_store.hpp
+//  JasDB
+//
+
+#ifndef table_store_hpp
+#define table_store_hpp
+
+#include <stdio.h>
+#include <stdint.h>
+#include <vector>
+#include <string>
+#include <atomic>
+#include <mutex>
+#include <iostream>
+#include "sql-parser-master/src/sql/CreateStatement.h"
+#include "sql-parser-master/src/sql/Expr.h"
+
+using namespace hsql;
+
+namespace jasdb{
+
+const uint32_t kPageSize = 8192;
+const uint32_t kInvalidBlock = UINT32_MAX;
+// bits of the Bloom filter a page keeps for each column, a power of two
+const uint32_t kPageBloomBits = 2048;
+// probes per value into a Bloom filter
+const uint32_t kBloomProbes = 3;
+// most tuples operators pass on at once
+const size_t kBatchSize = 1024;
+// tuples a parallel scan hands to a worker at a time
+const uint32_t kMorselRows = 65536;
+
+enum StorageType {
+    kRowStorage,
+    kColumnStorage
+};
+
+// Position of a tuple inside a table store.
+// For the row store block is the page id and slot is the slot number in that page,
+// for the column store block is the row group id and slot is the row inside that group.
+class Tuple {
+public:
+    uint32_t block;
+    uint32_t slot;
+    Tuple() : block(kInvalidBlock), slot(0){}
+};
+
+// Summary of one column inside a block of rows: the smallest and the biggest value
+// in field encoding, how many values are NULL, and a Bloom filter of the values.
+// Bounds catch values outside the range of a block, the filter the ones missing in between,
+// so an equality on a column without order in its blocks still skips most of them.
+// A zone only grows, a deleted or overwritten value keeps its bounds, which is still safe for skipping.
+class ZoneMap {
+public:
+    std::vector<char> min;
+    std::vector<char> max;
+    uint32_t null_count;
+    uint32_t value_count;
+    // bloom_bits bits, no filter when it is empty
+    std::vector<uint64_t> bloom;
+    ZoneMap(uint32_t bloom_bits = 0) : null_count(0), value_count(0), bloom(bloom_bits / 64, 0){}
+    void add(ColumnDefinition* col_def, const char* field, bool is_null);
+    // false when no value with this hash was added
+    bool mayContain(uint64_t hash);
+    // hash of the value of a field, equal values have equal hashes
+    static uint64_t hashField(ColumnDefinition* col_def, const char* field);
+};
+
+// "column op value", op is one of = <> < <= > >= LIKE
+class ScanPredicate {
+public:
+    size_t idx;
+    ColumnDefinition* col_def;
+    OperatorType op;
+    int64_t ival;
+    std::string sval;
+    // false when no value of the column can satisfy the predicate
+    bool matchable;
+    // the value in field encoding and its hash, set for = only
+    std::vector<char> field;
+    uint64_t hash;
+    ScanPredicate(size_t idx, ColumnDefinition* col_def, OperatorType op) : idx(idx), col_def(col_def), op(op), ival(0), matchable(false), hash(0){}
+    // val is an INT or string literal, the type has to fit the column
+    void prepare(ExprType type, int64_t ival, const char* sval);
+    // field is not NULL
+    bool match(const char* field);
+    // false when no value of the zone can satisfy the predicate
+    bool mayMatch(ZoneMap& zone);
+    // = or a LIKE pattern without wildcards
+    bool isEquality(){
+        return op == kOpEquals || (op == kOpLike && likePrefix().size() == sval.size());
+    }
+    // the part of a LIKE pattern before its first wildcard
+    std::string likePrefix(){
+        return sval.substr(0, sval.find_first_of("%_"));
+    }
+private:
+    // <0, 0, >0 when the field is smaller, equal or bigger than the value
+    int compare(const char* field);
+    // like compare, but only the first prefix.size() bytes of the field count
+    static int comparePrefix(const char* field, const std::string& prefix);
+    static bool likeMatch(const char* str, size_t len, const std::string& pattern);
+};
+
+class TupleLayout;
+
+// Conjunction of predicates evaluated by the table store itself while it scans,
+// so blocks whose zone maps exclude a predicate are not read and rows which don't match are never decoded.
+class ScanFilter {
+public:
+    std::vector<ScanPredicate> predicates;
+    // state of the running scan, the column store keeps which dictionary codes match
+    // for the row group it is in
+    uint32_t block;
+    std::vector<std::vector<uint8_t>> code_matches;
+    ScanFilter() : block(kInvalidBlock){}
+    bool matchable(){
+        for(auto& predicate : predicates){
+            if(!predicate.matchable){
+                return false;
+            }
+        }
+        return true;
+    }
+    // row is in TupleLayout encoding
+    bool match(TupleLayout* layout, const char* row);
+    // zones has one entry per column
+    bool mayMatch(std::vector<ZoneMap>& zones){
+        for(auto& predicate : predicates){
+            if(!predicate.mayMatch(zones[predicate.idx])){
+                return false;
+            }
+        }
+        return true;
+    }
+};
+
+// Values of one column for the rows of a batch. INT and LONG values are widened into ints,
+// CHAR and VARCHAR values keep their field encoding in fields, width bytes per row.
+// A NULL value is 0 or a zeroed field.
+class ColumnVector {
+public:
+    ColumnDefinition* col_def;
+    uint32_t width;
+    bool integer;
+    std::vector<int64_t> ints;
+    std::vector<char> fields;
+    std::vector<uint8_t> nulls;
+    ColumnVector(ColumnDefinition* col_def);
+    const char* field(uint32_t row){
+        return fields.data() + static_cast<size_t>(row) * width;
+    }
+};
+
+// Up to kBatchSize tuples in column vectors, the unit operators pass to each other.
+// Only the vectors of the columns a plan reads are filled, they keep their memory from batch to batch.
+// sel holds the rows still in the batch in order, an operator dropping rows shrinks it
+// and leaves the vectors as they are.
+class Batch {
+public:
+    std::vector<Tuple> tuples;
+    // one vector per column of the table
+    std::vector<ColumnVector> columns;
+    std::vector<uint32_t> sel;
+    Batch(std::vector<ColumnDefinition*>* cols);
+    void clear();
+    // select every row
+    void selectAll();
+    // add a tuple, its fields in col_ids come from a row in TupleLayout encoding
+    void appendRow(Tuple tup, TupleLayout* layout, std::vector<size_t>& col_ids, const char* row);
+    // add the field of column idx for the last tuple
+    void appendField(size_t idx, const char* field, bool is_null);
+    // encode the columns in col_ids of row into dst in TupleLayout encoding, the other columns are left empty
+    void writeRow(uint32_t row, TupleLayout* layout, std::vector<size_t>& col_ids, char* dst);
+    // store the value of a filled column in val, which is reused from row to row.
+    // A string keeps the name buffer of val, it is allocated once with room for the longest value
+    void loadValue(size_t idx, uint32_t row, Expr* val);
+};
+
+class LogRecord;
+class IndexStore;
+
+// Every table store keeps the same interface, so operators do not care about the layout.
+// Functions returning bool return true on failure, like the rest of JasDB.
+// Every change is logged through global_transaction.
+class TableStore {
+public:
+    std::vector<ColumnDefinition*>* columns;
+    // id of the table in log records
+    uint32_t table_id;
+    // tuples deleted since the last vacuum
+    std::atomic<uint32_t> dead_tuples;
+    // secondary indexes of the table, every change of a tuple is applied to them
+    std::vector<IndexStore*> indexes;
+    // held by the statement which uses the table. Scans keep their position in the store, so even two
+    // selects of one table can't run at once, statements of different tables can
+    std::mutex statement_latch;
+    TableStore(std::vector<ColumnDefinition*>* columns) : columns(columns), table_id(0), dead_tuples(0){}
+    virtual ~TableStore(){}
+    virtual bool insertTuple(std::vector<Expr*>* values) = 0;
+    // insert several rows at once, nothing is inserted when a row has the wrong number of values.
+    // rows inserted before a later failure stay until the transaction of the caller rolls back
+    virtual bool insertTuples(std::vector<std::vector<Expr*>*>& rows){
+        for(auto values : rows){
+            if(values == NULL || values->size() != columns->size()){
+                std::cout << "Column count doesn't match value count." << std::endl;
+                return true;
+            }
+        }
+        for(auto values : rows){
+            if(insertTuple(values)){
+                return true;
+            }
+        }
+        return false;
+    }
+    // move tup to the next live tuple, a default constructed Tuple starts the scan.
+    // done is set when there is no more tuple, a page which can't be read fails the scan instead
+    virtual bool seqScan(Tuple* tup, bool* done) = 0;
+    // like seqScan, but skip tuples which don't match filter
+    virtual bool filterScan(Tuple* tup, ScanFilter* filter, bool* done) = 0;
+    // true when tup is live and matches filter, filter may be NULL
+    virtual bool matchTuple(Tuple* tup, ScanFilter* filter) = 0;
+    // copy a live tuple in TupleLayout encoding
+    virtual bool readTuple(Tuple* tup, char* data) = 0;
+    // add a live tuple and its columns in col_ids to batch
+    virtual void readColumns(Tuple* tup, std::vector<size_t>& col_ids, Batch* batch) = 0;
+    // clear batch and fill it with up to kBatchSize tuples after tup which match filter, NULL matches every tuple,
+    // with their columns in col_ids. done is set once the last tuple was read
+    virtual bool scanBatch(Tuple* tup, ScanFilter* filter, std::vector<size_t>& col_ids, Batch* batch, bool* done);
+    // Parallel scans split the table into morsels, ranges of blocks each worker scans on its own.
+    // beginMorselScan sets the number of blocks, it is called by the thread running the statement
+    // before any scanMorsel
+    virtual bool beginMorselScan(uint32_t* block_count) = 0;
+    // blocks which hold about kMorselRows tuples
+    virtual uint32_t morselBlocks() = 0;
+    // put the tuples of blocks [begin, end) which match filter into batches, with their columns in col_ids.
+    // The batches already in the vector are reused and new ones added, used gets the number filled.
+    // Several threads of the statement holding statement_latch may scan at once, each with its own filter
+    virtual bool scanMorsel(uint32_t begin, uint32_t end, ScanFilter* filter, std::vector<size_t>& col_ids,
+                            std::vector<Batch*>& batches, size_t* used) = 0;
+    virtual bool updateTuple(Tuple* tup, std::vector<size_t>& idxs, std::vector<Expr*>& values) = 0;
+    virtual bool deleteTuple(Tuple* tup) = 0;
+    // bring a deleted tuple back, used to undo a delete
+    virtual bool restoreTuple(Tuple* tup) = 0;
+    // overwrite a tuple with a row in TupleLayout encoding, used to undo an update
+    virtual bool writeTuple(Tuple* tup, const char* data) = 0;
+    // apply a logged change again during recovery, unless the store already has it
+    virtual bool redo(LogRecord* record) = 0;
+    // called for every record before the redo starts, redo() of different partitions may run in parallel
+    virtual bool prepareRedo(LogRecord*){
+        return false;
+    }
+    // records of one partition are redone in log order by the same thread
+    virtual uint32_t redoPartition(LogRecord*){
+        return 0;
+    }
+    // write back changes while other sessions keep changing the store
+    virtual bool checkpoint(){
+        return flush();
+    }
+    // lowest LSN of a change which may be missing in the file, UINT64_MAX if the file is up to date
+    virtual uint64_t recLsn(){
+        return UINT64_MAX;
+    }
+    // the scan is finished or abandoned, release what it holds
+    virtual void endScan(){}
+    // reclaim the space of deleted tuples, only called while no delete can be undone anymore
+    virtual bool vacuum(){
+        dead_tuples = 0;
+        return false;
+    }
+    // write everything this store holds in memory back to its file
+    virtual bool flush(){
+        return false;
+    }
+    // remove the data of this store permanently
+    virtual void drop(){}
+protected:
+    // the batch the next tuple of a morsel goes to
+    Batch* morselBatch(std::vector<Batch*>& batches, size_t* used);
+    // recovery runs before any index is built, so redo() doesn't call these
+    void indexInsert(Tuple* tup, const char* data);
+    void indexErase(Tuple* tup, const char* data);
+    void indexUpdate(Tuple* tup, const char* before, const char* after);
+};
+
+// Fixed-width binary encoding of one row:
+// [null bitmap][col 0][col 1]...
+// INT is 4 bytes, LONG is 8 bytes, CHAR(n)/VARCHAR(n) is a 2 bytes length followed by n bytes.
+// Every row of a table has the same size, so an update never moves a tuple.
+class TupleLayout {
+public:
+    std::vector<ColumnDefinition*>* columns;
+    std::vector<uint32_t> offsets;
+    uint32_t null_bytes;
+    uint32_t size;
+    TupleLayout(std::vector<ColumnDefinition*>* columns);
+    static uint32_t columnWidth(ColumnDefinition* col_def);
+    static uint32_t tupleSize(std::vector<ColumnDefinition*>* columns);
+    static void encodeField(ColumnDefinition* col_def, Expr* val, char* field);
+    static Expr* decodeField(ColumnDefinition* col_def, const char* field);
+    // order of two fields of the same column
+    static int compareField(ColumnDefinition* col_def, const char* a, const char* b);
+    void encode(std::vector<Expr*>* values, char* dst);
+    void encodeColumn(size_t idx, Expr* val, char* dst);
+    Expr* decodeColumn(size_t idx, const char* src);
+    bool isNull(size_t idx, const char* src){
+        return (src[idx >> 3] >> (idx & 7)) & 1;
+    }
+};
+
+class ScanRing;
+
+// Slotted page:
+// [PageHeader][slot 0][slot 1]...      free space      ...[tuple 1][tuple 0]
+// Slots grow from the front and tuples grow from the end of the page.
+// lsn is the LSN of the last change of the page, it has to stay the first field, see BufferPool.
+// Deleted tuples keep their bytes until vacuum compacts the page, their slots are reused afterwards.
+struct PageHeader {
+    uint64_t lsn;
+    uint32_t page_id;
+    uint16_t slot_count;
+    uint16_t live_count;
+    uint16_t free_begin;
+    uint16_t free_end;
+    // slots vacuum has freed
+    uint16_t free_slot_count;
+    uint16_t reserved;
+};
+
+struct Slot {
+    uint16_t offset; // 0 means vacuum has freed this slot
+    uint16_t length; // 0 means this slot is deleted
+};
+
+class PageFile;
+
+// zone maps of the columns of one page
+class PageZone {
+public:
+    bool built;
+    std::vector<ZoneMap> columns;
+    PageZone() : built(false){}
+};
+
+// Rows are stored in pages of a PageFile, pages are accessed through global_buffer_pool.
+class RowStore : public TableStore {
+public:
+    TupleLayout layout;
+    PageFile* file;
+    // create is false when the table already exists on disk
+    RowStore(std::vector<ColumnDefinition*>* columns, std::string path, bool create);
+    ~RowStore();
+    bool insertTuple(std::vector<Expr*>* values) override;
+    bool insertTuples(std::vector<std::vector<Expr*>*>& rows) override;
+    bool seqScan(Tuple* tup, bool* done) override;
+    bool filterScan(Tuple* tup, ScanFilter* filter, bool* done) override;
+    bool matchTuple(Tuple* tup, ScanFilter* filter) override;
+    bool readTuple(Tuple* tup, char* data) override;
+    void readColumns(Tuple* tup, std::vector<size_t>& col_ids, Batch* batch) override;
+    bool beginMorselScan(uint32_t* block_count) override;
+    uint32_t morselBlocks() override;
+    bool scanMorsel(uint32_t begin, uint32_t end, ScanFilter* filter, std::vector<size_t>& col_ids,
+                    std::vector<Batch*>& batches, size_t* used) override;
+    bool updateTuple(Tuple* tup, std::vector<size_t>& idxs, std::vector<Expr*>& values) override;
+    bool deleteTuple(Tuple* tup) override;
+    bool restoreTuple(Tuple* tup) override;
+    bool writeTuple(Tuple* tup, const char* data) override;
+    bool redo(LogRecord* record) override;
+    bool prepareRedo(LogRecord* record) override;
+    uint32_t redoPartition(LogRecord* record) override;
+    bool checkpoint() override;
+    uint64_t recLsn() override;
+    void endScan() override;
+    bool vacuum() override;
+    bool flush() override;
+    void drop() override;
+    // biggest tuple which can be put into one page
+    static uint32_t maxTupleSize(){
+        return kPageSize - sizeof(PageHeader) - sizeof(Slot);
+    }
+private:
+    ScanRing* ring;
+    // the page the running scan stopped at stays pinned,
+    // so reading the tuple it just returned doesn't go through the buffer pool again
+    uint32_t scan_page_id;
+    char* scan_page;
+    // zone maps are built the first time a filtered scan reads a page and kept up to date by every change.
+    // A parallel scan sizes the vector first, so its workers build the zones of different pages at once
+    std::vector<PageZone> zones;
+    // pages before the last one which have room for a tuple, found by vacuum
+    std::vector<uint32_t> free_pages;
+    ScanRing* scanRing();
+    int32_t freeSlot(char* page);
+    char* pageForInsert(uint32_t* page_id, int32_t* slot_id);
+    void placeTuple(char* page, uint32_t slot_id, const char* data);
+    void compactPage(char* page);
+    void buildZone(uint32_t page_id, char* page);
+    void updateZone(uint32_t page_id, const char* data);
+    char* pinPage(uint32_t page_id);
+    void unpinPage(uint32_t page_id, char* page, bool dirty);
+    char* getTupleData(char* page, Tuple* tup);
+    void initPage(char* page, uint32_t page_id);
+    void setPageLsn(char* page, uint64_t lsn);
+};
+
+}
+
+#endif /* table_store_hpp */
@@ -0,0 +1,125 @@
+//
+//  transaction.cpp
+//  JasDB
+//
+
+#include "transaction.hpp"
+#include "vacuum.hpp"
+#include <iostream>
+
+namespace jasdb{
+
+thread_local Transaction global_transaction;
+
+bool Transaction::begin(){
+    if(inProgress()){
+        std::cout << "Transaction already started." << std::endl;
+        return true;
+    }
+    // deletes of a running transaction may be undone, vacuum waits until it has finished
+    global_vacuum.enter();
+    txn_id = global_log_manager.nextTxnId();
+    last_lsn = 0;
+    undo_log.clear();
+    return false;
+}
+
+bool Transaction::commit(){
+    if(!inProgress()){
+        std::cout << "No transaction in progress." << std::endl;
+        return true;
+    }
+    bool res = false;
+    // a transaction without changes has nothing to make durable
+    if(last_lsn != 0){
+        uint64_t lsn = global_log_manager.append(kLogCommit, txn_id, 0, NULL, NULL, 0);
+        res = global_log_manager.flush(lsn);
+        global_log_manager.endTxn(txn_id);
+    }
+    txn_id = 0;
+    last_lsn = 0;
+    undo_log.clear();
+    global_vacuum.leave();
+    return res;
+}
+
+bool Transaction::rollback(){
+    if(!inProgress()){
+        std::cout << "No transaction in progress." << std::endl;
+        return true;
+    }
+    // undoing a change is a change itself, it is logged but not undone again
+    rolling_back = true;
+    for(auto it = undo_log.rbegin(); it != undo_log.rend(); it++){
+        undo(it->store, it->type, &it->tup, it->before.data());
+    }
+    rolling_back = false;
+    if(last_lsn != 0){
+        global_log_manager.append(kLogAbort, txn_id, 0, NULL, NULL, 0);
+        global_log_manager.endTxn(txn_id);
+    }
+    txn_id = 0;
+    last_lsn = 0;
+    undo_log.clear();
+    global_vacuum.leave();
+    return false;
+}
+
+uint64_t Transaction::log(TableStore* store, LogType type, Tuple* tup, const char* before, const char* after, uint32_t size){
+    if(!inProgress()){
+        return 0;
+    }
+    std::string data;
+    if(type == kLogInsert){
+        data.assign(after, size);
+    }
+    else if(type == kLogUpdate){
+        data.assign(before, size);
+        data.append(after, size);
+    }
+    if(last_lsn == 0){
+        // from now on checkpoints keep the log of this transaction
+        global_log_manager.beginTxn(txn_id);
+    }
+    last_lsn = global_log_manager.append(type, txn_id, store->table_id, tup, data.data(), static_cast<uint32_t>(data.size()));
+    if(!rolling_back){
+        UndoEntry entry;
+        entry.store = store;
+        entry.type = type;
+        entry.tup = *tup;
+        if(type == kLogUpdate){
+            entry.before.assign(before, size);
+        }
+        undo_log.push_back(entry);
+    }
+    return last_lsn;
+}
+
+void Transaction::forget(TableStore* store){
+    for(auto it = undo_log.begin(); it != undo_log.end();){
+        if(it->store == store){
+            it = undo_log.erase(it);
+        }
+        else{
+            it++;
+        }
+    }
+}
+
+void Transaction::undo(TableStore* store, LogType type, Tuple* tup, const char* before){
+    switch (type) {
+        case kLogInsert:
+            store->deleteTuple(tup);
+            break;
+        case kLogDelete:
+            store->restoreTuple(tup);
+            break;
+        case kLogUpdate:
+            store->writeTuple(tup, before);
+            break;
+        default:
+            break;
+    }
+}
+
+}
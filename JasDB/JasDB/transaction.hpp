@@ -0,0 +1,59 @@
+//
+//  transaction.hpp
+//  JasDB
+//
+
+#ifndef transaction_hpp
+#define transaction_hpp
+
+#include <stdio.h>
+#include <stdint.h>
+#include <string>
+#include <vector>
+#include "table_store.hpp"
+#include "log_manager.hpp"
+
+namespace jasdb{
+
+// What is needed to take one change back.
+class UndoEntry {
+public:
+    TableStore* store;
+    LogType type;
+    Tuple tup;
+    // old row of an update
+    std::string before;
+};
+
+// Transaction of one session.
+// Table stores call log() for every change, the change is durable once commit() returns.
+// A statement run outside BEGIN ... COMMIT is a transaction of its own.
+class Transaction {
+public:
+    uint64_t txn_id;
+    uint64_t last_lsn;
+    std::vector<UndoEntry> undo_log;
+    Transaction() : txn_id(0), last_lsn(0), rolling_back(false){}
+    bool inProgress(){
+        return txn_id != 0;
+    }
+    bool begin();
+    bool commit();
+    bool rollback();
+    // write the log record of a change and remember how to undo it,
+    // before and after are rows in TupleLayout encoding of size bytes
+    // return the LSN of the record, 0 when no transaction is running, e.g. during recovery
+    uint64_t log(TableStore* store, LogType type, Tuple* tup, const char* before, const char* after, uint32_t size);
+    // the table of store was dropped, its changes can't be undone anymore
+    void forget(TableStore* store);
+    static void undo(TableStore* store, LogType type, Tuple* tup, const char* before);
+private:
+    bool rolling_back;
+};
+
+// every session thread has its own transaction
+extern thread_local Transaction global_transaction;
+
+}
+
+#endif /* transaction_hpp */
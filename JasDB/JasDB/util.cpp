@@ -0,0 +1,100 @@
+//
+//  util.cpp
+//  JasDB
+//
+
+#include "util.h"
+#include <iostream>
+using namespace hsql;
+
+namespace jasdb{
+
+std::string TableNameToString(const std::string& schema, const std::string& name){
+    return schema + "." + name;
+}
+
+const char* DataTypeToString(DataType type){
+    switch(type){
+        case DataType::BIGINT:
+            return "BIGINT";
+        case DataType::BOOLEAN:
+            return "BOOLEAN";
+        case DataType::CHAR:
+            return "CHAR";
+        case DataType::DATE:
+            return "DATE";
+        case DataType::DATETIME:
+            return "DATETIME";
+        case DataType::DECIMAL:
+            return "DECIMAL";
+        case DataType::DOUBLE:
+            return "DOUBLE";
+        case DataType::FLOAT:
+            return "FLOAT";
+        case DataType::INT:
+            return "INT";
+        case DataType::LONG:
+            return "LONG";
+        case DataType::REAL:
+            return "REAL";
+        case DataType::SMALLINT:
+            return "SMALLINT";
+        case DataType::TEXT:
+            return "TEXT";
+        case DataType::TIME:
+            return "TIME";
+        case DataType::VARCHAR:
+            return "VARCHAR";
+        default:
+            return "UNKNOWN";
+    }
+}
+
+bool IsDataTypeSupport(DataType type){
+    switch(type){
+        case DataType::INT:
+        case DataType::LONG:
+        case DataType::CHAR:
+        case DataType::VARCHAR:
+            return true;
+        default:
+            return false;
+    }
+}
+
+void PrintHeader(std::vector<ColumnDefinition*>& out_cols){
+    for(size_t i=0;i<out_cols.size();i++){
+        std::cout << (i == 0 ? "" : "\t") << out_cols[i]->name;
+    }
+    std::cout << std::endl;
+}
+
+void PrintRows(std::vector<size_t>& col_ids, std::vector<std::vector<Expr*>>& tuples){
+    for(auto& values : tuples){
+        for(size_t i=0;i<col_ids.size();i++){
+            Expr* val = values[col_ids[i]];
+            std::cout << (i == 0 ? "" : "\t");
+            switch(val->type){
+                case kExprLiteralInt:
+                    std::cout << val->ival;
+                    break;
+                case kExprLiteralFloat:
+                    std::cout << val->fval;
+                    break;
+                case kExprLiteralString:
+                    std::cout << val->name;
+                    break;
+                default:
+                    std::cout << "NULL";
+                    break;
+            }
+        }
+        std::cout << "\n";
+    }
+}
+
+void PrintFooter(size_t row_count){
+    std::cout << row_count << (row_count == 1 ? " row" : " rows") << " in set" << std::endl;
+}
+
+}
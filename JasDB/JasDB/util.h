@@ -0,0 +1,33 @@
+//
+//  util.h
+//  JasDB
+//
+
+#ifndef util_h
+#define util_h
+
+#include <stdio.h>
+#include <climits>
+#include <string>
+#include <vector>
+#include "sql-parser-master/src/sql/Expr.h"
+#include "sql-parser-master/src/sql/CreateStatement.h"
+
+namespace jasdb{
+
+// schema.name
+std::string TableNameToString(const std::string& schema, const std::string& name);
+const char* DataTypeToString(hsql::DataType type);
+// the table stores hold INT, LONG, CHAR and VARCHAR columns
+bool IsDataTypeSupport(hsql::DataType type);
+
+// A select result is printed as it streams in: the header once, then the rows of every batch,
+// then the footer with the number of rows, so nothing is repeated when a result has many batches.
+// out_cols are the selected columns, col_ids their positions in the values of a row.
+void PrintHeader(std::vector<hsql::ColumnDefinition*>& out_cols);
+void PrintRows(std::vector<size_t>& col_ids, std::vector<std::vector<hsql::Expr*>>& tuples);
+void PrintFooter(size_t row_count);
+
+}
+
+#endif /* util_h */
@@ -0,0 +1,90 @@
+//
+//  vacuum.cpp
+//  JasDB
+//
+
+#include "vacuum.hpp"
+#include "metadata.hpp"
+#include <chrono>
+
+namespace jasdb{
+
+Vacuum global_vacuum;
+
+void Vacuum::start(){
+    std::lock_guard<std::mutex> guard(latch);
+    if(running){
+        return;
+    }
+    running = true;
+    worker = std::thread(&Vacuum::run, this);
+}
+
+void Vacuum::stop(){
+    {
+        std::lock_guard<std::mutex> guard(latch);
+        if(!running){
+            return;
+        }
+        running = false;
+    }
+    cond.notify_all();
+    worker.join();
+}
+
+void Vacuum::run(){
+    std::unique_lock<std::mutex> lock(latch);
+    while(running){
+        cond.wait_for(lock, std::chrono::seconds(1));
+        if(!running){
+            break;
+        }
+        lock.unlock();
+        vacuum();
+        lock.lock();
+    }
+}
+
+void Vacuum::enter(){
+    std::unique_lock<std::mutex> lock(latch);
+    while(vacuuming){
+        cond.wait(lock);
+    }
+    active++;
+}
+
+void Vacuum::leave(){
+    std::lock_guard<std::mutex> guard(latch);
+    active--;
+}
+
+bool Vacuum::vacuum(uint32_t threshold){
+    std::lock_guard<std::mutex> vacuum_guard(vacuum_latch);
+    std::lock_guard<std::mutex> meta_guard(global_meta_data.latch);
+    bool res = false;
+    for(auto it : global_meta_data.map_of_table){
+        TableStore* store = it.second->table_store;
+        if(store->dead_tuples < threshold || store->dead_tuples == 0){
+            continue;
+        }
+        {
+            std::lock_guard<std::mutex> guard(latch);
+            if(active != 0){
+                // sessions are busy, try again later
+                return res;
+            }
+            vacuuming = true;
+        }
+        if(store->vacuum()){
+            res = true;
+        }
+        {
+            std::lock_guard<std::mutex> guard(latch);
+            vacuuming = false;
+        }
+        cond.notify_all();
+    }
+    return res;
+}
+
+}
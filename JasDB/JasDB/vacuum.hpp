@@ -0,0 +1,55 @@
+//
+//  vacuum.hpp
+//  JasDB
+//
+
+#ifndef vacuum_hpp
+#define vacuum_hpp
+
+#include <stdio.h>
+#include <stdint.h>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+
+namespace jasdb{
+
+// a table is vacuumed once this many of its tuples were deleted since the last time
+const uint32_t kVacuumThreshold = 1024;
+
+// Background compaction of the table stores.
+// A deleted tuple keeps its space while a transaction may still bring it back, so vacuum
+// only runs while no session is inside a statement or a transaction. Sessions enter() before
+// they touch tables and leave() afterwards, vacuum waits for a moment nobody is inside and
+// keeps sessions out while it compacts one table.
+class Vacuum {
+public:
+    Vacuum() : running(false), active(0), vacuuming(false){}
+    ~Vacuum(){
+        stop();
+    }
+    // look for tables to compact in a background thread
+    void start();
+    void stop();
+    void enter();
+    void leave();
+    // compact every table with at least threshold deleted tuples
+    bool vacuum(uint32_t threshold = kVacuumThreshold);
+private:
+    std::thread worker;
+    std::mutex latch;
+    std::condition_variable cond;
+    bool running;
+    // sessions inside, a session may enter several times
+    uint32_t active;
+    bool vacuuming;
+    // one vacuum at a time
+    std::mutex vacuum_latch;
+    void run();
+};
+
+extern Vacuum global_vacuum;
+
+}
+
+#endif /* vacuum_hpp */
@@ -0,0 +1,77 @@
+//
+//  worker_pool.cpp
+//  JasDB
+//
+
+#include "worker_pool.hpp"
+#include <algorithm>
+
+namespace jasdb{
+
+WorkerPool global_worker_pool;
+
+void WorkerPool::start(size_t worker_count){
+    std::lock_guard<std::mutex> guard(latch);
+    if(running){
+        return;
+    }
+    running = true;
+    if(worker_count == 0){
+        worker_count = std::max(1u, std::thread::hardware_concurrency());
+    }
+    for(size_t i=0;i<worker_count;i++){
+        workers.emplace_back(&WorkerPool::run, this);
+    }
+}
+
+void WorkerPool::stop(){
+    {
+        std::lock_guard<std::mutex> guard(latch);
+        if(!running){
+            return;
+        }
+        running = false;
+    }
+    cond.notify_all();
+    for(auto& worker : workers){
+        worker.join();
+    }
+    std::lock_guard<std::mutex> guard(latch);
+    workers.clear();
+}
+
+size_t WorkerPool::size(){
+    std::lock_guard<std::mutex> guard(latch);
+    return running ? workers.size() : 0;
+}
+
+void WorkerPool::submit(std::function<void()> task){
+    {
+        std::lock_guard<std::mutex> guard(latch);
+        if(running){
+            tasks.push_back(std::move(task));
+            cond.notify_one();
+            return;
+        }
+    }
+    task();
+}
+
+void WorkerPool::run(){
+    std::unique_lock<std::mutex> lock(latch);
+    while(true){
+        cond.wait(lock, [this]{
+            return !running || !tasks.empty();
+        });
+        if(tasks.empty()){
+            return;
+        }
+        std::function<void()> task = std::move(tasks.front());
+        tasks.pop_front();
+        lock.unlock();
+        task();
+        lock.lock();
+    }
+}
+
+}
@@ -0,0 +1,51 @@
+//
+//  worker_pool.hpp
+//  JasDB
+//
+
+#ifndef worker_pool_hpp
+#define worker_pool_hpp
+
+#include <stdio.h>
+#include <stdint.h>
+#include <thread>
+#include <mutex>
+#include <deque>
+#include <vector>
+#include <functional>
+#include <condition_variable>
+
+namespace jasdb{
+
+// Threads shared by the parallel scans of all statements, one per core. A scan hands in a task per morsel
+// and the workers take the tasks in the order they came, so a statement doesn't pay for starting threads
+// and concurrent statements share the cores instead of each starting threads of its own.
+// Tasks must not wait for other tasks, they would hold a worker while they wait.
+class WorkerPool {
+public:
+    WorkerPool() : running(false){}
+    ~WorkerPool(){
+        stop();
+    }
+    // one worker per core unless worker_count is given
+    void start(size_t worker_count = 0);
+    // the tasks handed in before are still run
+    void stop();
+    // number of workers, 0 while the pool is stopped
+    size_t size();
+    // a task handed in while the pool is stopped runs right away on the calling thread
+    void submit(std::function<void()> task);
+private:
+    std::vector<std::thread> workers;
+    std::mutex latch;
+    std::condition_variable cond;
+    bool running;
+    std::deque<std::function<void()>> tasks;
+    void run();
+};
+
+extern WorkerPool global_worker_pool;
+
+}
+
+#endif /* worker_pool_hpp */
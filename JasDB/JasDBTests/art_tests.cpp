@@ -0,0 +1,241 @@
+//
+//  art_tests.cpp
+//  JasDB
+//
+//  Randomized tests of the adaptive radix tree, built and run by run_tests.sh. Keys are inserted and erased
+//  until nodes have grown to 256 children and shrunk again. After every round each node has to have the type its
+//  number of children calls for, and point lookups, ranges and prefix ranges have to return what a std::set of
+//  the same entries holds.
+//
+
+#include <random>
+#include <algorithm>
+#include <set>
+#include <map>
+#include "art_index.hpp"
+#include "sql-parser-master/test/thirdparty/microtest/microtest.h"
+
+using namespace jasdb;
+
+// the tree is used without a table, so insert and erase are called directly
+class TestArt : public ArtIndex {
+public:
+    TestArt(std::vector<ColumnDefinition*>* columns, std::vector<size_t>& col_ids) : ArtIndex(columns, col_ids){}
+    using ArtIndex::insert;
+    using ArtIndex::erase;
+    using ArtIndex::root;
+};
+
+typedef std::set<std::pair<std::string, uint32_t>> EntrySet;
+
+// Keys end with '\0' like encoded strings. They share a few prefixes, so inner nodes get long prefixes
+// which inserts split, and the byte after a prefix takes any value, so nodes reach 256 children.
+static std::string randomKey(std::mt19937& rng){
+    static const char* prefixes[] = {"", "a", "ab", "abcdef", "abcxyz", "b"};
+    std::string key = prefixes[rng() % 6];
+    size_t len = rng() % 4;
+    for(size_t i=0;i<len;i++){
+        key.push_back(static_cast<char>(1 + rng() % 255));
+    }
+    key.push_back('\0');
+    return key;
+}
+
+static Tuple artTuple(uint32_t id){
+    Tuple tup;
+    tup.block = id;
+    tup.slot = id % 7;
+    return tup;
+}
+
+// Every inner node has at least two children and counts them right, and its type is one it can
+// have after growing at a full node and shrinking with slack: 4 holds 2-4 children, 16 holds 4-16,
+// 48 holds 13-48 and 256 holds 37-256. nodes counts the nodes of each type.
+static void checkNode(ArtNode* node, size_t* nodes){
+    nodes[node->type]++;
+    if(node->type == kArtLeaf){
+        ASSERT_FALSE(static_cast<ArtLeaf*>(node)->tuples.empty());
+        return;
+    }
+    ArtInner* inner = static_cast<ArtInner*>(node);
+    std::vector<ArtNode*> children;
+    if(node->type == kArtNode4 || node->type == kArtNode16){
+        size_t size = node->type == kArtNode4 ? 4 : 16;
+        ASSERT_TRUE(inner->count <= size);
+        for(size_t i=0;i<inner->count;i++){
+            uint8_t* keys = node->type == kArtNode4 ? static_cast<ArtNode4*>(node)->keys : static_cast<ArtNode16*>(node)->keys;
+            ArtNode** node_children = node->type == kArtNode4 ? static_cast<ArtNode4*>(node)->children : static_cast<ArtNode16*>(node)->children;
+            ASSERT_TRUE(i == 0 || keys[i - 1] < keys[i]);
+            children.push_back(node_children[i]);
+        }
+    }
+    else if(node->type == kArtNode48){
+        ArtNode48* node48 = static_cast<ArtNode48*>(node);
+        for(int byte=0;byte<256;byte++){
+            if(node48->child_index[byte] != 0){
+                children.push_back(node48->children[node48->child_index[byte] - 1]);
+            }
+        }
+    }
+    else{
+        ArtNode256* node256 = static_cast<ArtNode256*>(node);
+        for(int byte=0;byte<256;byte++){
+            if(node256->children[byte] != NULL){
+                children.push_back(node256->children[byte]);
+            }
+        }
+    }
+    ASSERT_EQ(children.size(), static_cast<size_t>(inner->count));
+    size_t least = node->type == kArtNode4 ? 2 : (node->type == kArtNode16 ? 4 : (node->type == kArtNode48 ? 13 : 37));
+    ASSERT_TRUE(inner->count >= least);
+    for(auto child : children){
+        ASSERT_TRUE(child != NULL);
+        checkNode(child, nodes);
+    }
+}
+
+// the tuples of range in the tree, they have to come in key order
+static void checkRange(TestArt& tree, const EntrySet& expected, const std::map<uint32_t, std::string>& keys, IndexRange& range){
+    std::vector<Tuple> tuples;
+    tree.scan(range, tuples);
+    std::vector<uint32_t> found;
+    std::string last;
+    for(auto& tup : tuples){
+        ASSERT_EQ(tup.slot, tup.block % 7);
+        auto it = keys.find(tup.block);
+        ASSERT_TRUE(it != keys.end());
+        ASSERT_TRUE(last <= it->second);
+        last = it->second;
+        found.push_back(tup.block);
+    }
+    std::vector<uint32_t> wanted;
+    for(auto& entry : expected){
+        if(range.compare(entry.first) == 0){
+            wanted.push_back(entry.second);
+        }
+    }
+    std::sort(found.begin(), found.end());
+    std::sort(wanted.begin(), wanted.end());
+    ASSERT_TRUE(found == wanted);
+}
+
+static void checkTree(TestArt& tree, const EntrySet& expected, std::mt19937& rng, size_t* nodes){
+    if(tree.root == NULL){
+        ASSERT_TRUE(expected.empty());
+    }
+    else{
+        checkNode(tree.root, nodes);
+    }
+    std::map<uint32_t, std::string> keys;
+    std::vector<std::string> listed;
+    for(auto& entry : expected){
+        keys[entry.second] = entry.first;
+        if(listed.empty() || listed.back() != entry.first){
+            listed.push_back(entry.first);
+        }
+    }
+    // keys of the tree and keys which may be missing, as points, bounds and prefixes
+    auto someKey = [&](){
+        return !listed.empty() && rng() % 2 == 0 ? listed[rng() % listed.size()] : randomKey(rng);
+    };
+    for(int i=0;i<200;i++){
+        IndexRange point;
+        point.has_lower = point.has_upper = true;
+        point.lower = point.upper = someKey();
+        checkRange(tree, expected, keys, point);
+    }
+    for(int i=0;i<100;i++){
+        IndexRange range;
+        std::string lower = someKey(), upper = someKey();
+        if(upper < lower){
+            std::swap(lower, upper);
+        }
+        range.has_lower = rng() % 4 != 0;
+        range.has_upper = rng() % 4 != 0;
+        range.lower_inclusive = rng() % 2 == 0;
+        range.upper_inclusive = rng() % 2 == 0;
+        range.lower = lower;
+        range.upper = upper;
+        checkRange(tree, expected, keys, range);
+    }
+    for(int i=0;i<100;i++){
+        // a LIKE 'prefix%' range, the prefix may end inside the prefix of a node
+        std::string key = someKey();
+        IndexRange range;
+        range.has_lower = range.has_upper = true;
+        range.lower_partial = range.upper_partial = true;
+        range.lower = range.upper = key.substr(0, rng() % key.size());
+        checkRange(tree, expected, keys, range);
+    }
+    IndexRange all;
+    std::vector<Tuple> tuples;
+    tree.scan(all, tuples);
+    ASSERT_EQ(tuples.size(), expected.size());
+}
+
+TEST(ArtRandomInsertEraseTest) {
+    const uint32_t kRounds = 6, kInserts = 4000;
+    std::vector<ColumnDefinition*> columns;
+    std::vector<size_t> col_ids;
+    TestArt tree(&columns, col_ids);
+    std::mt19937 rng(7);
+    EntrySet expected;
+    size_t nodes[5] = {0};
+    uint32_t next_id = 0;
+    for(uint32_t round=0;round<kRounds;round++){
+        for(uint32_t i=0;i<kInserts;i++){
+            // some keys get several tuples
+            std::string key = !expected.empty() && rng() % 8 == 0 ? expected.begin()->first : randomKey(rng);
+            tree.insert(key, artTuple(next_id));
+            expected.insert(std::make_pair(key, next_id));
+            next_id++;
+        }
+        checkTree(tree, expected, rng, nodes);
+        // erase most entries, the nodes shrink and single children merge into their parent
+        std::vector<std::pair<std::string, uint32_t>> entries(expected.begin(), expected.end());
+        std::shuffle(entries.begin(), entries.end(), rng);
+        size_t erase_count = round + 1 == kRounds ? entries.size() : entries.size() * 3 / 4;
+        for(size_t i=0;i<erase_count;i++){
+            tree.erase(entries[i].first, artTuple(entries[i].second));
+            expected.erase(entries[i]);
+            if(i % 1000 == 0){
+                checkTree(tree, expected, rng, nodes);
+            }
+        }
+        checkTree(tree, expected, rng, nodes);
+    }
+    ASSERT_TRUE(tree.root == NULL);
+    // every node type was used
+    for(int type=kArtLeaf;type<=kArtNode256;type++){
+        ASSERT_TRUE(nodes[type] > 0);
+    }
+}
+
+TEST(ArtSharedPrefixTest) {
+    // keys which are prefixes of each other up to the terminator, and a prefix split at every length
+    std::vector<ColumnDefinition*> columns;
+    std::vector<size_t> col_ids;
+    TestArt tree(&columns, col_ids);
+    std::mt19937 rng(11);
+    EntrySet expected;
+    size_t nodes[5] = {0};
+    std::string base = "abcdefghijklmnop";
+    uint32_t id = 0;
+    for(size_t len=base.size();len>0;len--){
+        std::string key = base.substr(0, len) + '\0';
+        tree.insert(key, artTuple(id));
+        expected.insert(std::make_pair(key, id++));
+        std::string branch = base.substr(0, len - 1) + 'z' + '\0';
+        tree.insert(branch, artTuple(id));
+        expected.insert(std::make_pair(branch, id++));
+        checkTree(tree, expected, rng, nodes);
+    }
+    for(auto entry : EntrySet(expected)){
+        tree.erase(entry.first, artTuple(entry.second));
+        expected.erase(entry);
+        checkTree(tree, expected, rng, nodes);
+    }
+    ASSERT_TRUE(tree.root == NULL);
+}
+
+TEST_MAIN();
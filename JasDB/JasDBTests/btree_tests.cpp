@@ -0,0 +1,182 @@
+//
+//  btree_tests.cpp
+//  JasDB
+//
+//  Concurrency tests of the B-link tree, built and run by run_tests.sh. Threads change the tree while
+//  others scan it, then every key has to be found once. Assertions can't fail inside the threads,
+//  they count what they saw wrong and the test checks the count.
+//
+
+#include <thread>
+#include <atomic>
+#include <random>
+#include <algorithm>
+#include <set>
+#include "btree.hpp"
+#include "sql-parser-master/test/thirdparty/microtest/microtest.h"
+
+using namespace jasdb;
+
+// the tree is used without a table, so insert, erase and load are called directly
+class TestTree : public BTreeIndex {
+public:
+    TestTree(std::vector<ColumnDefinition*>* columns, std::vector<size_t>& col_ids) : BTreeIndex(columns, col_ids){}
+    using BTreeIndex::insert;
+    using BTreeIndex::erase;
+    using BTreeIndex::load;
+};
+
+// big endian, so the keys sort like the values
+static std::string treeKey(uint32_t value){
+    std::string key(4, 0);
+    for(int i=0;i<4;i++){
+        key[i] = static_cast<char>((value >> (24 - 8 * i)) & 0xff);
+    }
+    return key;
+}
+
+static uint32_t keyValue(const std::string& key){
+    uint32_t value = 0;
+    for(int i=0;i<4;i++){
+        value = (value << 8) | static_cast<uint8_t>(key[i]);
+    }
+    return value;
+}
+
+static Tuple treeTuple(uint32_t value){
+    Tuple tup;
+    tup.block = value;
+    tup.slot = value % 7;
+    return tup;
+}
+
+// scan a random range, count entries out of order or outside the range
+static size_t checkRange(TestTree& tree, std::mt19937& rng, uint32_t max_value){
+    IndexRange range;
+    range.has_lower = range.has_upper = true;
+    uint32_t lower = rng() % max_value;
+    range.lower = treeKey(lower);
+    range.upper = treeKey(lower + max_value / 20);
+    std::vector<IndexEntry> entries;
+    tree.scanEntries(range, entries);
+    size_t wrong = 0;
+    for(size_t i=0;i<entries.size();i++){
+        if(range.compare(entries[i].key) != 0 || (i > 0 && !(entries[i - 1] < entries[i]))){
+            wrong++;
+        }
+    }
+    return wrong;
+}
+
+// every value of expected is found once by a point lookup, and a full scan returns exactly them in order
+static void checkTree(TestTree& tree, const std::set<uint32_t>& expected){
+    for(auto value : expected){
+        IndexRange range;
+        range.has_lower = range.has_upper = true;
+        range.lower = range.upper = treeKey(value);
+        std::vector<Tuple> tuples;
+        tree.scan(range, tuples);
+        ASSERT_EQ(tuples.size(), 1);
+        ASSERT_EQ(tuples[0].block, value);
+    }
+    IndexRange all;
+    std::vector<IndexEntry> entries;
+    tree.scanEntries(all, entries);
+    ASSERT_EQ(entries.size(), expected.size());
+    auto it = expected.begin();
+    for(size_t i=0;i<entries.size();i++, it++){
+        ASSERT_EQ(keyValue(entries[i].key), *it);
+        ASSERT_EQ(entries[i].tup.slot, *it % 7);
+    }
+}
+
+TEST(BTreeConcurrentInsertTest) {
+    // 8 * 8000 keys need three levels of 64 entry nodes, the root splits twice while the threads run
+    const uint32_t kThreads = 8, kPerThread = 8000;
+    std::vector<ColumnDefinition*> columns;
+    std::vector<size_t> col_ids;
+    TestTree tree(&columns, col_ids);
+    std::atomic<size_t> wrong(0);
+    std::atomic<bool> done(false);
+    std::vector<std::thread> threads;
+    for(uint32_t w=0;w<kThreads;w++){
+        threads.emplace_back([&, w](){
+            std::vector<uint32_t> values;
+            for(uint32_t i=0;i<kPerThread;i++){
+                values.push_back(i * kThreads + w);
+            }
+            std::mt19937 rng(w);
+            std::shuffle(values.begin(), values.end(), rng);
+            for(auto value : values){
+                tree.insert(treeKey(value), treeTuple(value));
+            }
+        });
+    }
+    threads.emplace_back([&](){
+        std::mt19937 rng(100);
+        while(!done){
+            wrong += checkRange(tree, rng, kThreads * kPerThread);
+        }
+    });
+    for(uint32_t w=0;w<kThreads;w++){
+        threads[w].join();
+    }
+    done = true;
+    threads.back().join();
+    ASSERT_EQ(wrong.load(), 0);
+    std::set<uint32_t> expected;
+    for(uint32_t value=0;value<kThreads * kPerThread;value++){
+        expected.insert(value);
+    }
+    checkTree(tree, expected);
+}
+
+TEST(BTreeConcurrentInsertEraseTest) {
+    // every thread owns the keys of its residue and knows which of them it left in the tree
+    const uint32_t kThreads = 8, kKeys = 5000, kChanges = 20000;
+    std::vector<ColumnDefinition*> columns;
+    std::vector<size_t> col_ids;
+    TestTree tree(&columns, col_ids);
+    std::vector<IndexEntry> entries;
+    for(uint32_t i=0;i<kKeys;i++){
+        uint32_t value = i * 16 + 15;
+        entries.emplace_back(treeKey(value), treeTuple(value));
+    }
+    tree.load(entries);
+    std::vector<std::set<uint32_t>> owned(kThreads);
+    std::atomic<size_t> wrong(0);
+    std::vector<std::thread> threads;
+    for(uint32_t w=0;w<kThreads;w++){
+        threads.emplace_back([&, w](){
+            std::mt19937 rng(w);
+            for(uint32_t i=0;i<kChanges;i++){
+                uint32_t value = (rng() % kKeys) * 16 + w;
+                if(rng() % 3 != 0){
+                    tree.insert(treeKey(value), treeTuple(value));
+                    owned[w].insert(value);
+                }
+                else{
+                    tree.erase(treeKey(value), treeTuple(value));
+                    owned[w].erase(value);
+                }
+                if(i % 50 == 0){
+                    wrong += checkRange(tree, rng, kKeys * 16);
+                }
+            }
+        });
+    }
+    for(auto& thread : threads){
+        thread.join();
+    }
+    ASSERT_EQ(wrong.load(), 0);
+    std::set<uint32_t> expected;
+    for(uint32_t i=0;i<kKeys;i++){
+        expected.insert(i * 16 + 15);
+    }
+    for(auto& values : owned){
+        expected.insert(values.begin(), values.end());
+    }
+    checkTree(tree, expected);
+}
+
+TEST_MAIN();
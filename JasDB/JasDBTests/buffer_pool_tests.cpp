@@ -0,0 +1,194 @@
+//
+//  buffer_pool_tests.cpp
+//  JasDB
+//
+//  Tests of eviction and pinning in the buffer pool, built and run by run_tests.sh. The pool gets its
+//  smallest size, so a few hundred pages keep it evicting. Pages keep a zero LSN, the log isn't opened.
+//  Assertions can't fail inside threads, they count what they saw wrong and the test checks the count.
+//
+
+#include <stdlib.h>
+#include <cstring>
+#include <thread>
+#include <atomic>
+#include <random>
+#include "buffer_pool.hpp"
+#include "sql-parser-master/test/thirdparty/microtest/microtest.h"
+
+using namespace jasdb;
+
+// the page's counter, after the page LSN
+const size_t kCounterOffset = 64;
+
+static uint64_t pageCounter(const char* page){
+    uint64_t value;
+    memcpy(&value, page + kCounterOffset, sizeof(value));
+    return value;
+}
+
+static void setPageCounter(char* page, uint64_t value){
+    memcpy(page + kCounterOffset, &value, sizeof(value));
+}
+
+static std::string tempDir(){
+    char dir_template[] = "/tmp/jasdb_buffer_pool_XXXXXX";
+    return mkdtemp(dir_template);
+}
+
+TEST(BufferPoolPinnedPagesStayTest) {
+    ASSERT_FALSE(global_buffer_pool.setMemoryBudget(0));
+    const uint32_t kFrames = static_cast<uint32_t>(global_buffer_pool.frameCount());
+    const uint32_t kPages = kFrames * 4;
+    std::string dir = tempDir();
+    PageFile file(dir + "/pages");
+    ASSERT_FALSE(file.open(true));
+    for(uint32_t i=0;i<kPages;i++){
+        uint32_t page_id;
+        char* page = global_buffer_pool.newPage(&file, &page_id);
+        ASSERT_NOTNULL(page);
+        ASSERT_EQ(page_id, i);
+        memset(page, 0, kPageSize);
+        setPageCounter(page, i + 1000);
+        global_buffer_pool.unpinPage(&file, page_id, true);
+    }
+    // all frames but one pinned, every other page has to pass through the last frame
+    std::vector<char*> pinned;
+    for(uint32_t i=0;i+1<kFrames;i++){
+        pinned.push_back(global_buffer_pool.fetchPage(&file, i));
+        ASSERT_NOTNULL(pinned.back());
+    }
+    for(uint32_t i=kFrames-1;i<kPages;i++){
+        char* page = global_buffer_pool.fetchPage(&file, i);
+        ASSERT_NOTNULL(page);
+        // the evicted dirty pages were written back before their frames were reused
+        ASSERT_EQ(pageCounter(page), i + 1000);
+        setPageCounter(page, i + 2000);
+        global_buffer_pool.unpinPage(&file, i, true);
+    }
+    for(uint32_t i=0;i<pinned.size();i++){
+        ASSERT_EQ(pageCounter(pinned[i]), i + 1000);
+    }
+    // with the last frame pinned too there is no victim left
+    ASSERT_NOTNULL(global_buffer_pool.fetchPage(&file, kFrames - 1));
+    ASSERT_NULL(global_buffer_pool.fetchPage(&file, kFrames));
+    global_buffer_pool.unpinPage(&file, kFrames - 1, false);
+    for(uint32_t i=0;i<pinned.size();i++){
+        global_buffer_pool.unpinPage(&file, i, false);
+    }
+    ASSERT_FALSE(global_buffer_pool.flushFile(&file));
+    global_buffer_pool.discardFile(&file);
+    for(uint32_t i=0;i<kPages;i++){
+        char* page = global_buffer_pool.fetchPage(&file, i);
+        ASSERT_NOTNULL(page);
+        uint64_t counter = i < kFrames - 1 ? i + 1000 : i + 2000;
+        ASSERT_EQ(pageCounter(page), counter);
+        global_buffer_pool.unpinPage(&file, i, false);
+    }
+    global_buffer_pool.discardFile(&file);
+    file.close();
+    ASSERT_EQ(system(("rm -rf " + dir).c_str()), 0);
+}
+
+TEST(BufferPoolConcurrentEvictionTest) {
+    // threads count up page counters while checkpoints write pages back, a thread appends pages
+    // and others read the appended ones, all in a pool a quarter of the pages fit into
+    ASSERT_FALSE(global_buffer_pool.setMemoryBudget(0));
+    const uint32_t kPages = static_cast<uint32_t>(global_buffer_pool.frameCount()) * 4;
+    const size_t kThreads = 4, kChanges = 20000, kAppends = 300;
+    std::string dir = tempDir();
+    PageFile file(dir + "/pages");
+    ASSERT_FALSE(file.open(true));
+    for(uint32_t i=0;i<kPages;i++){
+        uint32_t page_id;
+        char* page = global_buffer_pool.newPage(&file, &page_id);
+        ASSERT_NOTNULL(page);
+        memset(page, 0, kPageSize);
+        global_buffer_pool.unpinPage(&file, page_id, true);
+    }
+    // a page is changed by one thread at a time, like a row store page under its table latch
+    std::vector<std::mutex> page_latches(kPages);
+    std::vector<uint64_t> expected(kPages, 0);
+    std::atomic<size_t> wrong(0);
+    std::atomic<uint32_t> appended(kPages);
+    std::vector<std::thread> threads;
+    for(size_t t=0;t<kThreads;t++){
+        threads.emplace_back([&, t](){
+            std::mt19937 rng(static_cast<unsigned>(t));
+            for(size_t n=0;n<kChanges;n++){
+                uint32_t page_id = rng() % kPages;
+                std::lock_guard<std::mutex> guard(page_latches[page_id]);
+                char* page = global_buffer_pool.fetchPage(&file, page_id);
+                if(page == NULL || pageCounter(page) != expected[page_id]){
+                    wrong++;
+                    if(page == NULL){
+                        continue;
+                    }
+                }
+                setPageCounter(page, ++expected[page_id]);
+                global_buffer_pool.unpinPage(&file, page_id, true);
+            }
+        });
+    }
+    threads.emplace_back([&](){
+        for(int i=0;i<50;i++){
+            if(global_buffer_pool.checkpointFile(&file)){
+                wrong++;
+            }
+        }
+    });
+    threads.emplace_back([&](){
+        for(size_t i=0;i<kAppends;i++){
+            uint32_t page_id;
+            char* page = global_buffer_pool.newPage(&file, &page_id);
+            if(page == NULL){
+                wrong++;
+                continue;
+            }
+            memset(page, 0, kPageSize);
+            setPageCounter(page, page_id);
+            global_buffer_pool.unpinPage(&file, page_id, true);
+            appended = page_id + 1;
+            if(i % 10 == 0 && global_buffer_pool.flushFile(&file)){
+                wrong++;
+            }
+        }
+    });
+    for(size_t t=0;t<2;t++){
+        threads.emplace_back([&, t](){
+            std::mt19937 rng(static_cast<unsigned>(t + 100));
+            for(size_t n=0;n<5000;n++){
+                uint32_t end = appended;
+                if(end == kPages){
+                    continue;
+                }
+                uint32_t page_id = kPages + rng() % (end - kPages);
+                char* page = global_buffer_pool.fetchPage(&file, page_id);
+                if(page == NULL || pageCounter(page) != page_id){
+                    wrong++;
+                }
+                if(page != NULL){
+                    global_buffer_pool.unpinPage(&file, page_id, false);
+                }
+            }
+        });
+    }
+    for(auto& thread : threads){
+        thread.join();
+    }
+    ASSERT_EQ(wrong.load(), 0);
+    // what was written back is what the threads left in memory
+    ASSERT_FALSE(global_buffer_pool.flushFile(&file));
+    global_buffer_pool.discardFile(&file);
+    for(uint32_t i=0;i<appended;i++){
+        char* page = global_buffer_pool.fetchPage(&file, i);
+        ASSERT_NOTNULL(page);
+        uint64_t counter = i < kPages ? expected[i] : i;
+        ASSERT_EQ(pageCounter(page), counter);
+        global_buffer_pool.unpinPage(&file, i, false);
+    }
+    global_buffer_pool.discardFile(&file);
+    file.close();
+    ASSERT_EQ(system(("rm -rf " + dir).c_str()), 0);
+}
+
+TEST_MAIN();
@@ -0,0 +1,217 @@
+//
+//  executor_tests.cpp
+//  JasDB
+//
+//  Tests of statements run through the parser, optimizer and executor like main.cpp does, built and run by
+//  run_tests.sh. Every test opens a database of its own in a child process, the catalog is global.
+//
+
+#include <stdlib.h>
+#include <unistd.h>
+#include <sys/wait.h>
+#include <sstream>
+#include <functional>
+#include <thread>
+#include <algorithm>
+#include "parser.hpp"
+#include "optimizer.hpp"
+#include "executor.hpp"
+#include "metadata.hpp"
+#include "worker_pool.hpp"
+#include "sql-parser-master/test/thirdparty/microtest/microtest.h"
+
+using namespace jasdb;
+
+// run fn in a child, return its exit code. A failed assertion of the child fails it.
+static int runChild(std::function<void()> fn){
+    fflush(stdout);
+    pid_t pid = fork();
+    if(pid == 0){
+        try{
+            fn();
+        }
+        catch(mt::AssertFailedException& e){
+            std::cout << "Assertion failed in child: " << e.what() << " " << e.getFilepath() << ":" << e.getLine() << std::endl;
+            _exit(1);
+        }
+        _exit(0);
+    }
+    int status;
+    waitpid(pid, &status, 0);
+    return WIFEXITED(status) ? WEXITSTATUS(status) : -1;
+}
+
+static std::string tempDir(){
+    char dir_template[] = "/tmp/jasdb_executor_XXXXXX";
+    return mkdtemp(dir_template);
+}
+
+// what the statements print
+static std::string runStatements(const std::string& query){
+    std::ostringstream out;
+    std::streambuf* old = std::cout.rdbuf(out.rdbuf());
+    Parser parser;
+    if(!parser.parseStatement(query)){
+        Optimizer optimizer;
+        for(size_t i=0;i<parser.get_result()->size();i++){
+            Plan* plan = optimizer.create_plan_tree(parser.get_result()->getStatement(i));
+            if(plan == NULL){
+                continue;
+            }
+            Executor executor(plan);
+            executor.init();
+            executor.exec();
+            delete executor.op_tree;
+            delete plan;
+        }
+    }
+    std::cout.rdbuf(old);
+    return out.str();
+}
+
+static std::vector<std::string> outputLines(const std::string& output){
+    std::vector<std::string> lines;
+    std::istringstream in(output);
+    std::string line;
+    while(std::getline(in, line)){
+        lines.push_back(line);
+    }
+    return lines;
+}
+
+// a result of several batches has its header and row count printed once
+static void selectPrintsOnce(const std::string& storage){
+    const size_t kRows = 3000;
+    std::string dir = tempDir();
+    int status = runChild([&](){
+        ASSERT_FALSE(global_meta_data.open(dir));
+        runStatements("CREATE TABLE s.t (a INT, b VARCHAR(10)) WITH (storage = " + storage + ");");
+        std::string insert = "INSERT INTO s.t VALUES ";
+        for(size_t i=0;i<kRows;i++){
+            insert += (i == 0 ? "(" : ", (") + std::to_string(i) + ", 'v" + std::to_string(i) + "')";
+        }
+        // the ASSERT macros evaluate their arguments more than once, so keep the output in a variable
+        std::string output = runStatements(insert + ";");
+        ASSERT_EQ(output.find("Fail"), std::string::npos);
+
+        std::vector<std::string> lines = outputLines(runStatements("SELECT * FROM s.t;"));
+        ASSERT_EQ(lines.size(), kRows + 2);
+        ASSERT_TRUE(lines.front() == "a\tb");
+        ASSERT_TRUE(lines.back() == std::to_string(kRows) + " rows in set");
+        std::vector<bool> seen(kRows, false);
+        for(size_t i=1;i<=kRows;i++){
+            size_t tab = lines[i].find('\t');
+            ASSERT_TRUE(tab != std::string::npos);
+            size_t value = std::stoul(lines[i].substr(0, tab));
+            ASSERT_TRUE(value < kRows && !seen[value]);
+            ASSERT_TRUE(lines[i].substr(tab + 1) == "v" + std::to_string(value));
+            seen[value] = true;
+        }
+
+        // an empty result still has its header and count
+        lines = outputLines(runStatements("SELECT b FROM s.t WHERE a > 5000;"));
+        ASSERT_EQ(lines.size(), 2);
+        ASSERT_TRUE(lines[0] == "b");
+        ASSERT_TRUE(lines[1] == "0 rows in set");
+        ASSERT_FALSE(global_meta_data.close());
+    });
+    ASSERT_EQ(status, 0);
+    ASSERT_EQ(system(("rm -rf " + dir).c_str()), 0);
+}
+
+TEST(SelectPrintsRowBatchesOnceTest) {
+    selectPrintsOnce("row");
+}
+
+TEST(SelectPrintsColumnBatchesOnceTest) {
+    selectPrintsOnce("column");
+}
+
+// rows 0 to count - 1 of a table with one INT column
+static bool insertRange(TableStore* store, int64_t count){
+    for(int64_t first=0;first<count;first+=10000){
+        std::vector<std::vector<Expr*>*> rows;
+        for(int64_t i=first;i<std::min(count, first + 10000);i++){
+            rows.push_back(new std::vector<Expr*>(1, Expr::makeLiteral(i)));
+        }
+        bool res = store->insertTuples(rows);
+        for(auto values : rows){
+            delete (*values)[0];
+            delete values;
+        }
+        if(res){
+            return true;
+        }
+    }
+    return false;
+}
+
+// the rows the scan under the select of query returns, without printing them
+static size_t scanRows(const std::string& query){
+    Parser parser;
+    if(parser.parseStatement(query)){
+        return 0;
+    }
+    Optimizer optimizer;
+    Plan* plan = optimizer.create_plan_tree(parser.get_result()->getStatement(0));
+    Executor executor(plan);
+    executor.init();
+    size_t count = 0;
+    Batch* batch = NULL;
+    while(!executor.op_tree->next->exec(&batch) && batch != NULL){
+        count += batch->sel.size();
+    }
+    delete executor.op_tree;
+    delete plan;
+    return count;
+}
+
+// A table of several morsels is scanned by the worker pool, the rows still come in the order of the table.
+// Every morsel task keeps its own filter state, and scans of several statements share the workers.
+TEST(ParallelSelectKeepsTableOrderTest) {
+    const int64_t kRows = 300000;
+    std::string dir = tempDir();
+    int status = runChild([&](){
+        ASSERT_FALSE(global_meta_data.open(dir));
+        // several workers even on one core
+        global_worker_pool.stop();
+        global_worker_pool.start(4);
+        ASSERT_EQ(global_worker_pool.size(), 4);
+        runStatements("CREATE TABLE s.p (a INT); CREATE TABLE s.q (a INT);");
+        TableStore* store = global_meta_data.get_table("s", "p")->getTableStore();
+        ASSERT_FALSE(insertRange(store, kRows));
+        ASSERT_FALSE(insertRange(global_meta_data.get_table("s", "q")->getTableStore(), kRows));
+        uint32_t block_count;
+        ASSERT_FALSE(store->beginMorselScan(&block_count));
+        ASSERT_TRUE(block_count > 2 * store->morselBlocks());
+
+        std::vector<std::string> lines = outputLines(runStatements("SELECT a FROM s.p;"));
+        ASSERT_EQ(lines.size(), static_cast<size_t>(kRows) + 2);
+        for(int64_t i=0;i<kRows;i++){
+            ASSERT_TRUE(lines[i + 1] == std::to_string(i));
+        }
+        ASSERT_TRUE(lines.back() == std::to_string(kRows) + " rows in set");
+
+        lines = outputLines(runStatements("SELECT a FROM s.p WHERE a > 99999 AND a < 200001;"));
+        ASSERT_EQ(lines.size(), 100003);
+        for(int64_t i=0;i<100001;i++){
+            ASSERT_TRUE(lines[i + 1] == std::to_string(100000 + i));
+        }
+
+        // statements of different tables run side by side, their morsels queue up in the same pool
+        size_t counts[2] = {0, 0};
+        std::thread other([&counts](){
+            counts[1] = scanRows("SELECT a FROM s.q WHERE a < 250000;");
+        });
+        counts[0] = scanRows("SELECT a FROM s.p;");
+        other.join();
+        ASSERT_EQ(counts[0], static_cast<size_t>(kRows));
+        ASSERT_EQ(counts[1], 250000);
+        ASSERT_FALSE(global_meta_data.close());
+        ASSERT_EQ(global_worker_pool.size(), 0);
+    });
+    ASSERT_EQ(status, 0);
+    ASSERT_EQ(system(("rm -rf " + dir).c_str()), 0);
+}
+
+TEST_MAIN();
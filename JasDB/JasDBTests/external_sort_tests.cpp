@@ -0,0 +1,145 @@
+//
+//  external_sort_tests.cpp
+//  JasDB
+//
+//  Unit tests of ExternalSort, built and run by run_tests.sh with the microtest header of the bundled sql-parser.
+//
+
+#include <stdlib.h>
+#include <unistd.h>
+#include <dirent.h>
+#include <cstring>
+#include <random>
+#include <algorithm>
+#include <unordered_set>
+#include "external_sort.hpp"
+#include "sql-parser-master/test/thirdparty/microtest/microtest.h"
+
+using namespace jasdb;
+
+// a sort key which may be NULL and the tuple of its row, the payload column is block * 1000 + slot
+struct SortCase {
+    bool null;
+    int64_t key;
+    Tuple tup;
+};
+
+static std::vector<ColumnDefinition*> sortColumns(){
+    std::vector<ColumnDefinition*> columns;
+    columns.push_back(new ColumnDefinition(strdup("k"), ColumnType(DataType::INT), new std::unordered_set<ConstraintType>()));
+    columns.push_back(new ColumnDefinition(strdup("v"), ColumnType(DataType::LONG), new std::unordered_set<ConstraintType>()));
+    return columns;
+}
+
+// few distinct keys so most rows tie, added in an order unrelated to (block, slot)
+static std::vector<SortCase> sortCases(size_t count, unsigned seed){
+    std::vector<SortCase> cases;
+    for(uint32_t i=0;i<count;i++){
+        SortCase c;
+        c.null = i % 13 == 0;
+        c.key = static_cast<int64_t>(i * 7 % 5) - 2;
+        c.tup.block = i / 50;
+        c.tup.slot = i % 50;
+        cases.push_back(c);
+    }
+    std::mt19937 rng(seed);
+    std::shuffle(cases.begin(), cases.end(), rng);
+    return cases;
+}
+
+static size_t runFiles(const std::string& dir){
+    size_t count = 0;
+    DIR* d = opendir(dir.c_str());
+    while(struct dirent* entry = readdir(d)){
+        if(strncmp(entry->d_name, "sort.", 5) == 0){
+            count++;
+        }
+    }
+    closedir(d);
+    return count;
+}
+
+// sort cases with the given budget and fan-in, check the order and return the sort's counters
+static void checkSort(std::vector<SortCase> cases, bool descending_key, size_t memory_budget, size_t merge_ways,
+                      size_t* spills, size_t* merges){
+    char dir_template[] = "/tmp/jasdb_sort_XXXXXX";
+    std::string dir = mkdtemp(dir_template);
+    std::vector<ColumnDefinition*> columns = sortColumns();
+    TupleLayout layout(&columns);
+    std::vector<size_t> keys(1, 0);
+    std::vector<bool> descending(1, descending_key);
+    {
+        ExternalSort sort(&layout, keys, descending, dir, memory_budget, merge_ways);
+        std::vector<char> row(layout.size);
+        for(auto& c : cases){
+            std::vector<Expr*> values;
+            values.push_back(c.null ? Expr::makeNullLiteral() : Expr::makeLiteral(c.key));
+            values.push_back(Expr::makeLiteral(static_cast<int64_t>(c.tup.block * 1000 + c.tup.slot)));
+            layout.encode(&values, row.data());
+            for(auto val : values){
+                delete val;
+            }
+            ASSERT_FALSE(sort.add(c.tup, row.data()));
+        }
+        ASSERT_FALSE(sort.finish());
+
+        // NULL before the keys, descending reverses both, equal keys in (block, slot) order whatever the direction
+        std::stable_sort(cases.begin(), cases.end(), [descending_key](const SortCase& a, const SortCase& b){
+            if(a.null != b.null){
+                return a.null != descending_key;
+            }
+            if(!a.null && a.key != b.key){
+                return descending_key ? a.key > b.key : a.key < b.key;
+            }
+            return a.tup.block != b.tup.block ? a.tup.block < b.tup.block : a.tup.slot < b.tup.slot;
+        });
+        for(auto& c : cases){
+            Tuple tup;
+            const char* sorted_row;
+            ASSERT_FALSE(sort.next(&tup, &sorted_row));
+            ASSERT_NOTNULL(sorted_row);
+            ASSERT_EQ(tup.block, c.tup.block);
+            ASSERT_EQ(tup.slot, c.tup.slot);
+            ASSERT_EQ(layout.isNull(0, sorted_row), c.null);
+            int64_t payload;
+            memcpy(&payload, sorted_row + layout.offsets[1], sizeof(payload));
+            ASSERT_EQ(payload, static_cast<int64_t>(c.tup.block * 1000 + c.tup.slot));
+        }
+        Tuple tup;
+        const char* sorted_row;
+        ASSERT_FALSE(sort.next(&tup, &sorted_row));
+        ASSERT_NULL(sorted_row);
+        *spills = sort.spills;
+        *merges = sort.merges;
+    }
+    // the runs are gone with the sort
+    ASSERT_EQ(runFiles(dir), 0);
+    rmdir(dir.c_str());
+    for(auto col_def : columns){
+        delete col_def;
+    }
+}
+
+TEST(ExternalSortInMemoryTest) {
+    size_t spills, merges;
+    checkSort(sortCases(2000, 1), false, kSortMemoryBudget, kSortMergeWays, &spills, &merges);
+    ASSERT_EQ(spills, 0);
+    ASSERT_EQ(merges, 0);
+}
+
+TEST(ExternalSortMergePassesTest) {
+    // a record takes 29 bytes of the budget, so 3000 rows make ~43 runs and a 3 way merge needs several passes
+    size_t spills, merges;
+    checkSort(sortCases(3000, 2), false, 2048, 3, &spills, &merges);
+    ASSERT_TRUE(spills > 3);
+    ASSERT_TRUE(merges > 1);
+}
+
+TEST(ExternalSortDescendingTest) {
+    size_t spills, merges;
+    checkSort(sortCases(3000, 3), true, 4096, 2, &spills, &merges);
+    ASSERT_TRUE(spills > 2);
+    ASSERT_TRUE(merges > 1);
+}
+
+TEST_MAIN();
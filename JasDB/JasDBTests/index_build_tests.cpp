@@ -0,0 +1,206 @@
+//
+//  index_build_tests.cpp
+//  JasDB
+//
+//  Tests of the online index build, built and run by run_tests.sh. The build reads a table chunk by chunk
+//  while rows before and after its position are inserted, updated, deleted and restored, then the index
+//  has to list exactly what a build of the final table lists.
+//
+
+#include <stdlib.h>
+#include <cstring>
+#include <random>
+#include <algorithm>
+#include <unordered_set>
+#include "table_store.hpp"
+#include "btree.hpp"
+#include "hash_index.hpp"
+#include "art_index.hpp"
+#include "sql-parser-master/test/thirdparty/microtest/microtest.h"
+
+using namespace jasdb;
+
+// keys repeat, so the merge has to keep the tuples of one key apart
+const int64_t kKeys = 97;
+const size_t kRows = 3000;
+const size_t kChunk = 64;
+
+static std::string tempDir(){
+    char dir_template[] = "/tmp/jasdb_index_build_XXXXXX";
+    return mkdtemp(dir_template);
+}
+
+static IndexStore* newIndex(IndexMethod method, std::vector<ColumnDefinition*>* columns, std::vector<size_t>& col_ids){
+    if(method == kIndexHash){
+        return new HashIndex(columns, col_ids);
+    }
+    if(method == kIndexArt){
+        return new ArtIndex(columns, col_ids);
+    }
+    return new BTreeIndex(columns, col_ids);
+}
+
+static bool insertRow(TableStore* store, int64_t key, int64_t value){
+    std::vector<Expr*> values;
+    values.push_back(Expr::makeLiteral(key));
+    values.push_back(Expr::makeLiteral(value));
+    bool res = store->insertTuple(&values);
+    for(auto val : values){
+        delete val;
+    }
+    return res;
+}
+
+// a negative key sets NULL, which the index doesn't list
+static bool updateKey(TableStore* store, Tuple* tup, int64_t key){
+    std::vector<size_t> idxs(1, 0);
+    std::vector<Expr*> values(1, key < 0 ? Expr::makeNullLiteral() : Expr::makeLiteral(key));
+    bool res = store->updateTuple(tup, idxs, values);
+    delete values[0];
+    return res;
+}
+
+static std::vector<Tuple> lookup(IndexStore* index, ColumnDefinition* col_def, int64_t key){
+    IndexRange range;
+    range.has_lower = range.has_upper = true;
+    IndexStore::encodeValue(col_def, key, "", range.lower);
+    range.upper = range.lower;
+    std::vector<Tuple> tuples;
+    index->scan(range, tuples);
+    std::sort(tuples.begin(), tuples.end(), [](const Tuple& a, const Tuple& b){
+        return a.block != b.block ? a.block < b.block : a.slot < b.slot;
+    });
+    return tuples;
+}
+
+// every key lists the same tuples in both indexes, and neither has entries for other keys
+static void checkSameEntries(IndexStore* index, IndexStore* expected, ColumnDefinition* col_def){
+    size_t total = 0;
+    for(int64_t key=0;key<kKeys;key++){
+        std::vector<Tuple> tuples = lookup(index, col_def, key);
+        std::vector<Tuple> expected_tuples = lookup(expected, col_def, key);
+        ASSERT_EQ(tuples.size(), expected_tuples.size());
+        for(size_t i=0;i<tuples.size();i++){
+            ASSERT_EQ(tuples[i].block, expected_tuples[i].block);
+            ASSERT_EQ(tuples[i].slot, expected_tuples[i].slot);
+        }
+        total += tuples.size();
+    }
+    IndexRange all;
+    std::vector<Tuple> tuples;
+    index->scan(all, tuples);
+    ASSERT_EQ(tuples.size(), total);
+}
+
+static void buildWithChanges(IndexMethod method){
+    std::string dir = tempDir();
+    std::vector<ColumnDefinition*> columns;
+    columns.push_back(new ColumnDefinition(strdup("a"), ColumnType(DataType::INT), new std::unordered_set<ConstraintType>()));
+    columns.push_back(new ColumnDefinition(strdup("b"), ColumnType(DataType::INT), new std::unordered_set<ConstraintType>()));
+    std::mt19937 rng(static_cast<uint32_t>(method) + 1);
+    {
+        RowStore store(&columns, dir + "/t.tbl", true);
+        for(size_t i=0;i<kRows;i++){
+            ASSERT_FALSE(insertRow(&store, rng() % kKeys, static_cast<int64_t>(i)));
+        }
+        // the tuples the changes pick from in scan order, and which of them are deleted
+        std::vector<Tuple> tuples;
+        std::vector<bool> deleted;
+        Tuple tup;
+        bool done = false;
+        while(!store.seqScan(&tup, &done) && !done){
+            tuples.push_back(tup);
+            deleted.push_back(false);
+        }
+        store.endScan();
+        ASSERT_EQ(tuples.size(), kRows);
+
+        std::vector<size_t> col_ids(1, 0);
+        IndexStore* index = newIndex(method, &columns, col_ids);
+        store.indexes.push_back(index);
+        index->beginBuild();
+        std::vector<IndexEntry> entries;
+        done = false;
+        size_t last = 0;
+        while(!done){
+            ASSERT_FALSE(index->readChunk(&store, entries, kChunk, &done));
+            // the build stopped at the last tuple it read, the last entry unless its key was NULL
+            // or it is a row inserted meanwhile
+            for(size_t i=last;i<tuples.size() && !entries.empty();i++){
+                if(tuples[i].block == entries.back().tup.block && tuples[i].slot == entries.back().tup.slot){
+                    last = i;
+                    break;
+                }
+            }
+            // changes all over the table, to tuples the build has read and later ones,
+            // and to the tuples right at its position
+            for(int i=0;i<10;i++){
+                size_t pick = rng() % tuples.size();
+                if(i < 2 && last + i < tuples.size()){
+                    pick = last + i;
+                }
+                switch(rng() % 4){
+                    case 0:
+                        ASSERT_FALSE(insertRow(&store, rng() % kKeys, -1));
+                        break;
+                    case 1:
+                        if(deleted[pick]){
+                            ASSERT_FALSE(store.restoreTuple(&tuples[pick]));
+                            deleted[pick] = false;
+                        }
+                        else{
+                            ASSERT_FALSE(store.deleteTuple(&tuples[pick]));
+                            deleted[pick] = true;
+                        }
+                        break;
+                    default:
+                        if(!deleted[pick]){
+                            // a key may change several times, to NULL and back to one the build has listed already
+                            int64_t key = rng() % 8 == 0 ? -1 : static_cast<int64_t>(rng() % kKeys);
+                            ASSERT_FALSE(updateKey(&store, &tuples[pick], key));
+                        }
+                        break;
+                }
+            }
+        }
+        // as IndexBuilder::build does once the last chunk is read
+        index->loadEntries(entries);
+        index->finishBuild();
+        ASSERT_TRUE(index->built);
+        ASSERT_FALSE(index->building);
+
+        IndexStore* expected = newIndex(method, &columns, col_ids);
+        ASSERT_FALSE(expected->build(&store));
+        checkSameEntries(index, expected, columns[0]);
+
+        // the index keeps up with changes after the build
+        size_t live = std::find(deleted.begin(), deleted.end(), false) - deleted.begin();
+        ASSERT_FALSE(updateKey(&store, &tuples[live], kKeys - 1));
+        ASSERT_FALSE(insertRow(&store, 0, 0));
+        ASSERT_FALSE(expected->build(&store));
+        checkSameEntries(index, expected, columns[0]);
+
+        store.indexes.clear();
+        delete index;
+        delete expected;
+        store.drop();
+    }
+    for(auto col : columns){
+        delete col;
+    }
+    ASSERT_EQ(system(("rm -rf " + dir).c_str()), 0);
+}
+
+TEST(OnlineBuildBTreeTest) {
+    buildWithChanges(kIndexBTree);
+}
+
+TEST(OnlineBuildHashTest) {
+    buildWithChanges(kIndexHash);
+}
+
+TEST(OnlineBuildArtTest) {
+    buildWithChanges(kIndexArt);
+}
+
+TEST_MAIN();
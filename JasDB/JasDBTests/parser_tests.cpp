@@ -0,0 +1,73 @@
+//
+//  parser_tests.cpp
+//  JasDB
+//
+//  Tests of the checks the parser runs before a statement is planned, built and run by run_tests.sh.
+//
+
+#include <stdlib.h>
+#include "parser.hpp"
+#include "metadata.hpp"
+#include "sql-parser-master/test/thirdparty/microtest/microtest.h"
+
+using namespace jasdb;
+
+static std::string tempDir(){
+    char dir_template[] = "/tmp/jasdb_parser_XXXXXX";
+    return mkdtemp(dir_template);
+}
+
+// s.t (a INT, b INT) in a catalog of its own
+static void createTable(){
+    global_meta_data.data_dir = tempDir();
+    std::vector<ColumnDefinition*> columns;
+    columns.push_back(new ColumnDefinition(strdup("a"), ColumnType(DataType::INT), new std::unordered_set<ConstraintType>()));
+    columns.push_back(new ColumnDefinition(strdup("b"), ColumnType(DataType::INT), new std::unordered_set<ConstraintType>()));
+    Table* table = new Table("s", "t", &columns);
+    for(auto col : columns){
+        delete col;
+    }
+    ASSERT_FALSE(global_meta_data.insert_table(table));
+}
+
+static void dropTable(){
+    ASSERT_FALSE(global_meta_data.drop_table("s", "t"));
+    ASSERT_EQ(system(("rm -rf " + global_meta_data.data_dir).c_str()), 0);
+}
+
+static bool parse(const std::string& query){
+    Parser parser;
+    return parser.parseStatement(query);
+}
+
+TEST(InsertRowsMatchColumnsTest) {
+    createTable();
+    ASSERT_FALSE(parse("INSERT INTO s.t VALUES (1, 2), (3, 4);"));
+    ASSERT_FALSE(parse("INSERT INTO s.t (a, b) VALUES (1, 2), (3, 4);"));
+    // a short or a long row is rejected, wherever it is in the list
+    ASSERT_TRUE(parse("INSERT INTO s.t (a, b) VALUES (1, 2), (3);"));
+    ASSERT_TRUE(parse("INSERT INTO s.t (a, b) VALUES (1, 2, 3, 4);"));
+    ASSERT_TRUE(parse("INSERT INTO s.t VALUES (1), (3, 4);"));
+    ASSERT_TRUE(parse("INSERT INTO s.t VALUES (1, 2), (3, 4, 5);"));
+    dropTable();
+}
+
+TEST(InsertValuesFollowTableColumnsTest) {
+    // the values of every row are put in the order of the table columns
+    createTable();
+    Parser parser;
+    ASSERT_FALSE(parser.parseStatement("INSERT INTO s.t (b, a) VALUES (1, 2), (3, 4);"));
+    const InsertStatement* stmt = static_cast<const InsertStatement*>(parser.get_result()->getStatement(0));
+    ASSERT_EQ(stmt->valuesList->size(), 2);
+    int64_t expected[2][2] = {{2, 1}, {4, 3}};
+    for(size_t i=0;i<2;i++){
+        std::vector<Expr*>* values = (*stmt->valuesList)[i];
+        ASSERT_EQ(values->size(), 2);
+        for(size_t j=0;j<2;j++){
+            ASSERT_EQ((*values)[j]->ival, expected[i][j]);
+        }
+    }
+    dropTable();
+}
+
+TEST_MAIN();
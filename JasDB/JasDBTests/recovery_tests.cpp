@@ -0,0 +1,264 @@
+//
+//  recovery_tests.cpp
+//  JasDB
+//
+//  Crash recovery tests, built and run by run_tests.sh. Every test runs in child processes, a crash is
+//  a child leaving with _exit() without writing back anything, recovery is the next child opening the data.
+//
+
+#include <stdlib.h>
+#include <unistd.h>
+#include <sys/wait.h>
+#include <fcntl.h>
+#include <dirent.h>
+#include <cstring>
+#include <thread>
+#include <atomic>
+#include <functional>
+#include <unordered_set>
+#include "metadata.hpp"
+#include "transaction.hpp"
+#include "log_manager.hpp"
+#include "buffer_pool.hpp"
+#include "checkpoint.hpp"
+#include "vacuum.hpp"
+#include "sql-parser-master/test/thirdparty/microtest/microtest.h"
+
+using namespace jasdb;
+
+// run fn in a child, return its exit code. A failed assertion of the child fails it.
+// The ASSERT macros evaluate their arguments more than once, so keep the code in a variable
+static int runChild(std::function<void()> fn){
+    fflush(stdout);
+    pid_t pid = fork();
+    if(pid == 0){
+        try{
+            fn();
+        }
+        catch(mt::AssertFailedException& e){
+            std::cout << "Assertion failed in child: " << e.what() << " " << e.getFilepath() << ":" << e.getLine() << std::endl;
+            _exit(1);
+        }
+        _exit(0);
+    }
+    int status;
+    waitpid(pid, &status, 0);
+    return WIFEXITED(status) ? WEXITSTATUS(status) : -1;
+}
+
+static std::string tempDir(){
+    char dir_template[] = "/tmp/jasdb_recovery_XXXXXX";
+    return mkdtemp(dir_template);
+}
+
+static size_t logSegments(const std::string& dir){
+    size_t count = 0;
+    DIR* d = opendir(dir.c_str());
+    while(struct dirent* entry = readdir(d)){
+        if(strncmp(entry->d_name, "wal.", 4) == 0){
+            count++;
+        }
+    }
+    closedir(d);
+    return count;
+}
+
+static bool insertValues(TableStore* store, int64_t first, size_t count){
+    std::vector<std::vector<Expr*>*> rows;
+    for(size_t i=0;i<count;i++){
+        rows.push_back(new std::vector<Expr*>(1, Expr::makeLiteral(static_cast<int64_t>(first + i))));
+    }
+    bool res = store->insertTuples(rows);
+    for(auto values : rows){
+        delete (*values)[0];
+        delete values;
+    }
+    return res;
+}
+
+static std::vector<int64_t> scanValues(Table* table){
+    TupleLayout layout(&table->columns);
+    std::vector<char> row(layout.size);
+    std::vector<int64_t> values;
+    Tuple tup;
+    bool done = false;
+    while(!table->getTableStore()->seqScan(&tup, &done) && !done){
+        table->getTableStore()->readTuple(&tup, row.data());
+        int64_t value;
+        memcpy(&value, row.data() + layout.offsets[0], sizeof(value));
+        values.push_back(value);
+    }
+    table->getTableStore()->endScan();
+    return values;
+}
+
+TEST(RecLsnCoversChangesUnderOnePinTest) {
+    std::string dir = tempDir();
+    int status = runChild([&dir](){
+        ASSERT_FALSE(global_log_manager.open(dir));
+        PageFile file(dir + "/pages");
+        ASSERT_FALSE(file.open(true));
+        uint32_t page_id;
+        // a new page is dirty before any change set its LSN
+        uint64_t created = global_log_manager.currentLsn();
+        char* page = global_buffer_pool.newPage(&file, &page_id);
+        ASSERT_NOTNULL(page);
+        global_buffer_pool.unpinPage(&file, page_id, true);
+        ASSERT_TRUE(global_buffer_pool.minRecLsn(&file) <= created);
+        ASSERT_FALSE(global_buffer_pool.flushFile(&file));
+        ASSERT_EQ(global_buffer_pool.minRecLsn(&file), UINT64_MAX);
+
+        // several logged changes under one pin, like an insert of many rows into one page
+        page = global_buffer_pool.fetchPage(&file, page_id);
+        uint64_t first = 0;
+        for(int i=0;i<3;i++){
+            uint64_t lsn = global_log_manager.append(kLogInsert, 1, 0, NULL, NULL, 0);
+            memcpy(page, &lsn, sizeof(lsn));
+            first = first == 0 ? lsn : first;
+        }
+        // a checkpoint passes the pinned page by, then takes the redo LSN after the unpin
+        ASSERT_FALSE(global_buffer_pool.checkpointFile(&file));
+        global_buffer_pool.unpinPage(&file, page_id, true);
+        // recovery skips records whose LSN is below the redo LSN
+        ASSERT_TRUE(global_buffer_pool.minRecLsn(&file) <= first);
+        ASSERT_FALSE(global_buffer_pool.flushFile(&file));
+
+        // a change reported with markDirty while the page stays pinned
+        page = global_buffer_pool.fetchPage(&file, page_id);
+        first = global_log_manager.append(kLogInsert, 1, 0, NULL, NULL, 0);
+        memcpy(page, &first, sizeof(first));
+        global_buffer_pool.markDirty(&file, page_id);
+        uint64_t lsn = global_log_manager.append(kLogInsert, 1, 0, NULL, NULL, 0);
+        memcpy(page, &lsn, sizeof(lsn));
+        global_buffer_pool.unpinPage(&file, page_id, false);
+        ASSERT_TRUE(global_buffer_pool.minRecLsn(&file) <= first);
+        global_buffer_pool.discardFile(&file);
+    });
+    ASSERT_EQ(status, 0);
+    ASSERT_EQ(system(("rm -rf " + dir).c_str()), 0);
+}
+
+TEST(LogSegmentsSurviveCrashTest) {
+    const size_t kRecords = 20000, kRecordData = 1000;
+    std::string dir = tempDir();
+    // enough records for a second segment, the process dies once they are durable
+    int status = runChild([&](){
+        ASSERT_FALSE(global_log_manager.open(dir));
+        std::vector<char> data(kRecordData);
+        for(size_t i=0;i<kRecords;i++){
+            memcpy(data.data(), &i, sizeof(i));
+            Tuple tup;
+            tup.block = static_cast<uint32_t>(i);
+            tup.slot = 0;
+            global_log_manager.append(kLogInsert, 1, 1, &tup, data.data(), kRecordData);
+            if(i % 1000 == 999){
+                ASSERT_FALSE(global_log_manager.flushAll());
+            }
+        }
+        ASSERT_FALSE(global_log_manager.flushAll());
+        _exit(0);
+    });
+    ASSERT_EQ(status, 0);
+    ASSERT_TRUE(logSegments(dir) > 1);
+    status = runChild([&](){
+        ASSERT_FALSE(global_log_manager.open(dir));
+        std::vector<LogRecord*> records;
+        ASSERT_FALSE(global_log_manager.readAll(records));
+        ASSERT_EQ(records.size(), kRecords);
+        for(size_t i=0;i<records.size();i++){
+            size_t value;
+            memcpy(&value, records[i]->data.data(), sizeof(value));
+            ASSERT_EQ(value, i);
+            ASSERT_EQ(records[i]->header.block, static_cast<uint32_t>(i));
+        }
+        // the records of the first segments are given up, their files go
+        size_t segments = logSegments(dir);
+        ASSERT_FALSE(global_log_manager.truncate(records.back()->lsn));
+        ASSERT_TRUE(logSegments(dir) < segments);
+        for(auto record : records){
+            delete record;
+        }
+        global_log_manager.close();
+    });
+    ASSERT_EQ(status, 0);
+    ASSERT_EQ(system(("rm -rf " + dir).c_str()), 0);
+}
+
+// every committed row once, nothing of a running transaction
+static void checkCommittedRows(const std::string& dir, size_t count){
+    int status = runChild([&](){
+        ASSERT_FALSE(global_meta_data.open(dir));
+        Table* table = global_meta_data.get_table("s", "t");
+        ASSERT_NOTNULL(table);
+        std::vector<int64_t> values = scanValues(table);
+        std::unordered_set<int64_t> found(values.begin(), values.end());
+        ASSERT_EQ(values.size(), count);
+        ASSERT_EQ(found.size(), values.size());
+        for(int64_t v=0;v<static_cast<int64_t>(count);v++){
+            ASSERT_TRUE(found.count(v) == 1);
+        }
+        ASSERT_FALSE(global_meta_data.close());
+    });
+    ASSERT_EQ(status, 0);
+}
+
+static void committedRowsSurviveCrash(StorageType storage){
+    const size_t kWriters = 2, kTransactions = 40, kRows = 300;
+    std::string dir = tempDir();
+    // writers commit batches of rows into one table while checkpoints run, then the process dies
+    int status = runChild([&](){
+        ASSERT_FALSE(global_meta_data.open(dir));
+        std::vector<ColumnDefinition*> columns(1, new ColumnDefinition(strdup("a"), ColumnType(DataType::LONG), new std::unordered_set<ConstraintType>()));
+        Table* table = new Table("s", "t", &columns, storage);
+        ASSERT_FALSE(global_meta_data.insert_table(table));
+        std::atomic<bool> done(false);
+        std::thread checkpointer([&done](){
+            while(!done){
+                global_checkpointer.checkpoint();
+                std::this_thread::sleep_for(std::chrono::milliseconds(1));
+            }
+        });
+        std::vector<std::thread> writers;
+        std::atomic<bool> failed(false);
+        for(size_t w=0;w<kWriters;w++){
+            writers.emplace_back([&, w](){
+                for(size_t k=0;k<kTransactions;k++){
+                    // as Executor::exec does for a statement
+                    std::lock_guard<std::mutex> guard(table->getTableStore()->statement_latch);
+                    global_vacuum.enter();
+                    global_transaction.begin();
+                    if(insertValues(table->getTableStore(), (w * kTransactions + k) * kRows, kRows) || global_transaction.commit()){
+                        failed = true;
+                    }
+                    global_vacuum.leave();
+                }
+            });
+        }
+        for(auto& writer : writers){
+            writer.join();
+        }
+        // a transaction which is running at the crash, its log may be durable already
+        global_vacuum.enter();
+        global_transaction.begin();
+        ASSERT_FALSE(insertValues(table->getTableStore(), -1000, kRows));
+        ASSERT_FALSE(global_log_manager.flushAll());
+        ASSERT_FALSE(failed);
+        _exit(0);
+    });
+    ASSERT_EQ(status, 0);
+    checkCommittedRows(dir, kWriters * kTransactions * kRows);
+    // the table was written back at the end of recovery, and again at close
+    checkCommittedRows(dir, kWriters * kTransactions * kRows);
+    ASSERT_EQ(system(("rm -rf " + dir).c_str()), 0);
+}
+
+TEST(CommittedRowsSurviveCrashTest) {
+    committedRowsSurviveCrash(kRowStorage);
+}
+
+// the checkpoints write the groups of a column table which changed and copy the others from the old file
+TEST(CommittedColumnRowsSurviveCrashTest) {
+    committedRowsSurviveCrash(kColumnStorage);
+}
+
+TEST_MAIN();
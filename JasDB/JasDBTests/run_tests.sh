@@ -0,0 +1,42 @@
+#!/bin/sh
+#
+#  run_tests.sh
+#  JasDB
+#
+#  Builds and runs every *_tests.cpp of this directory:
+#      JasDBTests/run_tests.sh [build dir]
+#  The tests are linked with the JasDB sources but main.cpp, and with the bundled sql-parser.
+#  CXXFLAGS is added to the compiler flags, e.g. CXXFLAGS=-fsanitize=address.
+#
+
+set -e
+
+TESTS=$(cd "$(dirname "$0")" && pwd)
+SRC="$TESTS/../JasDB"
+PARSER="$SRC/sql-parser-master/src"
+BUILD=${1:-/tmp/jasdb_tests}
+FLAGS="-std=c++17 -g -O1 -I$SRC $CXXFLAGS"
+
+mkdir -p "$BUILD/jasdb" "$BUILD/sqlparser"
+objects=""
+for f in "$PARSER"/*.cpp "$PARSER"/parser/bison_parser.cpp "$PARSER"/parser/flex_lexer.cpp "$PARSER"/sql/*.cpp "$PARSER"/util/*.cpp; do
+    o="$BUILD/sqlparser/$(basename "$f" .cpp).o"
+    ${CXX:-g++} $FLAGS -w -c "$f" -o "$o"
+    objects="$objects $o"
+done
+for f in "$SRC"/*.cpp; do
+    case $(basename "$f") in
+        main.cpp) continue;;
+    esac
+    o="$BUILD/jasdb/$(basename "$f" .cpp).o"
+    ${CXX:-g++} $FLAGS -c "$f" -o "$o"
+    objects="$objects $o"
+done
+
+failed=0
+for t in "$TESTS"/*_tests.cpp; do
+    name=$(basename "$t" .cpp)
+    ${CXX:-g++} $FLAGS "$t" $objects -lpthread -o "$BUILD/$name"
+    "$BUILD/$name" || failed=1
+done
+exit $failed